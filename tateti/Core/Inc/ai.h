@@ -10,25 +10,331 @@
 
 #include <stdint.h>
 #include "keyboard.h"
+#include "game_logic.h"
+#include "ai_search.h"
+#include "mnk.h"
+#include "mcts.h"
+#include "ultimate.h"
+
+/* Nodos que se visitan entre dos lecturas del contador de ciclos en AI_Step */
+#define AI_STEP_NODES       32u
+
+/* Respuestas guardadas por el pensamiento anticipado (una por jugada del rival) */
+#define AI_PONDER_CACHE_SIZE  MNK_MAX_CELLS
+
+/* Monte-Carlo (AI_MCTS): memoria y presupuesto de iteraciones */
+#ifndef AI_MCTS_POOL_NODES
+#define AI_MCTS_POOL_NODES    1024u     // 24 bytes por nodo
+#endif
+#ifndef AI_MCTS_ITERATIONS
+#define AI_MCTS_ITERATIONS    4000u     // Simulaciones por jugada
+#endif
+#ifndef AI_MCTS_PONDER_ITERATIONS
+#define AI_MCTS_PONDER_ITERATIONS  20000u  // Tope durante el turno del rival
+#endif
+#define AI_MCTS_STEP_ITERATIONS    8u   // Iteraciones entre lecturas del contador de ciclos
+#define AI_MCTS_SEED          0x2545F491u
+
+/* Ultimate tateti: plazo de la búsqueda alfa-beta (AI_Step) y profundidad de AI_MEDIUM */
+#ifndef ULTIMATE_AI_BUDGET_MS
+#define ULTIMATE_AI_BUDGET_MS     300u
+#endif
+#define ULTIMATE_AI_MEDIUM_DEPTH  2u
+
+/* Semilla por defecto del generador de AI_EASY (ver AI_SetSeed) */
+#define AI_EASY_SEED          0x6D2B79F5u
+
+/* Temperatura del softmax con que eligen AI_EASY y AI_MEDIUM sobre la lista
+ * ordenada (en puntos de AISearch: ganar en la jugada d vale 10 - d) */
+#ifndef AI_EASY_TEMPERATURE
+#define AI_EASY_TEMPERATURE   50.0f     // Casi uniforme
+#endif
+#ifndef AI_MEDIUM_TEMPERATURE
+#define AI_MEDIUM_TEMPERATURE 3.5f      // Hard le saca unos 90 Elo
+#endif
 
 /**
  * @brief Niveles de dificultad de la IA
  */
 typedef enum {
-    AI_EASY = 0,    // Movimientos aleatorios
-    AI_MEDIUM = 1,  // Bloquea y busca ganar
-    AI_HARD = 2     // Minimax (invencible)
+    AI_EASY = 0,    // Softmax caliente: casi al azar
+    AI_MEDIUM = 1,  // Softmax tibio: suele ganar y bloquear
+    AI_HARD = 2,    // Jugada de la tabla de juego perfecto (invencible)
+    AI_MCTS = 3,    // Monte-Carlo (UCT) con presupuesto de simulaciones
+    AI_LEARNED = 4  // Política aprendida por refuerzo (ai_policy.h)
 } AI_Difficulty_t;
 
+/**
+ * @brief Evaluación de las hojas del alfa-beta m,n,k (AI_BeginSearchMNK)
+ */
+typedef enum {
+    AI_EVAL_LINES = 0,  // Heurística de líneas abiertas (MNK_Evaluate)
+    AI_EVAL_NN          // Red int8 de nn_eval.h (en su variante; si no, líneas)
+} AI_Evaluation_t;
+
+/**
+ * @brief Estado de la búsqueda incremental
+ */
+typedef enum {
+    AI_SEARCH_IDLE = 0,     // Sin búsqueda en curso
+    AI_SEARCH_RUNNING,      // Buscando: llamar a AI_Step()
+    AI_SEARCH_DONE          // Jugada lista: leer con AI_Poll()
+} AI_SearchState_t;
+
+/**
+ * @brief Contadores del pensamiento anticipado
+ */
+typedef struct {
+    uint32_t hits;      // Búsquedas resueltas con una respuesta ya pensada (o subárbol reutilizado)
+    uint32_t misses;    // Búsquedas que tuvieron que empezar de cero
+    uint32_t replies;   // Respuestas completadas durante el turno del rival
+} AI_PonderStats_t;
+
+/**
+ * @brief Valor teórico de cada jugada legal (máscaras de celdas, bit = posición)
+ */
+typedef struct {
+    uint16_t win;       // El jugador que mueve gana con juego perfecto
+    uint16_t draw;
+    uint16_t loss;
+} AI_MoveValues_t;
+
+/**
+ * @brief Política de selección sobre la lista de AI_RankMoves
+ * @note  Con temperatura 0 se juega la jugada rank (0 = la mejor; si hay
+ *        menos jugadas, la peor). Con temperatura > 0 se sortea con pesos
+ *        exp((puntaje - mejor) / temperatura) y rank no se usa.
+ */
+typedef struct {
+    uint8_t rank;
+    float temperature;
+} AI_Policy_t;
+
+/**
+ * @brief Jugador de IA con estado propio (reentrante)
+ * @note  No comparte nada con AI_CalculateMove() ni con la búsqueda
+ *        incremental: varios jugadores pueden mover a la vez desde hilos
+ *        distintos (p. ej. Tools/ai_selfplay.c). Cada uno tiene su generador
+ *        para AI_EASY y su árbol para AI_MCTS, así que una partida es
+ *        reproducible a partir de la semilla.
+ */
+typedef struct {
+    AI_Difficulty_t difficulty;
+    uint32_t rng;               // Estado del xorshift32 de AI_EASY/AI_MEDIUM (nunca 0)
+    uint32_t mcts_iterations;   // Simulaciones por jugada en AI_MCTS
+    MCTS_Tree_t mcts;           // Árbol sobre el arreglo pasado a AI_PlayerInit
+    uint32_t nodes;             // Simulaciones de la última jugada (solo AI_MCTS)
+} AI_Player_t;
+
 /**
  * @brief  Calcula el siguiente movimiento de la IA según nivel configurado
  * @retval Tecla correspondiente al movimiento (KEY_P4 a KEY_P14)
  */
 Keyboard_Key_t AI_CalculateMove(void);
 
+/**
+ * @brief  Calcula el siguiente movimiento de la IA sobre un contexto de partida
+ * @param  ctx: Contexto de la partida (no se modifica)
+ * @retval Tecla correspondiente al movimiento (KEY_P4 a KEY_P14)
+ */
+Keyboard_Key_t AI_CalculateMoveCtx(const GameContext_t* ctx);
+
+/**
+ * @brief  Inicia una búsqueda no bloqueante sobre un contexto de partida
+ * @note   AI_EASY, AI_MEDIUM, AI_HARD y AI_LEARNED se resuelven en el acto
+ *         (estado AI_SEARCH_DONE). AI_MCTS se busca de a pasos con AI_Step() hasta
+ *         agotar el plazo.
+ * @param  ctx: Contexto de la partida (se copia, no se modifica)
+ * @param  deadline_ms: Plazo máximo desde ahora; al vencer se juega la mejor
+ *         jugada encontrada hasta ese momento
+ */
+void AI_BeginSearch(const GameContext_t* ctx, uint32_t deadline_ms);
+
+/**
+ * @brief  Inicia una búsqueda no bloqueante sobre un tablero m,n,k
+ * @param  rules: Variante en juego (debe seguir existiendo durante la búsqueda)
+ * @param  board: Posición a analizar (se copia)
+ * @param  max_depth: Profundidad máxima en jugadas
+ * @param  deadline_ms: Plazo máximo desde ahora
+ */
+void AI_BeginSearchMNK(const MNK_Rules_t* rules, const MNK_Board_t* board, uint8_t max_depth,
+                       uint32_t deadline_ms);
+
+/**
+ * @brief  Inicia una búsqueda Monte-Carlo no bloqueante sobre un tablero m,n,k
+ * @note   El árbol se conserva entre llamadas: si la posición desciende de la
+ *         anterior se reutilizan sus simulaciones
+ * @param  rules: Variante en juego (debe seguir existiendo durante la búsqueda)
+ * @param  board: Posición a analizar (se copia)
+ * @param  iterations: Simulaciones acumuladas a alcanzar en la raíz
+ * @param  deadline_ms: Plazo máximo desde ahora
+ */
+void AI_BeginSearchMCTS(const MNK_Rules_t* rules, const MNK_Board_t* board, uint32_t iterations,
+                        uint32_t deadline_ms);
+
+/**
+ * @brief  Inicia la búsqueda no bloqueante de la IA en el ultimate tateti
+ * @note   AI_HARD, AI_MCTS y AI_LEARNED profundizan con ultimate_search.c
+ *         hasta ULTIMATE_AI_BUDGET_MS desde ahora; AI_MEDIUM se detiene en
+ *         ULTIMATE_AI_MEDIUM_DEPTH y AI_EASY juega al azar en el acto. La
+ *         búsqueda avanza con AI_Step() y AI_Poll() devuelve
+ *         sub-tablero * 9 + celda.
+ * @param  board: Posición con turno de la IA (se copia)
+ */
+void AI_BeginSearchUltimate(const UT_Board_t* board);
+
+/**
+ * @brief  Avanza la búsqueda en curso durante un tiempo acotado
+ * @note   El tiempo se mide con el contador de ciclos DWT; el plazo total con
+ *         HAL_GetTick(). Se puede llamar en cada vuelta del loop principal.
+ * @param  budget_us: Tiempo máximo de CPU a usar en esta llamada
+ * @retval Estado de la búsqueda después del paso
+ */
+AI_SearchState_t AI_Step(uint32_t budget_us);
+
+/**
+ * @brief  Consulta el resultado de la búsqueda
+ * @param  position_out: Mejor jugada hasta el momento (puede ser NULL)
+ * @retval true si la búsqueda terminó, false si sigue en curso o no hay búsqueda
+ */
+bool AI_Poll(uint8_t* position_out);
+
+/**
+ * @brief  Descarta la búsqueda en curso (p. ej. al resetear la partida)
+ */
+void AI_CancelSearch(void);
+
+/**
+ * @brief  Obtiene el estado de la búsqueda incremental
+ * @retval Estado actual
+ */
+AI_SearchState_t AI_GetSearchState(void);
+
+/**
+ * @brief  Convierte una posición del tablero en la tecla que la representa
+ * @param  position: Posición del tablero (0-8)
+ * @retval Tecla correspondiente (KEY_P4 a KEY_P14)
+ */
+Keyboard_Key_t AI_PositionToKey(uint8_t position);
+
+/**
+ * @brief  Empieza a pensar las respuestas mientras mueve el jugador 1
+ * @note   Se analiza cada jugada legal del jugador 1 y la respuesta se guarda
+ *         indexada por la posición resultante. AI_BeginSearch() la usa al
+ *         instante si el jugador 1 eligió una jugada ya analizada.
+ *         En el 3x3 solo tiene efecto en AI_MCTS: se sigue simulando sobre la
+ *         posición actual y el subárbol de la jugada de P1 se reutiliza.
+ * @param  ctx: Contexto de la partida con turno del jugador 1 (se copia)
+ */
+void AI_BeginPonder(const GameContext_t* ctx);
+
+/**
+ * @brief  Empieza a pensar las respuestas sobre un tablero m,n,k
+ * @param  rules: Variante en juego (debe seguir existiendo mientras se piensa)
+ * @param  board: Posición con el rival por mover (se copia)
+ * @param  max_depth: Profundidad de cada respuesta
+ * @param  node_limit: Nodos máximos por respuesta (0 = sin límite)
+ */
+void AI_BeginPonderMNK(const MNK_Rules_t* rules, const MNK_Board_t* board, uint8_t max_depth,
+                       uint32_t node_limit);
+
+/**
+ * @brief  Avanza el pensamiento anticipado durante un tiempo acotado
+ * @param  budget_us: Tiempo máximo de CPU a usar en esta llamada
+ * @retval true si quedan respuestas por calcular
+ */
+bool AI_Ponder(uint32_t budget_us);
+
+/**
+ * @brief  Detiene el pensamiento anticipado y descarta las respuestas guardadas
+ */
+void AI_StopPonder(void);
+
+/**
+ * @brief  Obtiene los contadores del pensamiento anticipado
+ * @retval Copia de los contadores
+ */
+AI_PonderStats_t AI_GetPonderStats(void);
+
+/**
+ * @brief  Pone a cero los contadores del pensamiento anticipado
+ */
+void AI_ResetPonderStats(void);
+
+/**
+ * @brief  Prepara un jugador independiente para una partida nueva
+ * @note   La primera llamada genera las reglas 3x3 del motor m,n,k: hacerla
+ *         antes de lanzar hilos que usen otros jugadores
+ * @param  player: Jugador a inicializar
+ * @param  difficulty: Nivel con el que juega
+ * @param  seed: Semilla de AI_EASY y de las simulaciones de AI_MCTS
+ * @param  pool: Arreglo de nodos para AI_MCTS (NULL en otros niveles)
+ * @param  pool_nodes: Cantidad de nodos de pool
+ * @param  mcts_iterations: Simulaciones por jugada (0 = AI_MCTS_ITERATIONS)
+ */
+void AI_PlayerInit(AI_Player_t* player, AI_Difficulty_t difficulty, uint32_t seed,
+                   MCTS_Node_t* pool, uint16_t pool_nodes, uint32_t mcts_iterations);
+
+/**
+ * @brief  Calcula la jugada de un jugador independiente (bloqueante)
+ * @note   AI_EASY y AI_MEDIUM aplican la política de su nivel a
+ *         AI_RankMoves con el generador del jugador; AI_HARD juega la
+ *         jugada de la tabla (ai_table.h) y AI_LEARNED consulta la
+ *         política aprendida
+ * @param  player: Jugador que mueve
+ * @param  ctx: Contexto de la partida (no se modifica)
+ * @param  side: Fichas con las que juega (CELL_PLAYER1 o CELL_PLAYER2)
+ * @retval Posición elegida (0-8)
+ */
+uint8_t AI_PlayerMove(AI_Player_t* player, const GameContext_t* ctx, CellState_t side);
+
+/**
+ * @brief  Puntúa todas las jugadas legales en un solo recorrido
+ * @note   Resultado exacto de la tabla precalculada (ai_table.h) en la escala
+ *         de ai_search.h, con la distancia más corta posible: ganar en el
+ *         acto 9, ganar más adelante 7, empatar 0, perder en la jugada
+ *         siguiente -8 y más adelante -6. De mayor a menor; no usa RAM
+ *         aparte de la pila y cuesta a lo sumo 9 consultas. Es la base de todos los niveles salvo AI_MCTS: cada uno es una
+ *         política distinta sobre la misma lista (ver AI_SelectRanked)
+ * @param  ctx: Contexto de la partida (no se modifica)
+ * @param  side: Jugador que mueve (CELL_PLAYER1 o CELL_PLAYER2)
+ * @param  moves: Jugadas ordenadas
+ * @retval Cantidad de jugadas
+ */
+uint8_t AI_RankMoves(const GameContext_t* ctx, CellState_t side, AISearch_Move_t moves[BB_NUM_CELLS]);
+
+/**
+ * @brief  Elige una jugada de la lista de AI_RankMoves según una política
+ * @param  moves: Jugadas ordenadas de mayor a menor puntaje
+ * @param  count: Cantidad de jugadas
+ * @param  policy: Política de selección
+ * @param  rng: Estado del xorshift32 a usar si la política sortea (nunca 0)
+ * @retval Posición elegida (0-8); 0 si no hay jugadas
+ */
+uint8_t AI_SelectRanked(const AISearch_Move_t moves[], uint8_t count, const AI_Policy_t* policy,
+                        uint32_t* rng);
+
+/**
+ * @brief  Clasifica cada jugada legal en victoria, empate o derrota
+ * @note   Una consulta a la tabla de juego perfecto por celda libre (a lo
+ *         sumo 9), sin búsqueda: la tabla tiene todas las posiciones de una
+ *         partida legal con cualquiera de los dos por mover. No usa el
+ *         estado de la búsqueda incremental ni del pensamiento anticipado.
+ * @param  ctx: Contexto de la partida (no se modifica)
+ * @param  side: Jugador que mueve (CELL_PLAYER1 o CELL_PLAYER2)
+ * @param  values: Máscaras resultantes (las celdas ocupadas quedan en 0)
+ */
+void AI_EvaluateMoves(const GameContext_t* ctx, CellState_t side, AI_MoveValues_t* values);
+
+/**
+ * @brief  Reinicia el generador de AI_EASY usado por AI_CalculateMove
+ * @param  seed: Semilla (0 se reemplaza por AI_EASY_SEED)
+ */
+void AI_SetSeed(uint32_t seed);
+
 /**
  * @brief  Configura el nivel de dificultad de la IA
- * @param  difficulty: Nivel de dificultad (AI_EASY, AI_MEDIUM, AI_HARD)
+ * @param  difficulty: Nivel de dificultad (AI_EASY, AI_MEDIUM, AI_HARD, AI_MCTS, AI_LEARNED)
  */
 void AI_SetDifficulty(AI_Difficulty_t difficulty);
 
@@ -38,4 +344,26 @@ void AI_SetDifficulty(AI_Difficulty_t difficulty);
  */
 AI_Difficulty_t AI_GetDifficulty(void);
 
+/**
+ * @brief  Elige la evaluación de hojas de las búsquedas m,n,k
+ * @note   Llamar entre búsquedas: descarta el pensamiento anticipado y la
+ *         tabla de transposición, que guardan puntajes de la otra evaluación
+ * @param  evaluation: AI_EVAL_LINES (por defecto) o AI_EVAL_NN
+ */
+void AI_SetEvaluation(AI_Evaluation_t evaluation);
+
+/**
+ * @brief  Obtiene la cantidad de nodos visitados por la última búsqueda
+ * @note   En AI_EASY, AI_MEDIUM, AI_HARD y AI_LEARNED son los nodos de
+ *         AISearch_Negamax visitados para la última jugada: 0 cuando la
+ *         tabla tiene la posición (siempre en una partida legal), los de
+ *         la búsqueda de respaldo si no. Los nodos del negamax solo se
+ *         miden con AISearch_BestMove (fila search de ai_bench.c).
+ *         Incluye los nodos de la búsqueda incremental en curso; en AI_MCTS
+ *         devuelve las simulaciones acumuladas en la raíz y en el ultimate
+ *         tateti los nodos de ultimate_search.c.
+ * @retval Nodos visitados
+ */
+uint32_t AI_GetLastNodeCount(void);
+
 #endif /* INC_AI_H_ */
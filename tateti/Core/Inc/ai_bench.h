@@ -0,0 +1,78 @@
+/**
+ ******************************************************************************
+ * @file    ai_bench.h
+ * @brief   Benchmark de la IA: latencia y nodos por posición en cada nivel
+ ******************************************************************************
+ * @attention
+ *
+ * Recorre todas las posiciones alcanzables en las que mueve el jugador 2
+ * (empiece quien empiece) y mide cuánto tarda cada motor en elegir jugada.
+ * Informa mínimo, mediana, percentil 99 y máximo de la latencia, nodos
+ * visitados y nodos por segundo, en formato CSV.
+ *
+ * El reloj lo provee el llamador: en la placa el contador de ciclos DWT
+ * (AIBench_RunTarget), en la PC clock_gettime (Tools/ai_bench.c, que además
+ * compara contra un archivo de referencia).
+ *
+ * En la placa: compilar con -DAI_BENCH_ON_TARGET=<máscara de motores>
+ * (p. ej. 0x77 = todos menos Monte-Carlo) y leer el CSV por USART3.
+ *
+ * La fila "overlay" es la latencia del modo entrenador: tiene que entrar
+ * con holgura en un cuadro del display (16 LEDs x 24 bits x 1,25 us más
+ * el reset, unos 530 us) porque se calcula antes de enviar el cuadro que
+ * muestra el cambio de turno.
+ *
+ ******************************************************************************
+ */
+
+#ifndef INC_AI_BENCH_H_
+#define INC_AI_BENCH_H_
+
+#include <stdint.h>
+#include <stdbool.h>
+#include "bitboard.h"
+
+/* Defines -------------------------------------------------------------------*/
+#define AI_BENCH_MAX_POSITIONS  4608u   // Hay 4520 posiciones con turno de P2
+#define AI_BENCH_SEED           12345u  // Semilla de AI_SetSeed() para AI_EASY
+
+/* Motores medidos */
+typedef enum {
+    AI_BENCH_EASY = 0,
+    AI_BENCH_MEDIUM,
+    AI_BENCH_HARD,
+    AI_BENCH_MCTS,
+    AI_BENCH_SEARCH,        // Negamax de ai_search.c sin la tabla
+    AI_BENCH_OVERLAY,       // AI_EvaluateMoves: valor de todas las jugadas (modo entrenador)
+    AI_BENCH_LEARNED,       // Política aprendida (AI_LEARNED)
+    AI_BENCH_NUM_ENGINES
+} AIBench_Engine_t;
+
+#define AI_BENCH_ALL_ENGINES    ((1u << AI_BENCH_NUM_ENGINES) - 1u)
+
+/* Reloj libre: devuelve ticks (se permite el desborde de 32 bits) */
+typedef uint32_t (*AIBench_Clock_t)(void);
+
+/* Resultado de un motor */
+typedef struct {
+    AIBench_Engine_t engine;
+    uint32_t positions;
+    uint32_t min_ns;
+    uint32_t median_ns;
+    uint32_t p99_ns;
+    uint32_t max_ns;
+    uint32_t total_us;
+    uint32_t total_nodes;
+    uint32_t nodes_per_s;
+} AIBench_Result_t;
+
+/* Funciones públicas */
+uint16_t AIBench_CollectPositions(Bitboard_t positions[], uint16_t max_positions);
+void AIBench_RunEngine(AIBench_Engine_t engine, const Bitboard_t positions[], uint16_t count,
+                       AIBench_Clock_t clock, uint32_t ticks_per_us, AIBench_Result_t* result);
+const char* AIBench_EngineName(AIBench_Engine_t engine);
+void AIBench_PrintHeader(void);
+void AIBench_PrintResult(const AIBench_Result_t* result);
+void AIBench_RunTarget(uint32_t engine_mask);
+
+#endif /* INC_AI_BENCH_H_ */
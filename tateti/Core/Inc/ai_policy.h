@@ -0,0 +1,38 @@
+/**
+ ******************************************************************************
+ * @file    ai_policy.h
+ * @brief   Política aprendida por refuerzo (nivel AI_LEARNED)
+ ******************************************************************************
+ * @attention
+ *
+ * Para cada posición canónica de ai_table.h (mismo índice que AITable_Find)
+ * guarda una preferencia de 8 bits por celda, en la orientación canónica:
+ * 0 para las celdas ocupadas y de 1 a 255 para las libres (más alta, mejor).
+ * La jugada es la celda libre de mayor preferencia.
+ *
+ * Los datos (ai_policy_data.c) se generan en la PC con Tools/ai_rltrain.c,
+ * que entrena un Q-learning tabular jugando contra sí mismo y cuantiza los
+ * valores aprendidos. No es juego perfecto: es lo que el entrenamiento
+ * alcanzó (el generador informa cuántas posiciones juega de forma óptima).
+ *
+ ******************************************************************************
+ */
+
+#ifndef INC_AI_POLICY_H_
+#define INC_AI_POLICY_H_
+
+#include <stdint.h>
+#include <stdbool.h>
+#include "bitboard.h"
+
+/* Preferencia de las celdas ocupadas (nunca se eligen) */
+#define AI_POLICY_OCCUPIED  0u
+
+/* Datos generados (AI_PolicySize == AI_TableSize) */
+extern const uint16_t AI_PolicySize;
+extern const uint8_t AI_PolicyPrefs[][BB_NUM_CELLS];
+
+/* Funciones públicas */
+bool AIPolicy_Move(const Bitboard_t* board, uint8_t* move_out);
+
+#endif /* INC_AI_POLICY_H_ */
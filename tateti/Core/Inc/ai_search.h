@@ -0,0 +1,53 @@
+/**
+ ******************************************************************************
+ * @file    ai_search.h
+ * @brief   Búsqueda negamax con poda alfa-beta para la IA difícil
+ ******************************************************************************
+ * @attention
+ *
+ * Módulo independiente del HAL: opera solo sobre Bitboard_t, por lo que
+ * puede compilarse también en la PC para herramientas y mediciones.
+ *
+ * Puntaje desde el punto de vista del jugador que mueve:
+ * +(10 - d) si gana en la jugada d, -(10 - d) si pierde, 0 si empata
+ * (mismos valores que el Minimax original).
+ *
+ * AISearch_RankMoves() da el puntaje exacto de todas las jugadas de la raíz
+ * en un solo recorrido: el valor de cada posición se guarda en una memoria
+ * de 3^9 bytes indexada por (propias, rival), así que los subárboles que
+ * comparten las jugadas de la raíz se resuelven una sola vez y quedan
+ * resueltos para las búsquedas siguientes. Esa memoria ocupa
+ * AI_SEARCH_MEMO_SIZE bytes de RAM (~19,7 KB) y la primera llamada resuelve
+ * el árbol entero, así que es para las herramientas de la PC
+ * (Tools/ai_rltrain.c): el juego ordena las jugadas con la tabla en flash
+ * (AI_RankMoves en ai.c) y no la referencia; con las opciones por defecto
+ * de STM32CubeIDE (-fdata-sections y --gc-sections) no llega al firmware.
+ *
+ ******************************************************************************
+ */
+
+#ifndef INC_AI_SEARCH_H_
+#define INC_AI_SEARCH_H_
+
+#include <stdint.h>
+#include <stdbool.h>
+#include "bitboard.h"
+
+#define AI_SEARCH_SCORE_WIN   10
+#define AI_SEARCH_SCORE_INF   100
+#define AI_SEARCH_MEMO_SIZE   19683u    // 3^9 tableros: propias = 1, rival = 2
+
+/* Jugada de la raíz con su puntaje exacto */
+typedef struct {
+    uint8_t move;       // Posición (0-8)
+    int8_t score;       // Puntaje exacto para el jugador que mueve
+} AISearch_Move_t;
+
+/* Funciones públicas */
+uint8_t AISearch_BestMove(Bitboard_t board, bool p2_to_move, int8_t* score_out);
+int8_t AISearch_Negamax(uint16_t own, uint16_t opp, uint8_t depth, int8_t alpha, int8_t beta);
+uint8_t AISearch_RankMoves(Bitboard_t board, bool p2_to_move, AISearch_Move_t moves[BB_NUM_CELLS]);
+uint32_t AISearch_GetNodeCount(void);
+void AISearch_ResetNodeCount(void);
+
+#endif /* INC_AI_SEARCH_H_ */
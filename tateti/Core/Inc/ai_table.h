@@ -0,0 +1,64 @@
+/**
+ ******************************************************************************
+ * @file    ai_table.h
+ * @brief   Tabla precalculada de juego perfecto para la IA difícil
+ ******************************************************************************
+ * @attention
+ *
+ * Contiene todas las posiciones alcanzables en las que mueve el jugador 2,
+ * reducidas por las 8 simetrías del tablero (forma canónica de
+ * Bitboard_Canonical). Para cada una se guarda la mejor jugada en la
+ * orientación canónica (4 bits) y su valor teórico (2 bits).
+ *
+ * Índice denso, sin claves ni búsqueda:
+ * - Con turno de P2 hay k fichas, k/2 de P2 (redondeado hacia abajo) y el
+ *   resto de P1. AITable_PositionIndex() numera esos tableros del 0 al
+ *   AI_TABLE_INDEX_SIZE - 1: desplazamiento por k, rango combinatorio de
+ *   las celdas ocupadas y rango de las de P2 entre ellas.
+ * - Un bit por tablero marca las formas canónicas de la tabla, con la
+ *   cantidad acumulada al comienzo de cada palabra: el índice de la entrada
+ *   es ese acumulado más un popcount dentro de la palabra.
+ *
+ * Los datos (ai_table_data.c) se generan en la PC con Tools/ai_tablegen.c,
+ * que además verifica cada entrada contra la búsqueda de ai_search.c.
+ *
+ ******************************************************************************
+ */
+
+#ifndef INC_AI_TABLE_H_
+#define INC_AI_TABLE_H_
+
+#include <stdint.h>
+#include <stdbool.h>
+#include "bitboard.h"
+
+/* Tableros con turno de P2 y menos de 9 fichas (ver AITable_PositionIndex) */
+#define AI_TABLE_INDEX_SIZE   5920u
+#define AI_TABLE_INDEX_WORDS  ((AI_TABLE_INDEX_SIZE + 31u) / 32u)
+
+/* Empaquetado: dos jugadas por byte (nibble bajo = índice par) y cuatro
+ * valores por byte (bits 2*(índice % 4)) */
+#define AI_TABLE_MOVE_MASK    0x0Fu
+#define AI_TABLE_VALUE_MASK   0x03u
+
+/* Valor teórico de la posición para el jugador 2 */
+typedef enum {
+    AI_VALUE_LOSS = 0,
+    AI_VALUE_DRAW = 1,
+    AI_VALUE_WIN = 2
+} AI_TableValue_t;
+
+/* Datos generados (entradas en el orden de AITable_PositionIndex) */
+extern const uint16_t AI_TableSize;
+extern const uint32_t AI_TableIndexBits[AI_TABLE_INDEX_WORDS];
+extern const uint16_t AI_TableIndexRank[AI_TABLE_INDEX_WORDS];
+extern const uint8_t AI_TableMoves[];
+extern const uint8_t AI_TableValues[];
+
+/* Funciones públicas */
+uint16_t AITable_PositionIndex(const Bitboard_t* board);
+bool AITable_Find(const Bitboard_t* board, uint16_t* index_out, uint8_t* sym_out);
+bool AITable_Position(uint16_t index, Bitboard_t* board_out);
+bool AITable_Lookup(const Bitboard_t* board, uint8_t* move_out, AI_TableValue_t* value_out);
+
+#endif /* INC_AI_TABLE_H_ */
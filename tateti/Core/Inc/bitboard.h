@@ -0,0 +1,97 @@
+/**
+ ******************************************************************************
+ * @file    bitboard.h
+ * @brief   Representación del tablero de tateti con máscaras de bits
+ ******************************************************************************
+ * @attention
+ *
+ * Cada jugador se representa con una máscara de 9 bits: el bit i está en 1
+ * si el jugador ocupa la posición i del tablero (mismo orden 0-8 que
+ * game_logic). Las 8 líneas ganadoras son máscaras precalculadas, por lo que
+ * verificar una línea es un único AND y generar movimientos es recorrer los
+ * bits de la máscara de celdas vacías.
+ *
+ ******************************************************************************
+ */
+
+#ifndef INC_BITBOARD_H_
+#define INC_BITBOARD_H_
+
+#include <stdint.h>
+#include <stdbool.h>
+
+/* Defines -------------------------------------------------------------------*/
+#define BB_NUM_CELLS    9
+#define BB_NUM_LINES    8
+#define BB_FULL_MASK    0x01FFu   // Las 9 celdas ocupadas
+#define BB_NUM_SYMMETRIES 8       // Rotaciones y reflexiones del cuadrado
+
+/* Tipos de dato */
+typedef struct {
+    uint16_t p1;    // Celdas ocupadas por el jugador 1
+    uint16_t p2;    // Celdas ocupadas por el jugador 2
+} Bitboard_t;
+
+/* Máscaras de las líneas ganadoras, en el mismo orden que WinType_t - 1 */
+extern const uint16_t BB_WinMasks[BB_NUM_LINES];
+
+/* Funciones públicas */
+void Bitboard_Clear(Bitboard_t* bb);
+uint8_t Bitboard_WinLine(uint16_t mask);
+uint16_t Bitboard_Transform(uint16_t mask, uint8_t sym);
+uint16_t Bitboard_InverseTransform(uint16_t mask, uint8_t sym);
+uint32_t Bitboard_Canonical(const Bitboard_t* bb, uint8_t* sym_out);
+
+/**
+ * @brief  Máscara de celdas ocupadas por cualquiera de los jugadores
+ */
+static inline uint16_t Bitboard_Occupied(const Bitboard_t* bb)
+{
+    return (uint16_t)(bb->p1 | bb->p2);
+}
+
+/**
+ * @brief  Máscara de celdas vacías
+ */
+static inline uint16_t Bitboard_Empty(const Bitboard_t* bb)
+{
+    return (uint16_t)(~(bb->p1 | bb->p2) & BB_FULL_MASK);
+}
+
+/**
+ * @brief  Cantidad de bits en 1 de una máscara
+ */
+static inline uint8_t Bitboard_Count(uint16_t mask)
+{
+    return (uint8_t)__builtin_popcount(mask);
+}
+
+/**
+ * @brief  Extrae la posición del bit menos significativo y lo borra
+ * @param  mask: Máscara no vacía (se modifica)
+ * @retval Posición del bit extraído (0-8)
+ */
+static inline uint8_t Bitboard_PopLowest(uint16_t* mask)
+{
+    uint8_t pos = (uint8_t)__builtin_ctz(*mask);
+    *mask &= (uint16_t)(*mask - 1u);
+    return pos;
+}
+
+/**
+ * @brief  Clave única de 18 bits del tablero: (p2 << 9) | p1
+ */
+static inline uint32_t Bitboard_Key(const Bitboard_t* bb)
+{
+    return ((uint32_t)bb->p2 << BB_NUM_CELLS) | bb->p1;
+}
+
+/**
+ * @brief  Indica si la máscara contiene alguna línea completa
+ */
+static inline bool Bitboard_HasWin(uint16_t mask)
+{
+    return Bitboard_WinLine(mask) != 0;
+}
+
+#endif /* INC_BITBOARD_H_ */
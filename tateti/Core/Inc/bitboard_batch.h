@@ -0,0 +1,44 @@
+/**
+ ******************************************************************************
+ * @file    bitboard_batch.h
+ * @brief   Evaluación de victoria y empate de muchos tableros a la vez
+ ******************************************************************************
+ * @attention
+ *
+ * Para herramientas de PC y entrenamiento que revisan millones de
+ * posiciones independientes. Cada Bitboard_t ocupa 32 bits (p1 en la media
+ * palabra baja, p2 en la alta), así que un registro SIMD de 16 bits por
+ * carril tiene las dos mitades de varios tableros: cada una de las 8 líneas
+ * de BB_WinMasks, replicada en todos los carriles, se prueba con un AND y
+ * una comparación para los dos jugadores de todos los tableros juntos.
+ *
+ * - AVX2: 8 tableros por instrucción; SSE2: 4 (se elige al compilar).
+ * - Sin SIMD (la placa incluida): un tablero por palabra de 32 bits, con los
+ *   dos jugadores en la misma operación.
+ *
+ * El resultado de cada tablero es un byte: el WinType_t de
+ * Game_CheckWinBitboard() en los bits 0-3 (la primera línea en el orden de
+ * BB_WinMasks si hay varias) y BB_BATCH_DRAW si no hay línea y el tablero
+ * está lleno.
+ *
+ * Módulo independiente del HAL (se compila también en la PC).
+ *
+ ******************************************************************************
+ */
+
+#ifndef INC_BITBOARD_BATCH_H_
+#define INC_BITBOARD_BATCH_H_
+
+#include <stdint.h>
+#include "bitboard.h"
+
+/* Defines -------------------------------------------------------------------*/
+#define BB_BATCH_WIN_MASK   0x0Fu   // WinType_t
+#define BB_BATCH_DRAW       0x80u   // Sin línea y sin celdas libres
+
+/* Funciones públicas */
+void Bitboard_BatchEvaluate(const Bitboard_t boards[], uint8_t results[], uint32_t count);
+void Bitboard_BatchEvaluateScalar(const Bitboard_t boards[], uint8_t results[], uint32_t count);
+const char* Bitboard_BatchKernel(void);
+
+#endif /* INC_BITBOARD_BATCH_H_ */
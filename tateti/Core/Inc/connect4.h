@@ -0,0 +1,101 @@
+/**
+ ******************************************************************************
+ * @file    connect4.h
+ * @brief   Motor de 4 en línea (Connect Four, 7 columnas x 6 filas)
+ ******************************************************************************
+ * @attention
+ *
+ * Pensado para un panel de 8x8 (tablero de 7x6) con las columnas del
+ * teclado como teclas para soltar la ficha.
+ *
+ * - Bitboard de 49 bits con columnas de 7 bits (6 filas + 1 de relleno):
+ *   bit = columna * 7 + fila, fila 0 abajo. El bit de relleno evita que
+ *   los desplazamientos pasen de una columna a la siguiente, así que las
+ *   líneas se detectan con 4 desplazamientos (1, 6, 7 y 8) sin tablas.
+ * - Posición = fichas del jugador que mueve + todas las fichas. Soltar
+ *   una ficha es una suma (mask + bit de abajo de la columna) y la clave
+ *   current + mask identifica la posición sin Zobrist.
+ * - Negamax alfa-beta que descarta las jugadas que dejan ganar al rival,
+ *   ordena por amenazas creadas (centro primero al empatar) y usa una tabla
+ *   de transposición en un buffer estático.
+ * - Puntajes absolutos: ganar con n fichas en el tablero vale
+ *   C4_SCORE_WIN - n, así que las entradas de la tabla no dependen del ply.
+ *
+ * C4_Search() es la búsqueda con plazo para jugar (profundización
+ * iterativa y evaluación por amenazas en las hojas). C4_Solve() resuelve
+ * la posición (puntaje exacto con ventana nula) y se usa en el benchmark.
+ *
+ * Módulo independiente del HAL (se compila también en la PC). Por ahora no
+ * está conectado al statechart ni al display: hace falta el panel de 8x8.
+ *
+ ******************************************************************************
+ */
+
+#ifndef INC_CONNECT4_H_
+#define INC_CONNECT4_H_
+
+#include <stdint.h>
+#include <stdbool.h>
+
+/* Defines -------------------------------------------------------------------*/
+#define C4_WIDTH            7
+#define C4_HEIGHT           6
+#define C4_COL_BITS         (C4_HEIGHT + 1)     // Fila de relleno
+#define C4_NUM_CELLS        (C4_WIDTH * C4_HEIGHT)
+#define C4_NO_MOVE          0xFFu
+
+#define C4_SCORE_WIN        1000
+#define C4_SCORE_INF        2000
+#define C4_MAX_DEPTH        C4_NUM_CELLS
+#define C4_CHECK_NODES      1024u   // Nodos entre lecturas del reloj
+
+/* Tamaño de la tabla de transposición: 2^C4_TT_BITS entradas de 8 bytes */
+#ifndef C4_TT_BITS
+#define C4_TT_BITS          12
+#endif
+
+/* Tipos de dato */
+typedef uint64_t C4_Mask_t;
+
+/* Posición */
+typedef struct {
+    C4_Mask_t current;      // Fichas del jugador que mueve
+    C4_Mask_t mask;         // Todas las fichas
+    uint8_t moves;          // Fichas en el tablero (par: mueve P1)
+} C4_Board_t;
+
+/* Reloj libre: devuelve ticks (se permite el desborde de 32 bits) */
+typedef uint32_t (*C4_Clock_t)(void);
+
+/* Resultado de una búsqueda */
+typedef struct {
+    uint8_t best_move;      // Columna elegida (C4_NO_MOVE si no hay jugadas)
+    int16_t score;          // Puntaje para el jugador que mueve
+    uint8_t depth;          // Última profundidad completada
+    uint32_t nodes;         // Nodos visitados
+    bool timed_out;         // El plazo cortó una iteración
+} C4_Result_t;
+
+/* Funciones públicas */
+void C4_Reset(C4_Board_t* board);
+bool C4_CanPlay(const C4_Board_t* board, uint8_t col);
+void C4_Play(C4_Board_t* board, uint8_t col);
+bool C4_IsWinningMove(const C4_Board_t* board, uint8_t col);
+bool C4_HasWon(C4_Mask_t position);
+uint8_t C4_PlayString(C4_Board_t* board, const char* moves);
+int16_t C4_Evaluate(const C4_Board_t* board);
+void C4_Search(const C4_Board_t* board, uint8_t max_depth, C4_Clock_t clock, uint32_t budget,
+               C4_Result_t* result);
+bool C4_Solve(const C4_Board_t* board, C4_Clock_t clock, uint32_t budget, int8_t* score,
+              uint32_t* nodes);
+void C4_ClearTT(void);
+
+/**
+ * @brief  Clave única de la posición (49 bits)
+ */
+static inline uint64_t C4_Key(const C4_Board_t* board)
+{
+    return board->current + board->mask;
+}
+
+#endif /* INC_CONNECT4_H_ */
@@ -22,6 +22,8 @@ void Display_SetPlayer1Color(WS2812B_Color_t color);
 
 /* Getter para modo de juego (definido en main.c) */
 uint8_t GetGameMode(void);
+/* Getter para variante de juego (definido en main.c): 0=tateti, 1=ultimate */
+uint8_t GetGameVariant(void);
 void Display_SetPlayer2Color(WS2812B_Color_t color);
 void Display_UpdateBoard(CellState_t board[9]);
 void Display_ShowScores(uint8_t p1_score, uint8_t p2_score);
@@ -33,5 +35,11 @@ void Display_UpdateAll(uint8_t p1_score, uint8_t p2_score, CellState_t current_p
 void Display_ShowColorSelection(void);
 void Display_ShowGameMode(uint8_t mode);
 void Display_ShowAIDifficulty(AI_Difficulty_t difficulty);
+void Display_ShowGameVariant(uint8_t variant);
+void Display_ShowUltimateOverview(uint8_t highlight);
+void Display_Process(void);
+void Display_SetCoachMode(bool enabled);
+bool Display_GetCoachMode(void);
+void Display_ShowMoveValues(const AI_MoveValues_t* values);
 
 #endif /* INC_DISPLAY_H_ */
@@ -37,6 +37,8 @@ bool GameInput_IsBoardAction(Keyboard_Key_t key);
 bool GameInput_IsColorP1Action(Keyboard_Key_t key);
 bool GameInput_IsColorP2Action(Keyboard_Key_t key);
 bool GameInput_IsResetAction(Keyboard_Key_t key);
+bool GameInput_IsUndoAction(Keyboard_Key_t key);
+bool GameInput_IsRedoAction(Keyboard_Key_t key);
 uint8_t GameInput_KeyToPosition(Keyboard_Key_t key);
 
 #endif /* INC_GAME_INPUT_H_ */
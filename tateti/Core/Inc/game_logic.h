@@ -10,6 +10,7 @@
 
 #include <stdint.h>
 #include <stdbool.h>
+#include "bitboard.h"
 
 /* Tipos de dato */
 typedef enum {
@@ -30,7 +31,57 @@ typedef enum {
     WIN_DIAG_ANTI = 8    // Diagonal anti (posiciones 2,4,6)
 } WinType_t;
 
-/* Funciones públicas */
+/* Historial: jugadas que se pueden deshacer/rehacer (potencia de 2) */
+#define GAME_HISTORY_SIZE   16u
+
+/* Jugada del historial. Guarda lo necesario para deshacerla sin copiar el
+ * tablero: la celda, quién la ocupó, quién la ocupaba antes y el resultado
+ * previo (una sobrescritura puede haber roto una línea). */
+typedef struct {
+    uint8_t position;       // Celda (0-8)
+    uint8_t player;         // CellState_t que jugó
+    uint8_t previous;       // CellState_t que había en la celda
+    uint8_t win;            // WinType_t antes de la jugada
+} GameMove_t;
+
+/* Estado de una partida. Cada mesa/búsqueda puede tener el suyo; las
+ * funciones Game_* sin contexto operan sobre un contexto por defecto.
+ * Los contadores por línea se actualizan en GameCtx_MakeMove() con las
+ * líneas de la celda jugada, así que victoria y empate se responden sin
+ * recorrer el tablero. El historial es circular: al llenarse se pierde la
+ * jugada más vieja, y una jugada nueva descarta las que se podían rehacer. */
+typedef struct {
+    Bitboard_t board;
+    uint8_t move_count;                     // Celdas ocupadas
+    uint8_t line_count[2][BB_NUM_LINES];    // Fichas de cada jugador por línea
+    WinType_t win;                          // Resultado cacheado hasta la próxima jugada
+    GameMove_t history[GAME_HISTORY_SIZE];
+    uint8_t history_head;                   // Próxima entrada a escribir
+    uint8_t history_undo;                   // Jugadas que se pueden deshacer
+    uint8_t history_redo;                   // Jugadas deshechas que se pueden rehacer
+} GameContext_t;
+
+/* Funciones públicas con contexto explícito (reentrantes) */
+void GameCtx_Init(GameContext_t* ctx);
+void GameCtx_Reset(GameContext_t* ctx);
+bool GameCtx_IsValidMove(const GameContext_t* ctx, uint8_t position);
+void GameCtx_MakeMove(GameContext_t* ctx, uint8_t position, CellState_t player);
+WinType_t GameCtx_CheckWin(const GameContext_t* ctx);
+bool GameCtx_CheckDraw(const GameContext_t* ctx);
+CellState_t GameCtx_GetCell(const GameContext_t* ctx, uint8_t position);
+void GameCtx_GetBoard(const GameContext_t* ctx, CellState_t board[9]);
+Bitboard_t GameCtx_GetBitboard(const GameContext_t* ctx);
+bool GameCtx_UndoMove(GameContext_t* ctx, GameMove_t* move_out);
+bool GameCtx_RedoMove(GameContext_t* ctx, GameMove_t* move_out);
+bool GameCtx_CanUndo(const GameContext_t* ctx);
+bool GameCtx_CanRedo(const GameContext_t* ctx);
+
+/* Evaluación pura de un tablero (sin estado) */
+WinType_t Game_CheckWinOn(const CellState_t board[9]);
+WinType_t Game_CheckWinBitboard(const Bitboard_t* board);
+
+/* Funciones públicas sobre el contexto por defecto */
+GameContext_t* Game_GetDefaultContext(void);
 void Game_Init(void);
 void Game_Reset(void);
 bool Game_IsValidMove(uint8_t position);
@@ -39,5 +90,10 @@ WinType_t Game_CheckWin(void);
 bool Game_CheckDraw(void);
 CellState_t Game_GetCell(uint8_t position);
 void Game_GetBoard(CellState_t board[9]);
+Bitboard_t Game_GetBitboard(void);
+bool Game_UndoMove(GameMove_t* move_out);
+bool Game_RedoMove(GameMove_t* move_out);
+bool Game_CanUndo(void);
+bool Game_CanRedo(void);
 
 #endif /* INC_GAME_LOGIC_H_ */
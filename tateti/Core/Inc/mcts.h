@@ -0,0 +1,85 @@
+/**
+ ******************************************************************************
+ * @file    mcts.h
+ * @brief   Búsqueda Monte-Carlo (UCT) sobre el motor m,n,k
+ ******************************************************************************
+ * @attention
+ *
+ * Alternativa al alfa-beta para tableros grandes, donde la heurística de
+ * líneas juega mal a profundidad limitada.
+ *
+ * - Los nodos salen de un arreglo provisto por el llamador (sin malloc):
+ *   la capacidad del arreglo es el techo de memoria y MCTS_Reset() libera
+ *   todo el árbol en O(1). Si el arreglo se llena el árbol deja de crecer
+ *   pero las simulaciones siguen.
+ * - MCTS_SetRoot() reutiliza el subárbol de la posición nueva si es
+ *   descendiente de la anterior (jugada propia + respuesta del rival); los
+ *   nodos descartados vuelven a una lista libre.
+ * - Las simulaciones juegan al azar sobre las máscaras de 64 bits del
+ *   motor m,n,k, con un generador xorshift propio por árbol (reproducible).
+ *
+ * Módulo independiente del HAL (se compila también en la PC).
+ *
+ ******************************************************************************
+ */
+
+#ifndef INC_MCTS_H_
+#define INC_MCTS_H_
+
+#include <stdint.h>
+#include <stdbool.h>
+#include "mnk.h"
+
+/* Defines -------------------------------------------------------------------*/
+#define MCTS_NULL           0xFFFFu     // Índice de nodo inexistente
+#define MCTS_MAX_NODES      0xFFFEu     // Límite impuesto por los índices de 16 bits
+#define MCTS_DRAW           2u          // Resultado de MCTS_Playout sin ganador
+
+/* Constante de exploración de UCT (sqrt(2) en teoría) */
+#ifndef MCTS_UCT_C
+#define MCTS_UCT_C          1.4f
+#endif
+
+/* Nodo del árbol (24 bytes) */
+typedef struct {
+    MNK_Mask_t untried;     // Jugadas todavía no expandidas
+    uint32_t visits;
+    uint32_t score;         // Medios puntos del jugador que movió: victoria 2, empate 1
+    uint16_t parent;
+    uint16_t first_child;
+    uint16_t next_sibling;  // En la lista libre: siguiente nodo libre
+    uint8_t move;           // Celda jugada para llegar a este nodo
+    uint8_t flags;          // MCTS_FLAG_*
+} MCTS_Node_t;
+
+#define MCTS_FLAG_TERMINAL  0x01u   // La jugada terminó la partida
+#define MCTS_FLAG_WIN       0x02u   // ... y la ganó quien movió (si no, empate)
+#define MCTS_FLAG_P2        0x04u   // Movió el jugador 2
+#define MCTS_FLAG_KEEP      0x40u   // Marca temporal de MCTS_SetRoot
+#define MCTS_FLAG_FREE      0x80u   // Nodo en la lista libre
+
+/* Árbol de búsqueda */
+typedef struct {
+    const MNK_Rules_t* rules;
+    MCTS_Node_t* nodes;     // Arreglo provisto por el llamador
+    uint16_t capacity;
+    uint16_t used;          // Nodos tomados del arreglo alguna vez (asignación lineal)
+    uint16_t live;          // Nodos en uso
+    uint16_t free_list;     // Nodos liberados por MCTS_SetRoot
+    uint16_t root;
+    MNK_Board_t root_board;
+    uint32_t rng;           // Estado del xorshift32 (nunca 0)
+    uint32_t iterations;    // Iteraciones acumuladas sobre la raíz actual
+    uint16_t reused;        // Nodos conservados por el último MCTS_SetRoot (0 = árbol nuevo)
+} MCTS_Tree_t;
+
+/* Funciones públicas */
+void MCTS_Init(MCTS_Tree_t* tree, const MNK_Rules_t* rules, MCTS_Node_t* nodes, uint16_t capacity,
+               uint32_t seed);
+void MCTS_Reset(MCTS_Tree_t* tree);
+void MCTS_SetRoot(MCTS_Tree_t* tree, const MNK_Board_t* board);
+uint32_t MCTS_Run(MCTS_Tree_t* tree, uint32_t iterations);
+uint8_t MCTS_BestMove(const MCTS_Tree_t* tree);
+uint8_t MCTS_Playout(const MNK_Rules_t* rules, MNK_Board_t* board, uint32_t* rng);
+
+#endif /* INC_MCTS_H_ */
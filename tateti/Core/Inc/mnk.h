@@ -0,0 +1,157 @@
+/**
+ ******************************************************************************
+ * @file    mnk.h
+ * @brief   Motor genérico de juegos m,n,k (tablero de ancho x alto, k en línea)
+ ******************************************************************************
+ * @attention
+ *
+ * Generaliza el tateti (3,3,3) a tableros de hasta 7x7 para paneles de LEDs
+ * más grandes: 4x4 con 4 en línea, 5x5 y 7x7 con 5 en línea, etc.
+ *
+ * - Cada jugador es una máscara de 64 bits (celda = fila * ancho + columna).
+ * - Las máscaras de todas las líneas ganadoras se generan una sola vez en
+ *   MNK_Init() a partir de (ancho, alto, k) y quedan en MNK_Rules_t.
+ * - La búsqueda es alfa-beta con profundización iterativa y una tabla de
+ *   transposición en un buffer estático (claves Zobrist).
+ * - La búsqueda usa una pila explícita (MNK_Search_t), no recursión: puede
+ *   avanzarse de a pasos acotados (MNK_SearchStep) entre iteraciones del
+ *   loop principal y siempre tiene disponible la mejor jugada hasta el momento.
+ *
+ * Módulo independiente del HAL (se compila también en la PC).
+ *
+ ******************************************************************************
+ */
+
+#ifndef INC_MNK_H_
+#define INC_MNK_H_
+
+#include <stdint.h>
+#include <stdbool.h>
+
+/* Defines -------------------------------------------------------------------*/
+#define MNK_MAX_WIDTH       7
+#define MNK_MAX_HEIGHT      7
+#define MNK_MAX_CELLS       (MNK_MAX_WIDTH * MNK_MAX_HEIGHT)
+#define MNK_MAX_LINES       128     // 7x7 con k=3 genera 120 líneas
+#define MNK_MAX_CELL_LINES  28      // 4 direcciones x k (k <= 7)
+
+#define MNK_NO_MOVE         0xFFu
+#define MNK_SCORE_WIN       1000000L
+#define MNK_SCORE_INF       2000000L
+
+/* Nodos por paso de la búsqueda bloqueante */
+#define MNK_STEP_NODES      1024u
+
+/* Tamaño de la tabla de transposición: 2^MNK_TT_BITS entradas de 8 bytes
+ * (32 KB con 12 bits; verificación con los 16 bits altos de la clave) */
+#ifndef MNK_TT_BITS
+#define MNK_TT_BITS         12
+#endif
+
+/* Tipos de dato */
+typedef uint64_t MNK_Mask_t;
+
+/* Variantes predefinidas */
+typedef enum {
+    MNK_VARIANT_3X3 = 0,     // Tateti clásico (3,3,3)
+    MNK_VARIANT_4X4,         // Matriz completa de 16 LEDs (4,4,4)
+    MNK_VARIANT_5X5,         // 5x5 con 4 en línea
+    MNK_VARIANT_7X7_K5       // 7x7 con 5 en línea
+} MNK_Variant_t;
+
+/* Reglas de una variante: tablas generadas por MNK_Init() */
+typedef struct {
+    uint8_t width;
+    uint8_t height;
+    uint8_t k;
+    uint8_t num_cells;
+    uint8_t num_lines;
+    MNK_Mask_t full_mask;
+    MNK_Mask_t lines[MNK_MAX_LINES];
+    uint8_t cell_line_count[MNK_MAX_CELLS];
+    uint8_t cell_lines[MNK_MAX_CELLS][MNK_MAX_CELL_LINES];
+    uint8_t move_order[MNK_MAX_CELLS];   // Celdas de la más central a la más externa
+} MNK_Rules_t;
+
+/* Estado de una partida */
+typedef struct {
+    MNK_Mask_t cells[2];    // [0] = jugador 1, [1] = jugador 2
+    uint64_t hash;          // Clave Zobrist de la posición
+    uint8_t side;           // Jugador que mueve: 0 = P1, 1 = P2
+    uint8_t move_count;
+} MNK_Board_t;
+
+/* Resultado de una búsqueda */
+typedef struct {
+    uint8_t best_move;      // Celda elegida (MNK_NO_MOVE si no hay jugadas)
+    int32_t score;          // Puntaje para el jugador que mueve
+    uint8_t depth;          // Última profundidad completada
+    uint32_t nodes;         // Nodos visitados
+} MNK_Result_t;
+
+/* Marco de la pila explícita: un nodo en exploración */
+typedef struct {
+    uint8_t moves[MNK_MAX_CELLS];
+    uint8_t count;
+    uint8_t index;          // Próxima jugada a explorar
+    uint8_t depth;          // Profundidad restante
+    uint8_t best_move;
+    int32_t alpha;
+    int32_t alpha_orig;
+    int32_t beta;
+    int32_t best;
+} MNK_Frame_t;
+
+/* Búsqueda incremental en curso */
+typedef struct {
+    const MNK_Rules_t* rules;
+    MNK_Board_t board;                      // Copia de trabajo
+    MNK_Frame_t stack[MNK_MAX_CELLS + 1];
+    uint8_t sp;                             // Ply del nodo actual
+    uint8_t iter_depth;                     // Profundidad de la iteración en curso
+    uint8_t max_depth;
+    bool done;
+    uint32_t nodes;
+    MNK_Result_t result;                    // Mejor resultado hasta el momento
+} MNK_Search_t;
+
+/* Evaluación de las hojas del alfa-beta: puntaje para el jugador que mueve,
+ * en valor absoluto muy por debajo de MNK_SCORE_WIN (ver MNK_SetEvaluator) */
+typedef int32_t (*MNK_Evaluator_t)(const MNK_Rules_t* rules, const MNK_Board_t* board);
+
+/* Funciones públicas */
+bool MNK_Init(MNK_Rules_t* rules, uint8_t width, uint8_t height, uint8_t k);
+bool MNK_InitVariant(MNK_Rules_t* rules, MNK_Variant_t variant);
+void MNK_Reset(const MNK_Rules_t* rules, MNK_Board_t* board);
+void MNK_MakeMove(const MNK_Rules_t* rules, MNK_Board_t* board, uint8_t cell);
+void MNK_UnmakeMove(const MNK_Rules_t* rules, MNK_Board_t* board, uint8_t cell);
+bool MNK_IsWinningMove(const MNK_Rules_t* rules, MNK_Mask_t own, uint8_t cell);
+bool MNK_HasWin(const MNK_Rules_t* rules, MNK_Mask_t own);
+int32_t MNK_Evaluate(const MNK_Rules_t* rules, const MNK_Board_t* board);
+void MNK_SetEvaluator(MNK_Evaluator_t evaluator);
+void MNK_SetPosition(const MNK_Rules_t* rules, MNK_Board_t* board, MNK_Mask_t p1, MNK_Mask_t p2,
+                     uint8_t side);
+void MNK_Search(const MNK_Rules_t* rules, const MNK_Board_t* board, uint8_t max_depth,
+                uint32_t node_limit, MNK_Result_t* result);
+void MNK_SearchBegin(MNK_Search_t* s, const MNK_Rules_t* rules, const MNK_Board_t* board,
+                     uint8_t max_depth);
+bool MNK_SearchStep(MNK_Search_t* s, uint32_t max_nodes);
+void MNK_ClearTT(void);
+
+/**
+ * @brief  Máscara de celdas vacías
+ */
+static inline MNK_Mask_t MNK_Empty(const MNK_Rules_t* rules, const MNK_Board_t* board)
+{
+    return ~(board->cells[0] | board->cells[1]) & rules->full_mask;
+}
+
+/**
+ * @brief  Convierte fila/columna en índice de celda
+ */
+static inline uint8_t MNK_Cell(const MNK_Rules_t* rules, uint8_t row, uint8_t col)
+{
+    return (uint8_t)(row * rules->width + col);
+}
+
+#endif /* INC_MNK_H_ */
@@ -0,0 +1,72 @@
+/**
+ ******************************************************************************
+ * @file    nn_bench.h
+ * @brief   Benchmark de la red de evaluación: exactitud y latencia por posición
+ ******************************************************************************
+ * @attention
+ *
+ * 1. Exactitud: los núcleos escalar y SIMD de nn_eval.c tienen que dar el
+ *    mismo resultado bit a bit, tanto en productos internos de vectores al
+ *    azar (con los extremos -128 y 127) como en la red completa sobre
+ *    posiciones de la variante del modelo.
+ * 2. Latencia: mínimo, mediana, percentil 99 y máximo de una evaluación de
+ *    hoja con la heurística de líneas (MNK_Evaluate) y con la red en cada
+ *    núcleo (NN_Encode + NN_Forward), en formato CSV.
+ *
+ * Las posiciones salen de partidas al azar (sin ganador) con semilla fija.
+ * El reloj lo provee el llamador, igual que en ai_bench.h: en la placa el
+ * contador de ciclos DWT (NNBench_RunTarget, compilar con
+ * -DNN_BENCH_ON_TARGET y leer el CSV por USART3), en la PC clock_gettime
+ * (Tools/nn_bench.c). En la PC el núcleo SIMD es la emulación en C: solo en
+ * la placa su latencia dice algo.
+ *
+ ******************************************************************************
+ */
+
+#ifndef INC_NN_BENCH_H_
+#define INC_NN_BENCH_H_
+
+#include <stdint.h>
+#include <stdbool.h>
+#include "mnk.h"
+
+/* Defines -------------------------------------------------------------------*/
+#define NN_BENCH_MAX_POSITIONS  1024u
+#define NN_BENCH_SEED           12345u
+#define NN_BENCH_DOT_VECTORS    4096u   // Pares de vectores al azar de la prueba de exactitud
+
+/* Evaluaciones medidas */
+typedef enum {
+    NN_BENCH_LINES = 0,     // MNK_Evaluate
+    NN_BENCH_NN_SCALAR,     // Red con NN_KERNEL_SCALAR
+    NN_BENCH_NN_SIMD,       // Red con NN_KERNEL_SIMD
+    NN_BENCH_NUM_EVALS
+} NNBench_Eval_t;
+
+/* Reloj libre: devuelve ticks (se permite el desborde de 32 bits) */
+typedef uint32_t (*NNBench_Clock_t)(void);
+
+/* Resultado de una evaluación */
+typedef struct {
+    NNBench_Eval_t eval;
+    uint32_t positions;
+    uint32_t min_ns;
+    uint32_t median_ns;
+    uint32_t p99_ns;
+    uint32_t max_ns;
+} NNBench_Result_t;
+
+/* Funciones públicas */
+uint16_t NNBench_CollectPositions(const MNK_Rules_t* rules, MNK_Board_t positions[],
+                                  uint16_t count, uint32_t seed);
+uint32_t NNBench_CheckKernels(const MNK_Rules_t* rules, const MNK_Board_t positions[],
+                              uint16_t count, uint32_t seed);
+void NNBench_RunEval(NNBench_Eval_t eval, const MNK_Rules_t* rules, const MNK_Board_t positions[],
+                     uint16_t count, NNBench_Clock_t clock, uint32_t ticks_per_us,
+                     NNBench_Result_t* result);
+const char* NNBench_EvalName(NNBench_Eval_t eval);
+void NNBench_PrintHeader(void);
+void NNBench_PrintResult(const NNBench_Result_t* result);
+void NNBench_RunTarget(void);
+
+#endif /* INC_NN_BENCH_H_ */
@@ -0,0 +1,91 @@
+/**
+ ******************************************************************************
+ * @file    nn_eval.h
+ * @brief   Red neuronal int8 de evaluación para el motor m,n,k
+ ******************************************************************************
+ * @attention
+ *
+ * Perceptrón de una capa oculta que estima el valor de una posición para el
+ * jugador que mueve. Sirve como evaluación de las hojas del alfa-beta de
+ * mnk.c (MNK_SetEvaluator) en las variantes grandes, donde la heurística de
+ * líneas juega mal a profundidad limitada.
+ *
+ * - Entrada: una celda por byte, primero las fichas propias y después las
+ *   del rival (1 = ocupada), con ceros hasta input_stride (múltiplo de 4).
+ * - Capa oculta: pesos int8, sesgo int32, ReLU y recuantización a int8 con
+ *   un desplazamiento (h = min(127, max(0, acc) >> shift)).
+ * - Salida: producto int8 x int8 acumulado en int32 y llevado a puntaje con
+ *   un multiplicador en Q16: NN_SCORE_ONE equivale a ganar seguro.
+ *
+ * Los productos internos tienen dos núcleos que dan exactamente lo mismo:
+ * uno escalar en C portable y otro con las instrucciones DSP del Cortex-M4
+ * (__SXTB16 separa dos bytes con signo en medias palabras y __SMLAD
+ * multiplica y acumula las dos de una vez: 4 productos por palabra leída).
+ * En la PC las instrucciones se emulan en C, así que Tools/nn_bench.c puede
+ * comparar ambos núcleos en cualquier máquina.
+ *
+ * Los pesos (nn_model_data.c, en flash) se generan en la PC con
+ * Tools/nn_train.c para una variante; con otra variante NN_Evaluate usa
+ * MNK_Evaluate.
+ *
+ * Módulo independiente del HAL (se compila también en la PC).
+ *
+ ******************************************************************************
+ */
+
+#ifndef INC_NN_EVAL_H_
+#define INC_NN_EVAL_H_
+
+#include <stdint.h>
+#include <stdbool.h>
+#include "mnk.h"
+
+/* Defines -------------------------------------------------------------------*/
+#define NN_MAX_INPUTS       ((2 * MNK_MAX_CELLS + 3) & ~3)   // Múltiplo de 4
+#define NN_MAX_HIDDEN       64u
+#define NN_SCORE_ONE        10000L      // Puntaje de una posición ganada
+
+/* Núcleo de NN_Evaluate: SIMD si el compilador genera las instrucciones DSP
+ * (Cortex-M4/M7), escalar si no (ahí el SIMD sería la emulación, más lenta) */
+#ifndef NN_USE_SIMD
+#if defined(__ARM_FEATURE_DSP) && (__ARM_FEATURE_DSP == 1)
+#define NN_USE_SIMD         1
+#else
+#define NN_USE_SIMD         0
+#endif
+#endif
+
+/* Núcleos disponibles */
+typedef enum {
+    NN_KERNEL_SCALAR = 0,
+    NN_KERNEL_SIMD
+} NN_Kernel_t;
+
+/* Modelo cuantizado (todo en flash) */
+typedef struct {
+    uint8_t width;              // Variante para la que se entrenó
+    uint8_t height;
+    uint8_t k;
+    uint8_t hidden;             // Neuronas de la capa oculta (múltiplo de 4)
+    uint16_t input_stride;      // Entradas por neurona (múltiplo de 4, con relleno)
+    uint8_t hidden_shift;       // Recuantización de la capa oculta
+    const int8_t* w1;           // [hidden][input_stride]
+    const int32_t* b1;          // [hidden]
+    const int8_t* w2;           // [hidden]
+    int32_t b2;
+    int32_t out_mul;            // Salida -> puntaje, en Q16
+} NN_Model_t;
+
+/* Modelo generado (nn_model_data.c) */
+extern const NN_Model_t NN_Model;
+
+/* Funciones públicas */
+int32_t NN_DotScalar(const int8_t* a, const int8_t* b, uint16_t n);
+int32_t NN_DotSimd(const int8_t* a, const int8_t* b, uint16_t n);
+bool NN_Matches(const NN_Model_t* model, const MNK_Rules_t* rules);
+void NN_Encode(const NN_Model_t* model, const MNK_Rules_t* rules, const MNK_Board_t* board,
+               int8_t input[NN_MAX_INPUTS]);
+int32_t NN_Forward(const NN_Model_t* model, const int8_t* input, NN_Kernel_t kernel);
+int32_t NN_Evaluate(const MNK_Rules_t* rules, const MNK_Board_t* board);
+
+#endif /* INC_NN_EVAL_H_ */
@@ -0,0 +1,138 @@
+/**
+ ******************************************************************************
+ * @file    qubic.h
+ * @brief   Motor de Qubic (tateti 4x4x4, 4 en línea)
+ ******************************************************************************
+ * @attention
+ *
+ * El cubo son cuatro capas de 4x4, una por matriz de 16 LEDs.
+ *
+ * - Cada jugador es una máscara de 64 bits: celda = capa * 16 + fila * 4 +
+ *   columna. Las 76 líneas ganadoras son constantes en flash
+ *   (QB_WinMasks), igual que las líneas que pasan por cada celda
+ *   (QB_CellLines), así que no hay inicialización.
+ * - Las verificaciones de líneas no usan popcount: una línea sin fichas
+ *   del rival es una amenaza si (línea & ~propias) tiene un único bit.
+ *   Después de una jugada solo se revisan las 4 o 7 líneas de esa celda.
+ * - La IA primero busca en el espacio de amenazas (threat-space search):
+ *   secuencias de jugadas que dejan 3 en línea, cada una con una única
+ *   respuesta posible del rival, hasta armar una amenaza doble. Si no
+ *   encuentra victoria forzada usa alfa-beta con profundización iterativa,
+ *   en la que las respuestas a una amenaza se limitan al bloqueo.
+ * - Latencia acotada: la búsqueda de amenazas tiene un límite de nodos y
+ *   el alfa-beta un plazo medido con un reloj provisto por el llamador;
+ *   al vencer se juega la mejor jugada de la última profundidad completa.
+ *
+ * Módulo independiente del HAL y sin estado global (se compila también en
+ * la PC). Por ahora no está conectado al statechart ni al display: hacen
+ * falta las cuatro matrices de 16 LEDs y una forma de elegir la capa.
+ *
+ ******************************************************************************
+ */
+
+#ifndef INC_QUBIC_H_
+#define INC_QUBIC_H_
+
+#include <stdint.h>
+#include <stdbool.h>
+
+/* Defines -------------------------------------------------------------------*/
+#define QB_SIZE             4
+#define QB_NUM_CELLS        64
+#define QB_NUM_LINES        76
+#define QB_MAX_CELL_LINES   7       // Esquinas y las 8 celdas centrales
+#define QB_NO_MOVE          0xFFu
+#define QB_NO_LINE          0xFFu
+
+#define QB_SCORE_WIN        1000000L
+#define QB_SCORE_INF        2000000L
+#define QB_MAX_DEPTH        24u     // Profundidad máxima del alfa-beta
+#define QB_CHECK_NODES      256u    // Nodos entre lecturas del reloj
+
+/* Búsqueda de amenazas: jugadas del atacante encadenadas y nodos por jugada */
+#ifndef QB_TSS_MAX_DEPTH
+#define QB_TSS_MAX_DEPTH    16u
+#endif
+#ifndef QB_TSS_NODE_LIMIT
+#define QB_TSS_NODE_LIMIT   20000u
+#endif
+
+/* Tipos de dato */
+typedef uint64_t QB_Mask_t;
+
+/* Estado de la partida */
+typedef enum {
+    QB_RESULT_NONE = 0,
+    QB_RESULT_P1,
+    QB_RESULT_P2,
+    QB_RESULT_DRAW
+} QB_Outcome_t;
+
+/* Tablero */
+typedef struct {
+    QB_Mask_t cells[2];     // [0] = jugador 1, [1] = jugador 2
+    uint8_t side;           // Jugador que mueve: 0 = P1, 1 = P2
+    uint8_t move_count;
+    uint8_t result;         // QB_Outcome_t
+} QB_Board_t;
+
+/* Reloj libre: devuelve ticks (se permite el desborde de 32 bits) */
+typedef uint32_t (*QB_Clock_t)(void);
+
+/* Resultado de una búsqueda */
+typedef struct {
+    uint8_t best_move;      // Celda elegida (QB_NO_MOVE si no hay jugadas)
+    int32_t score;          // Puntaje para el jugador que mueve
+    uint8_t depth;          // Profundidad completada (0 si decidió sin alfa-beta)
+    uint32_t nodes;         // Nodos de alfa-beta + búsqueda de amenazas
+    bool forced_win;        // La jugada sale de una victoria forzada por amenazas
+    bool timed_out;         // El plazo cortó una iteración
+} QB_SearchResult_t;
+
+/* Tablas constantes */
+extern const QB_Mask_t QB_WinMasks[QB_NUM_LINES];
+extern const uint8_t QB_CellLineCount[QB_NUM_CELLS];
+extern const uint8_t QB_CellLines[QB_NUM_CELLS][QB_MAX_CELL_LINES];
+
+/* Funciones públicas */
+void QB_Reset(QB_Board_t* board);
+bool QB_IsLegal(const QB_Board_t* board, uint8_t cell);
+void QB_MakeMove(QB_Board_t* board, uint8_t cell);
+void QB_UnmakeMove(QB_Board_t* board, uint8_t cell);
+bool QB_IsWinningMove(QB_Mask_t own, uint8_t cell);
+QB_Mask_t QB_ThreatCells(QB_Mask_t own, QB_Mask_t opp);
+int32_t QB_Evaluate(const QB_Board_t* board);
+bool QB_ThreatSearch(QB_Mask_t own, QB_Mask_t opp, uint8_t max_depth, uint32_t node_limit,
+                     uint8_t* move_out, uint32_t* nodes_out);
+void QB_Search(const QB_Board_t* board, uint8_t max_depth, QB_Clock_t clock, uint32_t budget,
+               QB_SearchResult_t* result);
+
+/**
+ * @brief  Máscara de celdas vacías
+ */
+static inline QB_Mask_t QB_Empty(const QB_Board_t* board)
+{
+    return ~(board->cells[0] | board->cells[1]);
+}
+
+/**
+ * @brief  Extrae la posición del bit menos significativo y lo borra
+ * @param  mask: Máscara no vacía (se modifica)
+ * @retval Posición del bit extraído (0-63)
+ */
+static inline uint8_t QB_PopLowest(QB_Mask_t* mask)
+{
+    uint8_t pos = (uint8_t)__builtin_ctzll(*mask);
+    *mask &= *mask - 1u;
+    return pos;
+}
+
+/**
+ * @brief  Convierte capa/fila/columna en índice de celda
+ */
+static inline uint8_t QB_Cell(uint8_t layer, uint8_t row, uint8_t col)
+{
+    return (uint8_t)(layer * 16u + row * 4u + col);
+}
+
+#endif /* INC_QUBIC_H_ */
@@ -32,6 +32,12 @@ This state machine makes use of operations declared in the state machines interf
 - tateti_is_color_p2_key
 - tateti_is_reset_key
 - tateti_key_to_position
+- tateti_is_undo_key
+- tateti_is_redo_key
+- tateti_can_undo
+- tateti_can_redo
+- tateti_undo_move
+- tateti_redo_move
 are defined.
 
 These functions will be called during a 'run to completion step' (runCycle) of the statechart. 
@@ -55,6 +61,12 @@ extern sc_boolean tateti_is_color_p1_key( Tateti* handle, const sc_integer key);
 extern sc_boolean tateti_is_color_p2_key( Tateti* handle, const sc_integer key);
 extern sc_boolean tateti_is_reset_key( Tateti* handle, const sc_integer key);
 extern sc_integer tateti_key_to_position( Tateti* handle, const sc_integer key);
+extern sc_boolean tateti_is_undo_key( Tateti* handle, const sc_integer key);
+extern sc_boolean tateti_is_redo_key( Tateti* handle, const sc_integer key);
+extern sc_boolean tateti_can_undo( Tateti* handle);
+extern sc_boolean tateti_can_redo( Tateti* handle);
+extern sc_integer tateti_undo_move( Tateti* handle);
+extern sc_integer tateti_redo_move( Tateti* handle);
 
 
 
@@ -0,0 +1,110 @@
+/**
+ ******************************************************************************
+ * @file    ultimate.h
+ * @brief   Ultimate tateti: nueve tableros 3x3 dentro de un tablero 3x3
+ ******************************************************************************
+ * @attention
+ *
+ * Reglas: la celda jugada dentro de un sub-tablero indica en qué
+ * sub-tablero debe mover el rival. Si ese sub-tablero ya terminó (ganado o
+ * lleno) el rival elige cualquiera abierto. Gana quien completa una línea
+ * de sub-tableros ganados; si se cierran los nueve sin línea es empate.
+ *
+ * - Cada sub-tablero de cada jugador es una máscara de 9 bits con el mismo
+ *   orden de celdas que Bitboard_t; las líneas se verifican con BB_WinMasks.
+ * - won[] y closed guardan qué sub-tableros ya terminaron, así que ni la
+ *   generación de jugadas ni la detección de victoria recorren celdas.
+ * - UT_MakeMove() solo revisa las líneas que pasan por la celda jugada y
+ *   devuelve en UT_Undo_t lo necesario para deshacerla (UT_UnmakeMove).
+ * - Jugada = sub-tablero * 9 + celda (0-80).
+ *
+ * Las funciones UT_* son independientes del HAL; las Ultimate_* operan
+ * sobre una partida por defecto y las usa el statechart (tateti_glue.c).
+ *
+ ******************************************************************************
+ */
+
+#ifndef INC_ULTIMATE_H_
+#define INC_ULTIMATE_H_
+
+#include <stdint.h>
+#include <stdbool.h>
+#include "bitboard.h"
+#include "game_logic.h"
+
+/* Defines -------------------------------------------------------------------*/
+#define UT_NUM_BOARDS   9
+#define UT_NUM_CELLS    (UT_NUM_BOARDS * BB_NUM_CELLS)
+#define UT_ANY_BOARD    0xFFu       // El jugador elige el sub-tablero
+#define UT_NO_MOVE      0xFFu
+
+/* Estado de la partida */
+typedef enum {
+    UT_RESULT_NONE = 0,
+    UT_RESULT_P1,
+    UT_RESULT_P2,
+    UT_RESULT_DRAW
+} UT_Result_t;
+
+/* Tablero completo */
+typedef struct {
+    uint16_t cells[2][UT_NUM_BOARDS];   // [jugador][sub-tablero]: celdas ocupadas
+    uint16_t won[2];                    // Sub-tableros ganados por cada jugador
+    uint16_t closed;                    // Sub-tableros terminados (ganados o llenos)
+    uint8_t next_board;                 // Sub-tablero obligado o UT_ANY_BOARD
+    uint8_t side;                       // Jugador que mueve: 0 = P1, 1 = P2
+    uint8_t move_count;
+    uint8_t result;                     // UT_Result_t
+} UT_Board_t;
+
+/* Datos para deshacer una jugada */
+typedef struct {
+    uint8_t move;
+    uint8_t next_board;
+    uint8_t result;
+    uint16_t closed;
+    uint16_t won;           // won[] del jugador que movió
+} UT_Undo_t;
+
+/* Funciones públicas (tablero explícito) */
+void UT_Reset(UT_Board_t* board);
+bool UT_IsLegal(const UT_Board_t* board, uint8_t move);
+uint8_t UT_GenerateMoves(const UT_Board_t* board, uint8_t moves[UT_NUM_CELLS]);
+void UT_MakeMove(UT_Board_t* board, uint8_t move, UT_Undo_t* undo);
+void UT_UnmakeMove(UT_Board_t* board, const UT_Undo_t* undo);
+uint64_t UT_Perft(UT_Board_t* board, uint8_t depth);
+
+/* Funciones públicas sobre la partida por defecto (statechart) */
+void Ultimate_Reset(void);
+void Ultimate_SetSide(CellState_t player);
+const UT_Board_t* Ultimate_GetBoard(void);
+bool Ultimate_SelectBoard(uint8_t sub_board);
+uint8_t Ultimate_GetActiveBoard(void);
+bool Ultimate_IsValidMove(uint8_t position, CellState_t player);
+void Ultimate_MakeMove(uint8_t position, CellState_t player);
+WinType_t Ultimate_CheckWin(void);
+bool Ultimate_CheckDraw(void);
+
+/**
+ * @brief  Celdas vacías de un sub-tablero
+ */
+static inline uint16_t UT_EmptyCells(const UT_Board_t* board, uint8_t sub_board)
+{
+    return (uint16_t)(~(board->cells[0][sub_board] | board->cells[1][sub_board]) & BB_FULL_MASK);
+}
+
+/**
+ * @brief  Sub-tableros donde se puede jugar ahora
+ */
+static inline uint16_t UT_PlayableBoards(const UT_Board_t* board)
+{
+    if (board->result != UT_RESULT_NONE) {
+        return 0;
+    }
+    if (board->next_board != UT_ANY_BOARD) {
+        return (uint16_t)(1u << board->next_board);
+    }
+    return (uint16_t)(~board->closed & BB_FULL_MASK);
+}
+
+#endif /* INC_ULTIMATE_H_ */
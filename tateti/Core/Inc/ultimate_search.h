@@ -0,0 +1,90 @@
+/**
+ ******************************************************************************
+ * @file    ultimate_search.h
+ * @brief   Búsqueda alfa-beta con plazo para el ultimate tateti
+ ******************************************************************************
+ * @attention
+ *
+ * Negamax con poda alfa-beta y profundización iterativa sobre UT_Board_t,
+ * haciendo y deshaciendo jugadas sobre una única copia del tablero.
+ *
+ * - La búsqueda usa una pila explícita (UTSearch_t), no recursión: puede
+ *   avanzarse de a pocos nodos con UTSearch_Step() desde el loop principal
+ *   (como MNK_SearchStep) y cortarse en cualquier momento quedándose con la
+ *   jugada de la última profundidad completa.
+ * - UTSearch_BestMove() es la versión bloqueante para las herramientas de
+ *   la PC: el plazo se mide con un reloj provisto por el llamador y se
+ *   consulta cada UT_SEARCH_CHECK_NODES nodos. La profundidad 1 siempre se
+ *   completa.
+ * - Orden de jugadas: la mejor de la iteración anterior, jugadas que ganan
+ *   o bloquean un sub-tablero, la jugada asesina (killer) del ply y al
+ *   final las que le dan jugada libre al rival.
+ * - Evaluación: líneas abiertas del tablero grande (sub-tableros ganados)
+ *   y de cada sub-tablero, ponderadas por la posición del sub-tablero.
+ *
+ * Módulo independiente del HAL. UTSearch_Begin/UTSearch_Step trabajan sobre
+ * el estado del llamador; UTSearch_BestMove usa uno estático.
+ *
+ ******************************************************************************
+ */
+
+#ifndef INC_ULTIMATE_SEARCH_H_
+#define INC_ULTIMATE_SEARCH_H_
+
+#include <stdint.h>
+#include <stdbool.h>
+#include "ultimate.h"
+
+/* Defines -------------------------------------------------------------------*/
+#define UT_SEARCH_SCORE_WIN     100000L
+#define UT_SEARCH_SCORE_INF     1000000L
+#define UT_SEARCH_MAX_DEPTH     32u
+#define UT_SEARCH_CHECK_NODES   512u    // Nodos entre lecturas del reloj
+
+/* Reloj libre: devuelve ticks (se permite el desborde de 32 bits) */
+typedef uint32_t (*UTSearch_Clock_t)(void);
+
+/* Resultado de una búsqueda */
+typedef struct {
+    uint8_t best_move;      // Sub-tablero * 9 + celda (UT_NO_MOVE si no hay jugadas)
+    int32_t score;          // Puntaje para el jugador que mueve
+    uint8_t depth;          // Última profundidad completada
+    uint32_t nodes;         // Nodos visitados (incluida la iteración cortada)
+    bool timed_out;         // true si el plazo cortó una iteración
+} UTSearch_Result_t;
+
+/* Marco de la pila explícita: un nodo en exploración */
+typedef struct {
+    uint8_t moves[UT_NUM_CELLS];
+    uint8_t count;
+    uint8_t index;          // Próxima jugada a explorar
+    uint8_t depth;          // Profundidad restante
+    uint8_t best_move;
+    int32_t alpha;
+    int32_t beta;
+    int32_t best;
+    UT_Undo_t undo;         // Para deshacer moves[index - 1]
+} UTSearch_Frame_t;
+
+/* Búsqueda incremental en curso */
+typedef struct {
+    UT_Board_t board;                       // Copia de trabajo
+    UTSearch_Frame_t stack[UT_SEARCH_MAX_DEPTH + 1u];
+    uint8_t sp;                             // Ply del nodo actual
+    uint8_t iter_depth;                     // Profundidad de la iteración en curso
+    uint8_t max_depth;
+    uint8_t pv_move;                        // Mejor jugada de la iteración anterior
+    uint8_t killers[UT_SEARCH_MAX_DEPTH + 1u];
+    bool done;
+    uint32_t nodes;
+    UTSearch_Result_t result;               // Mejor resultado hasta el momento
+} UTSearch_t;
+
+/* Funciones públicas */
+void UTSearch_Begin(UTSearch_t* s, const UT_Board_t* board, uint8_t max_depth);
+bool UTSearch_Step(UTSearch_t* s, uint32_t max_nodes);
+void UTSearch_BestMove(const UT_Board_t* board, uint8_t max_depth, UTSearch_Clock_t clock,
+                       uint32_t budget, UTSearch_Result_t* result);
+int32_t UTSearch_Evaluate(const UT_Board_t* board);
+
+#endif /* INC_ULTIMATE_SEARCH_H_ */
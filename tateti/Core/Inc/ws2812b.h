@@ -24,22 +24,47 @@ extern "C" {
 /* Includes ------------------------------------------------------------------*/
 #include "main.h"
 #include <stdint.h>
+#include <stdbool.h>
+#include "ws2812b_encode.h"
 
 /* Defines -------------------------------------------------------------------*/
 #define WS2812B_NUM_LEDS    16
 
-/* Valores PWM para bits '0' y '1' (PROBADOS Y FUNCIONANDO)
- * Para TIM4 @ 84MHz, Period=104:
- * PWM_1 = 67 (~64% duty cycle) para bit '1'
- * PWM_0 = 34 (~32% duty cycle) para bit '0'
+/* Valores PWM para bits '0' y '1': WS2812B_PWM_BIT1/BIT0 en ws2812b_encode.h */
+
+/* Modo de envío:
+ * 0 = trama completa en doble buffer: 2 x (1 + 24*N + 41) medias palabras
+ * 1 = streaming: anillo circular de 2 x WS2812B_RING_HALF_LEDS LEDs que se
+ *     recodifica en las interrupciones de medio y fin de DMA; la RAM del
+ *     PWM no depende de WS2812B_NUM_LEDS. Cada mitad tiene
+ *     24 x WS2812B_RING_HALF_LEDS x 1.25 us (5040 ciclos a 168 MHz por LED)
+ *     para recodificarse antes de que el DMA vuelva a ella.
+ */
+#ifndef WS2812B_STREAMING
+#define WS2812B_STREAMING        0
+#endif
+#ifndef WS2812B_RING_HALF_LEDS
+#define WS2812B_RING_HALF_LEDS   1
+#endif
+
+/* Pipeline de color (ws2812b_color.h): los colores de WS2812B_SetPixel son
+ * perceptuales y pasan por gamma, brillo global y balance de blancos.
+ * Con el brillo por defecto, 255 sale como ~80/255 en el PWM: los colores
+ * de display.c y color_manager.c se ven igual que antes de la corrección.
+ * WS2812B_DITHER = 1 activa el dithering temporal: cada WS2812B_Update
+ * recalcula todos los LEDs, y main.c refresca cada WS2812B_DITHER_PERIOD_MS.
  */
-#define WS2812B_PWM_BIT1     67
-#define WS2812B_PWM_BIT0     34
+#define WS2812B_DEFAULT_BRIGHTNESS  151
+#ifndef WS2812B_DITHER
+#define WS2812B_DITHER              0
+#endif
+#define WS2812B_DITHER_PERIOD_MS    5
 
 /* Timer configuration - ajustar según tu pin */
 extern TIM_HandleTypeDef htim4;
 #define WS2812B_TIMER        htim4
 #define WS2812B_CHANNEL      TIM_CHANNEL_1  // Ajustar según configuración CubeMX
+#define WS2812B_DMA_ID       TIM_DMA_ID_CC1 // DMA del canal (modo streaming)
 
 /* Structures ----------------------------------------------------------------*/
 typedef struct {
@@ -48,6 +73,19 @@ typedef struct {
     uint8_t b;
 } WS2812B_Color_t;
 
+/* Contadores de tramas (ver WS2812B_Update) */
+typedef struct {
+    uint32_t completed;         // Tramas enviadas completas
+    uint32_t coalesced;         // Tramas pendientes reemplazadas por una más nueva antes de salir
+    uint32_t dropped;           // Tramas que el HAL no pudo arrancar
+    uint32_t skipped;           // Llamadas a WS2812B_Update sin LEDs cambiados (sin DMA)
+    uint32_t leds_sent;         // LEDs enviados en total (las tramas llegan hasta el último cambiado)
+    /* Solo modo streaming */
+    uint32_t underruns;         // Recargas que terminaron con el DMA ya en esa mitad
+    uint32_t isr_cycles_max;    // Peor recarga, en ciclos por LED (DWT)
+    uint32_t isr_cycles_avg;    // Promedio de las recargas, en ciclos por LED
+} WS2812B_Stats_t;
+
 /* Function prototypes -------------------------------------------------------*/
 
 /**
@@ -62,25 +100,77 @@ typedef struct {
  * @param g: Componente verde (0-255)
  * @param b: Componente azul (0-255)
  */
-void WS2812B_SetPixel(uint8_t led, uint8_t r, uint8_t g, uint8_t b);
+void WS2812B_SetPixel(uint16_t led, uint8_t r, uint8_t g, uint8_t b);
 
 /**
  * @brief Establece el color usando estructura
  * @param led: Número de LED (0 a 15)
  * @param color: Estructura con valores RGB
  */
-void WS2812B_SetPixelColor(uint8_t led, WS2812B_Color_t color);
+void WS2812B_SetPixelColor(uint16_t led, WS2812B_Color_t color);
 
 /**
  * @brief Apaga todos los LEDs
  */
 void WS2812B_Clear(void);
 
+/**
+ * @brief Establece el brillo global (perceptual, 255 = sin atenuar)
+ * @param value: Brillo (por defecto WS2812B_DEFAULT_BRIGHTNESS)
+ */
+void WS2812B_SetBrightness(uint8_t value);
+
+/**
+ * @brief Devuelve el brillo global
+ */
+uint8_t WS2812B_GetBrightness(void);
+
+/**
+ * @brief Establece el balance de blancos
+ * @param r: Ganancia lineal del rojo (255 = sin corregir)
+ * @param g: Ganancia lineal del verde
+ * @param b: Ganancia lineal del azul
+ */
+void WS2812B_SetWhiteBalance(uint8_t r, uint8_t g, uint8_t b);
+
 /**
  * @brief Actualiza la matriz de LEDs enviando los datos por DMA
+ * @note  Doble buffer, no bloquea: si hay una trama saliendo, esta queda
+ *        pendiente y se envía al terminar aquella (gana la última). Solo
+ *        envía hasta el último LED que cambió; sin cambios no usa el DMA
  */
 void WS2812B_Update(void);
 
+/**
+ * @brief Indica si hay una trama saliendo o esperando al DMA
+ * @retval true mientras el DMA esté ocupado o haya una trama pendiente
+ */
+bool WS2812B_IsBusy(void);
+
+/**
+ * @brief Copia los contadores de tramas completas, combinadas y perdidas
+ * @param stats: Destino
+ */
+void WS2812B_GetStats(WS2812B_Stats_t* stats);
+
+/**
+ * @brief Pone a cero los contadores de tramas
+ */
+void WS2812B_ResetStats(void);
+
+/**
+ * @brief Medio buffer enviado por DMA (modo streaming: recarga la primera mitad)
+ * @note  Llamar desde HAL_TIM_PWM_PulseFinishedHalfCpltCallback para WS2812B_TIMER
+ */
+void WS2812B_HalfTransfer(void);
+
+/**
+ * @brief Fin de la transferencia DMA: arranca la trama pendiente
+ *        (modo streaming: recarga la segunda mitad del anillo)
+ * @note  Llamar desde HAL_TIM_PWM_PulseFinishedCallback para WS2812B_TIMER
+ */
+void WS2812B_TransferComplete(void);
+
 #ifdef __cplusplus
 }
 #endif
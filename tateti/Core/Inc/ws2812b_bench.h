@@ -0,0 +1,102 @@
+/**
+ ******************************************************************************
+ * @file    ws2812b_bench.h
+ * @brief   Benchmark de los codificadores de ws2812b_encode.c
+ ******************************************************************************
+ * @attention
+ *
+ * 1. Exactitud: WS2812B_EncodeLut y WS2812B_EncodeLutDirty tienen que dar
+ *    exactamente las mismas medias palabras que WS2812B_EncodeBranchy.
+ * 2. Costo de codificar una trama de 16, 256 y 1024 LEDs (CSV):
+ *    - branchy: la trama entera con un salto por bit (forma original)
+ *    - lut: la trama entera con la tabla de nibbles
+ *    - lut_dirty: con la tabla, solo los LEDs que cambiaron (uno de cada
+ *      WS2812B_BENCH_DIRTY_DIVISOR por trama, como en las animaciones)
+ *    Se toma el mínimo de varias tramas; ticks_per_led divide por el largo
+ *    de la tira, no por los LEDs codificados.
+ * 3. Pipeline de color (ws2812b_color.h) contra Gamma_correccion() de
+ *    test_matriz_leds (float y pow() por canal): error del redondeo y del
+ *    promedio de 256 tramas con dithering respecto de la curva exacta, en
+ *    1/256 de paso, y costo por trama de toda la tira:
+ *    - float_pow: Gamma_correccion() en cada canal
+ *    - int_lut: tabla gamma y escala en enteros, redondeado
+ *    - int_dither: lo mismo con dithering temporal
+ *
+ * El reloj lo provee el llamador, igual que en nn_bench.h: en la placa el
+ * contador de ciclos DWT (WS2812BBench_RunTarget, compilar con
+ * -DWS2812B_BENCH_ON_TARGET y leer el CSV por USART3; ticks = ciclos), en
+ * la PC clock_gettime (Tools/ws2812b_bench.c; ticks = ns).
+ *
+ ******************************************************************************
+ */
+
+#ifndef INC_WS2812B_BENCH_H_
+#define INC_WS2812B_BENCH_H_
+
+#include <stdint.h>
+
+/* Defines -------------------------------------------------------------------*/
+#define WS2812B_BENCH_MAX_LEDS          1024u
+#define WS2812B_BENCH_SEED              12345u
+#define WS2812B_BENCH_DIRTY_DIVISOR     16u     // lut_dirty: LEDs / 16 cambian por trama
+#define WS2812B_BENCH_NUM_SIZES         3u
+
+/* Codificadores medidos */
+typedef enum {
+    WS2812B_BENCH_BRANCHY = 0,
+    WS2812B_BENCH_LUT,
+    WS2812B_BENCH_LUT_DIRTY,
+    WS2812B_BENCH_NUM_ENCODERS
+} WS2812BBench_Encoder_t;
+
+/* Pipelines de color medidos */
+typedef enum {
+    WS2812B_BENCH_FLOAT_POW = 0,
+    WS2812B_BENCH_INT_LUT,
+    WS2812B_BENCH_INT_DITHER,
+    WS2812B_BENCH_NUM_PIPELINES
+} WS2812BBench_Pipeline_t;
+
+/* Reloj libre: devuelve ticks (se permite el desborde de 32 bits) */
+typedef uint32_t (*WS2812BBench_Clock_t)(void);
+
+/* Resultado de un codificador sobre un largo de tira */
+typedef struct {
+    WS2812BBench_Encoder_t encoder;
+    uint16_t leds;
+    uint16_t encoded;           // LEDs codificados por trama
+    uint32_t ticks_per_frame;   // Mínimo de las tramas medidas
+} WS2812BBench_Result_t;
+
+/* Resultado de un pipeline de color sobre un largo de tira */
+typedef struct {
+    WS2812BBench_Pipeline_t pipeline;
+    uint16_t leds;
+    uint32_t ticks_per_frame;   // Mínimo de las tramas medidas
+} WS2812BBench_ColorResult_t;
+
+/* Errores del pipeline de color en 1/256 de paso de 8 bits */
+typedef struct {
+    uint32_t round_max;         // Máximo de |redondeado - exacto|
+    uint32_t dither_max;        // Máximo de |promedio de 256 tramas - exacto|
+} WS2812BBench_ColorError_t;
+
+/* Largos de tira medidos */
+extern const uint16_t WS2812BBench_Sizes[WS2812B_BENCH_NUM_SIZES];
+
+/* Funciones públicas */
+uint32_t WS2812BBench_Check(uint16_t leds, uint32_t seed);
+void WS2812BBench_Run(WS2812BBench_Encoder_t encoder, uint16_t leds, uint16_t frames,
+                      WS2812BBench_Clock_t clock, uint32_t seed, WS2812BBench_Result_t* result);
+const char* WS2812BBench_EncoderName(WS2812BBench_Encoder_t encoder);
+void WS2812BBench_PrintHeader(void);
+void WS2812BBench_PrintResult(const WS2812BBench_Result_t* result, uint32_t baseline_ticks);
+void WS2812BBench_CheckColor(WS2812BBench_ColorError_t* error);
+void WS2812BBench_RunColor(WS2812BBench_Pipeline_t pipeline, uint16_t leds, uint16_t frames,
+                           WS2812BBench_Clock_t clock, uint32_t seed, WS2812BBench_ColorResult_t* result);
+const char* WS2812BBench_PipelineName(WS2812BBench_Pipeline_t pipeline);
+void WS2812BBench_PrintColorHeader(void);
+void WS2812BBench_PrintColorResult(const WS2812BBench_ColorResult_t* result, uint32_t baseline_ticks);
+void WS2812BBench_RunTarget(void);
+
+#endif /* INC_WS2812B_BENCH_H_ */
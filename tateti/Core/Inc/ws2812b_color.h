@@ -0,0 +1,50 @@
+/**
+ ******************************************************************************
+ * @file    ws2812b_color.h
+ * @brief   Corrección gamma, brillo global, balance de blancos y dithering en enteros
+ ******************************************************************************
+ * @attention
+ *
+ * Los colores que recibe el driver son perceptuales (0-255 "a ojo") y el
+ * WS2812B responde en forma lineal a su PWM, así que cada canal pasa por:
+ *
+ *   salida = gamma[canal][color] * escala[canal]
+ *
+ * - gamma: tabla de 256 valores Q16 por canal (1.0 = 65535) en
+ *   ws2812b_gamma_data.c, generada en la PC con Tools/ws2812b_gammagen.c
+ *   (por defecto gamma 2.2 en los tres canales).
+ * - escala: brillo global y balance de blancos del canal, calculada una vez
+ *   al cambiarlos. Como gamma((c * b) / 255) = gamma(c) * gamma(b), el
+ *   brillo se aplica como gamma(b) sin perder la curva.
+ *
+ * El resultado es 8.8: sin dithering se redondea a 8 bits; con dithering el
+ * resto de cada canal se suma en la trama siguiente, así que el promedio en
+ * el tiempo conserva los 8 bits de fracción (útil con brillo bajo, donde un
+ * paso de 8 bits se nota). Por canal: una lectura de tabla, una
+ * multiplicación y dos desplazamientos.
+ *
+ * Módulo independiente del HAL (se compila también en la PC).
+ *
+ ******************************************************************************
+ */
+
+#ifndef INC_WS2812B_COLOR_H_
+#define INC_WS2812B_COLOR_H_
+
+#include <stdint.h>
+
+/* Tabla gamma por canal, en el orden del WS2812B (G, R, B) */
+extern const uint16_t WS2812B_Gamma[3][256];
+
+/* Escala por canal (G, R, B): gamma(brillo) * balance, en Q16 sobre 8.8 */
+typedef struct {
+    uint16_t scale[3];
+} WS2812B_ColorScale_t;
+
+/* Funciones públicas */
+void WS2812B_ColorScaleInit(WS2812B_ColorScale_t* scale, uint8_t brightness,
+                            uint8_t white_r, uint8_t white_g, uint8_t white_b);
+void WS2812B_ColorApply(const WS2812B_ColorScale_t* scale, const uint8_t in[][3], uint8_t out[][3],
+                        uint8_t residual[][3], uint16_t count);
+
+#endif /* INC_WS2812B_COLOR_H_ */
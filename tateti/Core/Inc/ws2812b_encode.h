@@ -0,0 +1,50 @@
+/**
+ ******************************************************************************
+ * @file    ws2812b_encode.h
+ * @brief   Codificación de colores GRB a valores de CCR para el PWM de los WS2812B
+ ******************************************************************************
+ * @attention
+ *
+ * Cada LED son 24 bits (G, R, B; del más significativo al menos) y cada bit
+ * un período del PWM: una media palabra con WS2812B_PWM_BIT1 o
+ * WS2812B_PWM_BIT0 que el DMA copia al CCR.
+ *
+ * - WS2812B_EncodeBranchy: la forma original, un bit por vuelta con un
+ *   salto y una media palabra por escritura (referencia del benchmark).
+ * - WS2812B_EncodeLut: cada nibble del color indexa una tabla de 16
+ *   entradas con sus 4 valores de CCR ya armados en dos palabras, que se
+ *   calcula al compilar a partir de WS2812B_PWM_BIT1/BIT0 (128 bytes de
+ *   flash). Un LED son 6 lecturas de tabla y 12 escrituras de palabra, sin
+ *   saltos. La salida tiene que estar alineada a 4 bytes.
+ * - WS2812B_EncodeLutDirty: lo mismo pero solo los LEDs marcados en un mapa
+ *   de bits (bit i de la palabra i / 32 = LED i), que queda en cero.
+ *
+ * Módulo independiente del HAL (se compila también en la PC).
+ *
+ ******************************************************************************
+ */
+
+#ifndef INC_WS2812B_ENCODE_H_
+#define INC_WS2812B_ENCODE_H_
+
+#include <stdint.h>
+
+/* Defines -------------------------------------------------------------------*/
+/* Valores PWM para bits '0' y '1' (PROBADOS Y FUNCIONANDO)
+ * Para TIM4 @ 84MHz, Period=104:
+ * PWM_1 = 67 (~64% duty cycle) para bit '1'
+ * PWM_0 = 34 (~32% duty cycle) para bit '0'
+ */
+#define WS2812B_PWM_BIT1     67
+#define WS2812B_PWM_BIT0     34
+
+#define WS2812B_SLOTS_PER_LED       24u     // Medias palabras por LED
+#define WS2812B_DIRTY_WORDS(leds)   (((leds) + 31u) / 32u)
+
+/* Funciones públicas */
+void WS2812B_EncodeBranchy(uint16_t* out, const uint8_t grb[][3], uint16_t count);
+void WS2812B_EncodeLut(uint16_t* out, const uint8_t grb[][3], uint16_t count);
+void WS2812B_EncodeLutDirty(uint16_t* out, const uint8_t grb[][3], uint16_t count,
+                            uint32_t dirty[]);
+
+#endif /* INC_WS2812B_ENCODE_H_ */
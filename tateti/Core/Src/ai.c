@@ -7,11 +7,69 @@
 
 #include "ai.h"
 #include "game_logic.h"
-#include <stdlib.h>
+#include "ai_search.h"
+#include "ai_table.h"
+#include "ai_policy.h"
+#include "mcts.h"
+#include "ultimate_search.h"
+#include "nn_eval.h"
+#include <stddef.h>
+#include <math.h>
 
 /* Variable privada para nivel de dificultad */
 static AI_Difficulty_t ai_difficulty = AI_MEDIUM;
 
+/* Generador de AI_EASY (xorshift32, nunca 0) */
+static uint32_t ai_rng = AI_EASY_SEED;
+
+/* Motor que resuelve la búsqueda en curso */
+typedef enum {
+    ENGINE_INSTANT = 0,     // Jugada resuelta en el acto (search_move)
+    ENGINE_MNK,             // Alfa-beta incremental (mnk_search)
+    ENGINE_MCTS,            // Monte-Carlo (mcts_tree)
+    ENGINE_ULTIMATE         // Alfa-beta incremental del ultimate tateti (ut_search)
+} SearchEngine_t;
+
+/* Búsqueda incremental (AI_BeginSearch / AI_Step / AI_Poll) */
+static AI_SearchState_t search_state = AI_SEARCH_IDLE;
+static SearchEngine_t search_engine = ENGINE_INSTANT;
+static uint8_t search_move;             // Jugada resuelta en el acto
+static uint32_t search_start_tick;
+static uint32_t search_deadline_ms;
+static MNK_Search_t mnk_search;
+static UTSearch_t ut_search;
+static MNK_Rules_t rules_3x3;
+static bool rules_3x3_ready = false;
+
+/* Árbol Monte-Carlo (AI_MCTS); se conserva entre jugadas para reutilizarlo */
+static MCTS_Node_t mcts_pool[AI_MCTS_POOL_NODES];
+static MCTS_Tree_t mcts_tree;
+static uint32_t mcts_target;            // Iteraciones de la búsqueda en curso
+static bool mcts_pondering = false;
+
+/* Pensamiento anticipado durante el turno del rival (AI_BeginPonder / AI_Ponder) */
+typedef struct {
+    uint64_t hash;          // Clave Zobrist de la posición después de la jugada del rival
+    int32_t score;
+    uint8_t move;           // Respuesta calculada
+    uint8_t depth;          // Profundidad alcanzada
+    uint8_t valid_depth;    // Vale como búsqueda hasta aquí (max_depth si terminó sola)
+} PonderEntry_t;
+
+static PonderEntry_t ponder_cache[AI_PONDER_CACHE_SIZE];
+static uint8_t ponder_cache_count = 0;
+static MNK_Search_t ponder_search;
+static MNK_Board_t ponder_root;         // Posición con el rival por mover
+static uint64_t ponder_child_hash;      // Posición que analiza ponder_search
+static uint8_t ponder_moves[MNK_MAX_CELLS];
+static uint8_t ponder_move_count = 0;
+static uint8_t ponder_index = 0;        // Jugada del rival en análisis
+static uint8_t ponder_depth;
+static uint32_t ponder_node_limit;
+static bool ponder_active = false;
+static bool ponder_searching = false;   // ponder_search tiene una búsqueda en curso
+static AI_PonderStats_t ponder_stats;
+
 /* Mapeo de posición de tablero a tecla física */
 static const Keyboard_Key_t position_to_key[9] = {
     KEY_P4,  // Posición 0
@@ -25,14 +83,165 @@ static const Keyboard_Key_t position_to_key[9] = {
     KEY_P14  // Posición 8
 };
 
+/* Política de cada nivel sobre la lista ordenada (AI_EASY, AI_MEDIUM) */
+static const AI_Policy_t level_policies[2] = {
+    {0, AI_EASY_TEMPERATURE},
+    {0, AI_MEDIUM_TEMPERATURE}
+};
+
 /* Prototipos funciones privadas */
-static uint8_t AI_EasyMove(CellState_t* board);
-static uint8_t AI_MediumMove(CellState_t* board);
-static uint8_t AI_HardMove(CellState_t* board);
-static uint8_t FindEmptyPosition(CellState_t* board);
-static int8_t CheckWinningMove(CellState_t* board, CellState_t player);
-static int8_t Minimax(CellState_t* board, uint8_t depth, bool isMaximizing);
-static int8_t EvaluateBoard(CellState_t* board);
+static uint8_t TableRankMoves(Bitboard_t board, bool p2_to_move, AISearch_Move_t moves[BB_NUM_CELLS]);
+static uint8_t AI_RankedMove(const Bitboard_t* board, AI_Difficulty_t level, uint32_t* rng);
+static uint8_t AI_HardMove(const Bitboard_t* board);
+static uint8_t AI_LearnedMove(const Bitboard_t* board);
+static uint8_t AI_MctsMove(const Bitboard_t* board);
+static uint8_t FindEmptyPosition(const Bitboard_t* board);
+static uint8_t SelectMove(const Bitboard_t* board);
+static uint32_t NextRandom(uint32_t* rng);
+static void EnableCycleCounter(void);
+static const MNK_Rules_t* Rules3x3(void);
+static void PrepareMcts(const MNK_Rules_t* rules, const MNK_Board_t* board);
+static void StartPonder(const MNK_Rules_t* rules, const MNK_Board_t* board, uint8_t max_depth,
+                        uint32_t node_limit, MNK_Mask_t skip);
+static bool PonderNextMove(void);
+static void PonderStore(void);
+static bool PonderLookup(const MNK_Rules_t* rules, const MNK_Board_t* board, uint8_t max_depth);
+
+/**
+ * @brief  Prepara un jugador independiente para una partida nueva
+ */
+void AI_PlayerInit(AI_Player_t* player, AI_Difficulty_t difficulty, uint32_t seed,
+                   MCTS_Node_t* pool, uint16_t pool_nodes, uint32_t mcts_iterations)
+{
+    player->difficulty = difficulty;
+    player->rng = (seed != 0) ? seed : AI_EASY_SEED;
+    player->mcts_iterations = (mcts_iterations != 0) ? mcts_iterations : AI_MCTS_ITERATIONS;
+    player->nodes = 0;
+
+    // Rules3x3() se inicializa una sola vez; acá queda lista antes de los hilos
+    if (difficulty == AI_MCTS && pool != NULL) {
+        MCTS_Init(&player->mcts, Rules3x3(), pool, pool_nodes, player->rng);
+    } else {
+        (void)Rules3x3();
+        player->mcts.rules = NULL;
+    }
+}
+
+/**
+ * @brief  Calcula la jugada de un jugador independiente (bloqueante)
+ */
+uint8_t AI_PlayerMove(AI_Player_t* player, const GameContext_t* ctx, CellState_t side)
+{
+    Bitboard_t board = GameCtx_GetBitboard(ctx);
+    uint8_t move;
+
+    // Los niveles juegan como jugador 2: si le toca al 1 se intercambian las fichas
+    if (side == CELL_PLAYER1) {
+        uint16_t p1 = board.p1;
+        board.p1 = board.p2;
+        board.p2 = p1;
+    }
+
+    switch (player->difficulty) {
+        case AI_EASY:
+        case AI_MEDIUM:
+            // Sin reiniciar el contador de nodos de ai_search.c: es compartido
+            return AI_RankedMove(&board, player->difficulty, &player->rng);
+        case AI_HARD:
+            return AI_HardMove(&board);
+        case AI_LEARNED:
+            return AI_LearnedMove(&board);
+        case AI_MCTS:
+            if (player->mcts.rules != NULL) {
+                MNK_Board_t mnk_board;
+                MNK_SetPosition(player->mcts.rules, &mnk_board, board.p1, board.p2, 1);
+                MCTS_SetRoot(&player->mcts, &mnk_board);
+                if (player->mcts.iterations < player->mcts_iterations) {
+                    MCTS_Run(&player->mcts, player->mcts_iterations - player->mcts.iterations);
+                }
+                player->nodes = player->mcts.iterations;
+                move = MCTS_BestMove(&player->mcts);
+                if (move != MNK_NO_MOVE) {
+                    return move;
+                }
+            }
+            return FindEmptyPosition(&board);
+        default:
+            return FindEmptyPosition(&board);
+    }
+}
+
+/**
+ * @brief  Puntúa y ordena todas las jugadas del jugador que mueve
+ */
+uint8_t AI_RankMoves(const GameContext_t* ctx, CellState_t side, AISearch_Move_t moves[BB_NUM_CELLS])
+{
+    return TableRankMoves(GameCtx_GetBitboard(ctx), side == CELL_PLAYER2, moves);
+}
+
+/**
+ * @brief  Elige una jugada de la lista ordenada según una política
+ */
+uint8_t AI_SelectRanked(const AISearch_Move_t moves[], uint8_t count, const AI_Policy_t* policy,
+                        uint32_t* rng)
+{
+    if (count == 0) {
+        return 0;
+    }
+    if (policy->temperature <= 0.0f) {
+        return moves[(policy->rank < count) ? policy->rank : (uint8_t)(count - 1u)].move;
+    }
+
+    // Softmax: peso exp((puntaje - mejor) / T), la mejor jugada pesa 1
+    float weights[BB_NUM_CELLS];
+    float total = 0.0f;
+    for (uint8_t i = 0; i < count; i++) {
+        weights[i] = expf((float)(moves[i].score - moves[0].score) / policy->temperature);
+        total += weights[i];
+    }
+
+    float pick = (float)(NextRandom(rng) >> 8) * (1.0f / 16777216.0f) * total;
+    for (uint8_t i = 0; i < count; i++) {
+        pick -= weights[i];
+        if (pick < 0.0f) {
+            return moves[i].move;
+        }
+    }
+    return moves[count - 1u].move;
+}
+
+/**
+ * @brief  Clasifica cada jugada legal del jugador que mueve
+ */
+void AI_EvaluateMoves(const GameContext_t* ctx, CellState_t side, AI_MoveValues_t* values)
+{
+    AISearch_Move_t moves[BB_NUM_CELLS];
+    uint8_t count = TableRankMoves(GameCtx_GetBitboard(ctx), side == CELL_PLAYER2, moves);
+
+    values->win = 0;
+    values->draw = 0;
+    values->loss = 0;
+
+    // Solo importa el signo del puntaje
+    for (uint8_t i = 0; i < count; i++) {
+        uint16_t bit = (uint16_t)(1u << moves[i].move);
+        if (moves[i].score > 0) {
+            values->win |= bit;
+        } else if (moves[i].score == 0) {
+            values->draw |= bit;
+        } else {
+            values->loss |= bit;
+        }
+    }
+}
+
+/**
+ * @brief  Reinicia el generador de AI_EASY usado por AI_CalculateMove
+ */
+void AI_SetSeed(uint32_t seed)
+{
+    ai_rng = (seed != 0) ? seed : AI_EASY_SEED;
+}
 
 /**
  * @brief  Configura el nivel de dificultad de la IA
@@ -50,226 +259,685 @@ AI_Difficulty_t AI_GetDifficulty(void)
     return ai_difficulty;
 }
 
+/**
+ * @brief  Elige la evaluación de hojas de las búsquedas m,n,k
+ */
+void AI_SetEvaluation(AI_Evaluation_t evaluation)
+{
+    AI_StopPonder();
+    MNK_SetEvaluator((evaluation == AI_EVAL_NN) ? NN_Evaluate : NULL);
+}
+
+/**
+ * @brief  Obtiene la cantidad de nodos visitados por la última búsqueda
+ */
+uint32_t AI_GetLastNodeCount(void)
+{
+    switch (search_engine) {
+        case ENGINE_MNK:
+            return mnk_search.nodes;
+        case ENGINE_MCTS:
+            return mcts_tree.iterations;
+        case ENGINE_ULTIMATE:
+            return ut_search.nodes;
+        default:
+            return AISearch_GetNodeCount();
+    }
+}
+
 /**
  * @brief  Calcula el siguiente movimiento de la IA según nivel configurado
  */
 Keyboard_Key_t AI_CalculateMove(void)
 {
-    CellState_t board[9];
-    Game_GetBoard(board);
+    return AI_CalculateMoveCtx(Game_GetDefaultContext());
+}
+
+/**
+ * @brief  Calcula el siguiente movimiento de la IA sobre un contexto de partida
+ */
+Keyboard_Key_t AI_CalculateMoveCtx(const GameContext_t* ctx)
+{
+    Bitboard_t board = GameCtx_GetBitboard(ctx);
     
+    search_engine = ENGINE_INSTANT;
+    return position_to_key[SelectMove(&board)];
+}
+
+/**
+ * @brief  Inicia una búsqueda no bloqueante sobre un contexto de partida
+ */
+void AI_BeginSearch(const GameContext_t* ctx, uint32_t deadline_ms)
+{
+    Bitboard_t board = GameCtx_GetBitboard(ctx);
+
+    search_engine = ENGINE_INSTANT;
+
+    // Solo AI_MCTS necesita buscar: los otros niveles eligen sobre la lista
+    // que arma TableRankMoves con a lo sumo 9 consultas a la tabla en flash
+    if (ai_difficulty != AI_MCTS || Bitboard_Empty(&board) == 0) {
+        AI_StopPonder();
+        search_move = SelectMove(&board);
+        search_state = AI_SEARCH_DONE;
+        return;
+    }
+
+    // El 3x3 del motor m,n,k usa la misma numeración de celdas que el bitboard
+    MNK_Board_t mnk_board;
+    MNK_SetPosition(Rules3x3(), &mnk_board, board.p1, board.p2, 1);
+    AI_BeginSearchMCTS(Rules3x3(), &mnk_board, AI_MCTS_ITERATIONS, deadline_ms);
+}
+
+/**
+ * @brief  Inicia una búsqueda no bloqueante sobre un tablero m,n,k
+ */
+void AI_BeginSearchMNK(const MNK_Rules_t* rules, const MNK_Board_t* board, uint8_t max_depth,
+                       uint32_t deadline_ms)
+{
+    EnableCycleCounter();
+
+    search_engine = ENGINE_MNK;
+    search_start_tick = HAL_GetTick();
+    search_deadline_ms = deadline_ms;
+
+    // Respuesta ya calculada mientras pensaba el rival
+    if (PonderLookup(rules, board, max_depth)) {
+        ponder_stats.hits++;
+    } else {
+        ponder_stats.misses++;
+        MNK_SearchBegin(&mnk_search, rules, board, max_depth);
+    }
+    AI_StopPonder();
+
+    search_state = mnk_search.done ? AI_SEARCH_DONE : AI_SEARCH_RUNNING;
+}
+
+/**
+ * @brief  Inicia una búsqueda Monte-Carlo no bloqueante sobre un tablero m,n,k
+ */
+void AI_BeginSearchMCTS(const MNK_Rules_t* rules, const MNK_Board_t* board, uint32_t iterations,
+                        uint32_t deadline_ms)
+{
+    EnableCycleCounter();
+
+    search_engine = ENGINE_MCTS;
+    search_start_tick = HAL_GetTick();
+    search_deadline_ms = deadline_ms;
+
+    // Si la posición sale del árbol anterior (o del pensado durante el turno
+    // del rival) se conservan sus iteraciones
+    PrepareMcts(rules, board);
+    if (mcts_tree.reused != 0) {
+        ponder_stats.hits++;
+    } else {
+        ponder_stats.misses++;
+    }
+    AI_StopPonder();
+
+    mcts_target = iterations;
+    search_state = (MNK_Empty(rules, board) == 0 || mcts_tree.iterations >= mcts_target) ?
+                   AI_SEARCH_DONE : AI_SEARCH_RUNNING;
+}
+
+/**
+ * @brief  Inicia la búsqueda no bloqueante de la IA en el ultimate tateti
+ */
+void AI_BeginSearchUltimate(const UT_Board_t* board)
+{
+    AI_StopPonder();
+
+    if (ai_difficulty == AI_EASY) {
+        uint8_t moves[UT_NUM_CELLS];
+        uint8_t count = UT_GenerateMoves(board, moves);
+
+        search_engine = ENGINE_INSTANT;
+        search_move = (count != 0) ? moves[NextRandom(&ai_rng) % count] : UT_NO_MOVE;
+        search_state = AI_SEARCH_DONE;
+        return;
+    }
+
+    EnableCycleCounter();
+
+    search_engine = ENGINE_ULTIMATE;
+    search_start_tick = HAL_GetTick();
+    search_deadline_ms = ULTIMATE_AI_BUDGET_MS;
+
+    UTSearch_Begin(&ut_search, board,
+                   (ai_difficulty == AI_MEDIUM) ? ULTIMATE_AI_MEDIUM_DEPTH : UT_SEARCH_MAX_DEPTH);
+    search_state = ut_search.done ? AI_SEARCH_DONE : AI_SEARCH_RUNNING;
+}
+
+/**
+ * @brief  Avanza la búsqueda en curso durante un tiempo acotado
+ */
+AI_SearchState_t AI_Step(uint32_t budget_us)
+{
+    if (search_state != AI_SEARCH_RUNNING) {
+        return search_state;
+    }
+
+    uint32_t cycles = budget_us * (SystemCoreClock / 1000000u);
+    uint32_t start = DWT->CYCCNT;
+
+    do {
+        bool finished;
+        bool can_stop = true;
+        if (search_engine == ENGINE_MCTS) {
+            MCTS_Run(&mcts_tree, AI_MCTS_STEP_ITERATIONS);
+            finished = (mcts_tree.iterations >= mcts_target);
+        } else if (search_engine == ENGINE_ULTIMATE) {
+            finished = UTSearch_Step(&ut_search, AI_STEP_NODES);
+            can_stop = (ut_search.result.depth > 0);  // La profundidad 1 siempre se completa
+        } else {
+            finished = MNK_SearchStep(&mnk_search, AI_STEP_NODES);
+        }
+
+        if (finished || (can_stop && (HAL_GetTick() - search_start_tick) >= search_deadline_ms)) {
+            // Terminada o plazo vencido: queda la mejor jugada hasta ahora
+            search_state = AI_SEARCH_DONE;
+            break;
+        }
+    } while ((DWT->CYCCNT - start) < cycles);
+
+    return search_state;
+}
+
+/**
+ * @brief  Consulta el resultado de la búsqueda
+ */
+bool AI_Poll(uint8_t* position_out)
+{
+    if (search_state == AI_SEARCH_IDLE) {
+        return false;
+    }
+
+    if (position_out != NULL) {
+        switch (search_engine) {
+            case ENGINE_MNK:
+                *position_out = mnk_search.result.best_move;
+                break;
+            case ENGINE_MCTS:
+                *position_out = MCTS_BestMove(&mcts_tree);
+                break;
+            case ENGINE_ULTIMATE:
+                *position_out = ut_search.result.best_move;
+                break;
+            default:
+                *position_out = search_move;
+                break;
+        }
+    }
+    return search_state == AI_SEARCH_DONE;
+}
+
+/**
+ * @brief  Descarta la búsqueda en curso
+ */
+void AI_CancelSearch(void)
+{
+    search_state = AI_SEARCH_IDLE;
+}
+
+/**
+ * @brief  Obtiene el estado de la búsqueda incremental
+ */
+AI_SearchState_t AI_GetSearchState(void)
+{
+    return search_state;
+}
+
+/**
+ * @brief  Convierte una posición del tablero en la tecla que la representa
+ */
+Keyboard_Key_t AI_PositionToKey(uint8_t position)
+{
+    if (position > 8) {
+        return KEY_NONE;
+    }
+    return position_to_key[position];
+}
+
+/**
+ * @brief  Empieza a pensar las respuestas mientras mueve el jugador 1
+ */
+void AI_BeginPonder(const GameContext_t* ctx)
+{
+    Bitboard_t board = GameCtx_GetBitboard(ctx);
+    uint16_t empty = Bitboard_Empty(&board);
+
+    AI_StopPonder();
+
+    // Monte-Carlo: seguir iterando sobre la posición actual; al mover P1 se
+    // conserva el subárbol de la jugada elegida
+    if (ai_difficulty == AI_MCTS) {
+        MNK_Board_t mnk_board;
+        MNK_SetPosition(Rules3x3(), &mnk_board, board.p1, board.p2, 0);
+        EnableCycleCounter();
+        PrepareMcts(Rules3x3(), &mnk_board);
+        mcts_pondering = (empty != 0);
+        ponder_active = mcts_pondering;
+    }
+
+    // Los demás niveles responden en el acto desde la tabla precalculada: no
+    // hay nada que pensar de antemano
+}
+
+/**
+ * @brief  Empieza a pensar las respuestas sobre un tablero m,n,k
+ */
+void AI_BeginPonderMNK(const MNK_Rules_t* rules, const MNK_Board_t* board, uint8_t max_depth,
+                       uint32_t node_limit)
+{
+    AI_StopPonder();
+    StartPonder(rules, board, max_depth, node_limit, 0);
+}
+
+/**
+ * @brief  Avanza el pensamiento anticipado durante un tiempo acotado
+ */
+bool AI_Ponder(uint32_t budget_us)
+{
+    if (!ponder_active) {
+        return false;
+    }
+
+    uint32_t cycles = budget_us * (SystemCoreClock / 1000000u);
+    uint32_t start = DWT->CYCCNT;
+
+    do {
+        if (mcts_pondering) {
+            MCTS_Run(&mcts_tree, AI_MCTS_STEP_ITERATIONS);
+            if (mcts_tree.iterations >= AI_MCTS_PONDER_ITERATIONS) {
+                ponder_active = false;  // Suficiente: no gastar más energía
+                break;
+            }
+            continue;
+        }
+
+        if (!ponder_searching && !PonderNextMove()) {
+            ponder_active = false;  // Todas las respuestas calculadas
+            break;
+        }
+
+        bool done = MNK_SearchStep(&ponder_search, AI_STEP_NODES);
+        if (done || (ponder_node_limit != 0 && ponder_search.nodes >= ponder_node_limit)) {
+            PonderStore();
+            ponder_searching = false;
+        }
+    } while ((DWT->CYCCNT - start) < cycles);
+
+    return ponder_active;
+}
+
+/**
+ * @brief  Detiene el pensamiento anticipado y descarta las respuestas guardadas
+ */
+void AI_StopPonder(void)
+{
+    ponder_active = false;
+    ponder_searching = false;
+    ponder_cache_count = 0;
+    mcts_pondering = false;
+}
+
+/**
+ * @brief  Obtiene los contadores del pensamiento anticipado
+ */
+AI_PonderStats_t AI_GetPonderStats(void)
+{
+    return ponder_stats;
+}
+
+/**
+ * @brief  Pone a cero los contadores del pensamiento anticipado
+ */
+void AI_ResetPonderStats(void)
+{
+    ponder_stats.hits = 0;
+    ponder_stats.misses = 0;
+    ponder_stats.replies = 0;
+}
+
+/**
+ * @brief  Elige la jugada del nivel configurado (bloqueante)
+ */
+static uint8_t SelectMove(const Bitboard_t* board)
+{
     uint8_t position;
     
+    // AI_GetLastNodeCount cuenta solo los nodos de esta jugada
+    AISearch_ResetNodeCount();
+
     switch (ai_difficulty) {
         case AI_EASY:
-            position = AI_EasyMove(board);
-            break;
         case AI_MEDIUM:
-            position = AI_MediumMove(board);
+            position = AI_RankedMove(board, ai_difficulty, &ai_rng);
             break;
         case AI_HARD:
             position = AI_HardMove(board);
             break;
+        case AI_LEARNED:
+            position = AI_LearnedMove(board);
+            break;
+        case AI_MCTS:
+            position = AI_MctsMove(board);
+            break;
         default:
             position = FindEmptyPosition(board);
             break;
     }
     
-    return position_to_key[position];
+    return position;
+}
+
+/**
+ * @brief  Niveles fácil y medio: política del nivel sobre la lista de
+ *         jugadas ordenada por puntaje
+ * @note   Una sola lista para ambos niveles; lo que cambia es la
+ *         temperatura del softmax, así que se equivocan más cuanto más
+ *         caliente
+ * @param  board: Tablero con turno del jugador 2
+ * @param  rng: Estado del generador a usar (global o del jugador)
+ */
+static uint8_t AI_RankedMove(const Bitboard_t* board, AI_Difficulty_t level, uint32_t* rng)
+{
+    AISearch_Move_t moves[BB_NUM_CELLS];
+    uint8_t count = TableRankMoves(*board, true, moves);
+
+    return AI_SelectRanked(moves, count, &level_policies[level], rng);
+}
+
+/**
+ * @brief  Nivel difícil: jugada de la tabla de juego perfecto, llevada de la
+ *         forma canónica a la orientación real del tablero
+ * @note   Si la posición no está en la tabla (solo las ilegales) juega el
+ *         negamax de AISearch_BestMove
+ * @param  board: Tablero con turno del jugador 2
+ */
+static uint8_t AI_HardMove(const Bitboard_t* board)
+{
+    uint8_t move;
+
+    if (AITable_Lookup(board, &move, NULL)) {
+        return move;
+    }
+    return AISearch_BestMove(*board, true, NULL);
 }
 
 /**
- * @brief  IA Fácil - Movimiento aleatorio
+ * @brief  Puntúa y ordena las jugadas con la tabla precalculada (ai_table.c)
+ * @note   Cada jugada que no termina la partida deja al rival con turno, es
+ *         decir en la tabla como P2 con los colores intercambiados. La tabla
+ *         da el resultado pero no la distancia, así que el puntaje usa la
+ *         escala de ai_search.h con la distancia más corta posible: ganar
+ *         en el acto 9, ganar más adelante 7, perder contra una victoria
+ *         inmediata del rival -8, perder más adelante -6. No usa RAM más
+ *         allá de la pila; solo una posición fuera de la tabla (ilegal)
+ *         cae en AISearch_Negamax, que suma sus nodos al contador.
+ * @param  board: Tablero actual
+ * @param  p2_to_move: true si mueve el jugador 2, false si mueve el jugador 1
+ * @param  moves: Salida, de mayor a menor puntaje (mismo puntaje: menor
+ *         índice primero, igual que AISearch_RankMoves)
+ * @retval Cantidad de jugadas (celdas libres)
  */
-static uint8_t AI_EasyMove(CellState_t* board)
+static uint8_t TableRankMoves(Bitboard_t board, bool p2_to_move, AISearch_Move_t moves[BB_NUM_CELLS])
 {
-    uint8_t empty_positions[9];
+    uint16_t own = p2_to_move ? board.p2 : board.p1;
+    uint16_t opp = p2_to_move ? board.p1 : board.p2;
+    uint16_t empty = Bitboard_Empty(&board);
     uint8_t count = 0;
-    
-    // Recopilar todas las posiciones vacías
-    for (uint8_t i = 0; i < 9; i++) {
-        if (board[i] == CELL_EMPTY) {
-            empty_positions[count++] = i;
+
+    while (empty) {
+        uint8_t cell = Bitboard_PopLowest(&empty);
+        uint16_t after = (uint16_t)(own | (1u << cell));
+        uint16_t rest = (uint16_t)(~(after | opp) & BB_FULL_MASK);
+        Bitboard_t child = {after, opp};
+        AI_TableValue_t value;
+        uint8_t reply;
+        int8_t score;
+
+        if (Bitboard_HasWin(after)) {
+            score = AI_SEARCH_SCORE_WIN - 1;
+        } else if (rest == 0) {
+            score = 0;
+        } else if (!AITable_Lookup(&child, &reply, &value)) {
+            score = (int8_t)-AISearch_Negamax(opp, after, 1, -AI_SEARCH_SCORE_INF, AI_SEARCH_SCORE_INF);
+        } else if (value == AI_VALUE_LOSS) {
+            score = AI_SEARCH_SCORE_WIN - 3;
+        } else if (value == AI_VALUE_DRAW) {
+            score = 0;
+        } else {
+            // ¿El rival gana en su jugada?
+            score = -(AI_SEARCH_SCORE_WIN - 4);
+            while (rest) {
+                if (Bitboard_HasWin((uint16_t)(opp | (1u << Bitboard_PopLowest(&rest))))) {
+                    score = -(AI_SEARCH_SCORE_WIN - 2);
+                    break;
+                }
+            }
         }
+
+        // Inserción estable: las celdas salen en orden de índice
+        uint8_t k = count++;
+        while (k > 0 && moves[k - 1u].score < score) {
+            moves[k] = moves[k - 1u];
+            k--;
+        }
+        moves[k].move = cell;
+        moves[k].score = score;
     }
-    
-    if (count == 0) return 0;
-    
-    // Seleccionar aleatoriamente
-    return empty_positions[rand() % count];
+    return count;
 }
 
 /**
- * @brief  IA Media - Bloquea y busca ganar
+ * @brief  Nivel aprendido: celda libre de mayor preferencia en la política
+ *         generada por Tools/ai_rltrain.c
+ * @param  board: Tablero con turno del jugador 2
  */
-static uint8_t AI_MediumMove(CellState_t* board)
+static uint8_t AI_LearnedMove(const Bitboard_t* board)
 {
-    int8_t move;
-    
-    // 1. Intentar ganar
-    move = CheckWinningMove(board, CELL_PLAYER2);
-    if (move >= 0) return (uint8_t)move;
-    
-    // 2. Bloquear victoria del oponente
-    move = CheckWinningMove(board, CELL_PLAYER1);
-    if (move >= 0) return (uint8_t)move;
-    
-    // 3. Tomar el centro si está disponible
-    if (board[4] == CELL_EMPTY) return 4;
-    
-    // 4. Tomar una esquina
-    const uint8_t corners[4] = {0, 2, 6, 8};
-    for (uint8_t i = 0; i < 4; i++) {
-        if (board[corners[i]] == CELL_EMPTY) {
-            return corners[i];
-        }
+    uint8_t move;
+
+    if (AIPolicy_Move(board, &move)) {
+        return move;
     }
-    
-    // 5. Cualquier posición disponible
     return FindEmptyPosition(board);
 }
 
 /**
- * @brief  IA Difícil - Minimax (invencible)
+ * @brief  IA Monte-Carlo - AI_MCTS_ITERATIONS simulaciones (bloqueante)
  */
-static uint8_t AI_HardMove(CellState_t* board)
+static uint8_t AI_MctsMove(const Bitboard_t* board)
 {
-    int8_t best_score = -100;
-    uint8_t best_move = 0;
+    MNK_Board_t mnk_board;
     
-    for (uint8_t i = 0; i < 9; i++) {
-        if (board[i] == CELL_EMPTY) {
-            board[i] = CELL_PLAYER2;
-            int8_t score = Minimax(board, 0, false);
-            board[i] = CELL_EMPTY;
-            
-            if (score > best_score) {
-                best_score = score;
-                best_move = i;
-            }
-        }
+    search_engine = ENGINE_MCTS;
+    MNK_SetPosition(Rules3x3(), &mnk_board, board->p1, board->p2, 1);
+    PrepareMcts(Rules3x3(), &mnk_board);
+    if (mcts_tree.iterations < AI_MCTS_ITERATIONS) {
+        MCTS_Run(&mcts_tree, AI_MCTS_ITERATIONS - mcts_tree.iterations);
     }
     
-    return best_move;
+    uint8_t move = MCTS_BestMove(&mcts_tree);
+    return (move == MNK_NO_MOVE) ? FindEmptyPosition(board) : move;
 }
 
 /**
  * @brief  Encuentra primera posición vacía
  */
-static uint8_t FindEmptyPosition(CellState_t* board)
+static uint8_t FindEmptyPosition(const Bitboard_t* board)
 {
-    for (uint8_t i = 0; i < 9; i++) {
-        if (board[i] == CELL_EMPTY) {
-            return i;
-        }
-    }
-    return 0;
+    uint16_t empty = Bitboard_Empty(board);
+    
+    if (empty == 0) return 0;
+    return Bitboard_PopLowest(&empty);
 }
 
 /**
- * @brief  Busca un movimiento ganador para el jugador especificado
- * @retval Posición del movimiento ganador, o -1 si no hay
+ * @brief  Generador xorshift32 (mismo que las simulaciones de mcts.c)
  */
-static int8_t CheckWinningMove(CellState_t* board, CellState_t player)
+static uint32_t NextRandom(uint32_t* rng)
 {
-    for (uint8_t i = 0; i < 9; i++) {
-        if (board[i] == CELL_EMPTY) {
-            board[i] = player;
-            
-            // Verificar si este movimiento gana
-            WinType_t win_type = Game_CheckWin();
-            bool wins = (win_type != WIN_NONE);
-            
-            board[i] = CELL_EMPTY;
-            
-            if (wins) return (int8_t)i;
-        }
+    uint32_t x = *rng;
+    x ^= x << 13;
+    x ^= x >> 17;
+    x ^= x << 5;
+    *rng = x;
+    return x;
+}
+
+/**
+ * @brief  Habilita el contador de ciclos DWT (una sola vez)
+ */
+static void EnableCycleCounter(void)
+{
+    if ((DWT->CTRL & DWT_CTRL_CYCCNTENA_Msk) == 0) {
+        CoreDebug->DEMCR |= CoreDebug_DEMCR_TRCENA_Msk;
+        DWT->CYCCNT = 0;
+        DWT->CTRL |= DWT_CTRL_CYCCNTENA_Msk;
     }
-    return -1;
 }
 
 /**
- * @brief  Algoritmo Minimax
+ * @brief  Prepara la lista de jugadas del rival a analizar
+ * @param  skip: Celdas cuya respuesta no hace falta calcular
  */
-static int8_t Minimax(CellState_t* board, uint8_t depth, bool isMaximizing)
+static void StartPonder(const MNK_Rules_t* rules, const MNK_Board_t* board, uint8_t max_depth,
+                        uint32_t node_limit, MNK_Mask_t skip)
 {
-    int8_t score = EvaluateBoard(board);
-    
-    // Si el juego terminó, retornar score
-    if (score != 0) return score - depth * (score > 0 ? 1 : -1);
-    
-    // Si es empate
-    bool has_empty = false;
-    for (uint8_t i = 0; i < 9; i++) {
-        if (board[i] == CELL_EMPTY) {
-            has_empty = true;
-            break;
+    MNK_Mask_t empty = MNK_Empty(rules, board) & ~skip;
+
+    EnableCycleCounter();
+
+    // Recorrer las jugadas del rival de la más central a la más externa
+    ponder_move_count = 0;
+    for (uint8_t i = 0; i < rules->num_cells; i++) {
+        uint8_t cell = rules->move_order[i];
+        if (empty & ((MNK_Mask_t)1u << cell)) {
+            ponder_moves[ponder_move_count++] = cell;
         }
     }
-    if (!has_empty) return 0;
-    
-    if (isMaximizing) {
-        int8_t best = -100;
-        for (uint8_t i = 0; i < 9; i++) {
-            if (board[i] == CELL_EMPTY) {
-                board[i] = CELL_PLAYER2;
-                int8_t val = Minimax(board, depth + 1, false);
-                board[i] = CELL_EMPTY;
-                if (val > best) best = val;
-            }
+
+    ponder_search.rules = rules;
+    ponder_root = *board;
+    ponder_index = 0;
+    ponder_depth = max_depth;
+    ponder_node_limit = node_limit;
+    ponder_cache_count = 0;
+    ponder_searching = false;
+    ponder_active = (ponder_move_count > 0);
+}
+
+/**
+ * @brief  Inicia la búsqueda de la respuesta a la próxima jugada del rival
+ * @retval false si ya no quedan jugadas por analizar
+ */
+static bool PonderNextMove(void)
+{
+    const MNK_Rules_t* rules = ponder_search.rules;
+
+    while (ponder_index < ponder_move_count) {
+        uint8_t cell = ponder_moves[ponder_index++];
+        MNK_Board_t child = ponder_root;
+
+        // Si la jugada del rival termina la partida no hay respuesta que pensar
+        if (MNK_IsWinningMove(rules, child.cells[child.side] | ((MNK_Mask_t)1u << cell), cell)) {
+            continue;
         }
-        return best;
-    } else {
-        int8_t best = 100;
-        for (uint8_t i = 0; i < 9; i++) {
-            if (board[i] == CELL_EMPTY) {
-                board[i] = CELL_PLAYER1;
-                int8_t val = Minimax(board, depth + 1, true);
-                board[i] = CELL_EMPTY;
-                if (val < best) best = val;
-            }
+        MNK_MakeMove(rules, &child, cell);
+        ponder_child_hash = child.hash;
+
+        MNK_SearchBegin(&ponder_search, rules, &child, ponder_depth);
+        if (ponder_search.result.best_move == MNK_NO_MOVE) {
+            continue;
         }
-        return best;
+        ponder_searching = true;
+        return true;
     }
+    return false;
 }
 
 /**
- * @brief  Evalúa el estado del tablero
- * @retval +10 si P2 gana, -10 si P1 gana, 0 si no hay ganador
+ * @brief  Guarda la respuesta de la búsqueda terminada en ponder_search
  */
-static int8_t EvaluateBoard(CellState_t* board)
+static void PonderStore(void)
 {
-    // Verificar filas
-    for (uint8_t i = 0; i < 3; i++) {
-        if (board[i*3] != CELL_EMPTY && 
-            board[i*3] == board[i*3+1] && 
-            board[i*3] == board[i*3+2]) {
-            return (board[i*3] == CELL_PLAYER2) ? 10 : -10;
-        }
+    if (ponder_cache_count >= AI_PONDER_CACHE_SIZE) {
+        return;
     }
-    
-    // Verificar columnas
-    for (uint8_t i = 0; i < 3; i++) {
-        if (board[i] != CELL_EMPTY && 
-            board[i] == board[i+3] && 
-            board[i] == board[i+6]) {
-            return (board[i] == CELL_PLAYER2) ? 10 : -10;
+
+    PonderEntry_t* entry = &ponder_cache[ponder_cache_count++];
+    entry->hash = ponder_child_hash;
+    entry->score = ponder_search.result.score;
+    entry->move = ponder_search.result.best_move;
+    entry->depth = ponder_search.result.depth;
+    // Cortada por el límite de nodos: solo vale lo que completó
+    entry->valid_depth = ponder_search.done ? ponder_search.max_depth : ponder_search.result.depth;
+    ponder_stats.replies++;
+}
+
+/**
+ * @brief  Busca la posición entre las respuestas pensadas de antemano
+ * @note   Si la posición es justo la que se estaba analizando, la búsqueda a
+ *         medio hacer pasa a ser la búsqueda principal en lugar de empezar de cero.
+ *         Una respuesta guardada solo sirve si llegó a la profundidad pedida;
+ *         si no, se busca de nuevo y la tabla de transposición que dejó el
+ *         pensamiento ordena las jugadas.
+ * @retval true si hubo coincidencia (mnk_search queda preparada)
+ */
+static bool PonderLookup(const MNK_Rules_t* rules, const MNK_Board_t* board, uint8_t max_depth)
+{
+    if (ponder_search.rules != rules) {
+        return false;
+    }
+
+    // Misma cota que MNK_SearchBegin: no más jugadas que celdas libres
+    uint8_t remaining = (uint8_t)(rules->num_cells - board->move_count);
+    if (max_depth > remaining) {
+        max_depth = remaining;
+    }
+
+    if (ponder_searching && ponder_child_hash == board->hash &&
+        ponder_search.max_depth >= max_depth) {
+        mnk_search = ponder_search;
+        return true;
+    }
+
+    for (uint8_t i = 0; i < ponder_cache_count; i++) {
+        if (ponder_cache[i].hash == board->hash && ponder_cache[i].valid_depth >= max_depth) {
+            mnk_search.rules = rules;
+            mnk_search.board = *board;
+            mnk_search.nodes = 0;
+            mnk_search.done = true;
+            mnk_search.result.best_move = ponder_cache[i].move;
+            mnk_search.result.depth = ponder_cache[i].depth;
+            mnk_search.result.score = ponder_cache[i].score;
+            mnk_search.result.nodes = 0;
+            return true;
         }
     }
-    
-    // Verificar diagonal principal
-    if (board[0] != CELL_EMPTY && 
-        board[0] == board[4] && 
-        board[0] == board[8]) {
-        return (board[0] == CELL_PLAYER2) ? 10 : -10;
+    return false;
+}
+
+/**
+ * @brief  Reglas del 3x3 en el motor m,n,k (se generan la primera vez)
+ */
+static const MNK_Rules_t* Rules3x3(void)
+{
+    if (!rules_3x3_ready) {
+        MNK_InitVariant(&rules_3x3, MNK_VARIANT_3X3);
+        rules_3x3_ready = true;
     }
-    
-    // Verificar diagonal anti
-    if (board[2] != CELL_EMPTY && 
-        board[2] == board[4] && 
-        board[2] == board[6]) {
-        return (board[2] == CELL_PLAYER2) ? 10 : -10;
+    return &rules_3x3;
+}
+
+/**
+ * @brief  Lleva el árbol Monte-Carlo a una posición, reutilizándolo si se puede
+ */
+static void PrepareMcts(const MNK_Rules_t* rules, const MNK_Board_t* board)
+{
+    if (mcts_tree.rules != rules) {
+        MCTS_Init(&mcts_tree, rules, mcts_pool, AI_MCTS_POOL_NODES, AI_MCTS_SEED);
     }
-    
-    return 0;  // No hay ganador aún
+    MCTS_SetRoot(&mcts_tree, board);
 }
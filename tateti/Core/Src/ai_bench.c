@@ -0,0 +1,229 @@
+/**
+ ******************************************************************************
+ * @file    ai_bench.c
+ * @brief   Implementación del benchmark de la IA
+ ******************************************************************************
+ */
+
+#include "ai_bench.h"
+#include "ai.h"
+#include "ai_search.h"
+#include "game_logic.h"
+#include <stdio.h>
+#include <stdlib.h>
+
+/* Variables privadas */
+static Bitboard_t bench_positions[AI_BENCH_MAX_POSITIONS];
+static uint32_t samples[AI_BENCH_MAX_POSITIONS];     // Latencias en ns
+
+static const char* const engine_names[AI_BENCH_NUM_ENGINES] = {
+    "easy", "medium", "hard", "mcts", "search", "overlay", "learned"
+};
+
+/* Prototipos funciones privadas */
+static void PrepareContext(GameContext_t* ctx, const Bitboard_t* board);
+static uint32_t RunOnce(AIBench_Engine_t engine, const Bitboard_t* board, const GameContext_t* ctx);
+static int CompareSamples(const void* a, const void* b);
+static uint32_t TargetClock(void);
+
+/**
+ * @brief  Enumera las posiciones alcanzables con turno del jugador 2
+ * @note   Una posición sin líneas completas se alcanza en cualquier orden de
+ *         jugadas, así que alcanza con recorrer los 3^9 tableros y quedarse
+ *         con los que tienen tantas fichas de P1 como de P2 (empezó P2) o una
+ *         más (empezó P1), sin ganador y con celdas libres
+ * @param  positions: Arreglo de salida
+ * @param  max_positions: Capacidad del arreglo
+ * @retval Cantidad de posiciones
+ */
+uint16_t AIBench_CollectPositions(Bitboard_t positions[], uint16_t max_positions)
+{
+    uint16_t count = 0;
+
+    for (uint16_t code = 0; code < 19683u; code++) {
+        Bitboard_t board = {0, 0};
+        uint16_t rest = code;
+
+        for (uint8_t i = 0; i < BB_NUM_CELLS; i++) {
+            uint8_t cell = (uint8_t)(rest % 3u);
+            rest /= 3u;
+            if (cell == 1u) board.p1 |= (uint16_t)(1u << i);
+            if (cell == 2u) board.p2 |= (uint16_t)(1u << i);
+        }
+
+        uint8_t n1 = Bitboard_Count(board.p1);
+        uint8_t n2 = Bitboard_Count(board.p2);
+        if ((n1 != n2 && n1 != n2 + 1u) || Bitboard_Empty(&board) == 0 ||
+            Bitboard_HasWin(board.p1) || Bitboard_HasWin(board.p2)) {
+            continue;
+        }
+
+        if (count < max_positions) {
+            positions[count] = board;
+        }
+        count++;
+    }
+    return (count < max_positions) ? count : max_positions;
+}
+
+/**
+ * @brief  Mide un motor sobre una lista de posiciones
+ * @param  engine: Motor a medir
+ * @param  positions: Posiciones con turno de P2
+ * @param  count: Cantidad de posiciones (hasta AI_BENCH_MAX_POSITIONS)
+ * @param  clock: Reloj libre
+ * @param  ticks_per_us: Ticks del reloj por microsegundo
+ * @param  result: Estadísticas resultantes
+ */
+void AIBench_RunEngine(AIBench_Engine_t engine, const Bitboard_t positions[], uint16_t count,
+                       AIBench_Clock_t clock, uint32_t ticks_per_us, AIBench_Result_t* result)
+{
+    uint64_t total_ns = 0;
+    uint64_t total_nodes = 0;
+
+    if (count > AI_BENCH_MAX_POSITIONS) {
+        count = AI_BENCH_MAX_POSITIONS;
+    }
+    AI_SetSeed(AI_BENCH_SEED);
+    if (engine <= AI_BENCH_MCTS) {
+        static const AI_Difficulty_t levels[] = {AI_EASY, AI_MEDIUM, AI_HARD, AI_MCTS};
+        AI_SetDifficulty(levels[engine]);
+    } else if (engine == AI_BENCH_LEARNED) {
+        AI_SetDifficulty(AI_LEARNED);
+    }
+
+    for (uint16_t i = 0; i < count; i++) {
+        GameContext_t ctx;
+        PrepareContext(&ctx, &positions[i]);
+
+        uint32_t start = clock();
+        uint32_t nodes = RunOnce(engine, &positions[i], &ctx);
+        uint32_t ticks = clock() - start;
+
+        samples[i] = (uint32_t)(((uint64_t)ticks * 1000u) / ticks_per_us);
+        total_ns += samples[i];
+        total_nodes += nodes;
+    }
+
+    qsort(samples, count, sizeof(samples[0]), CompareSamples);
+
+    result->engine = engine;
+    result->positions = count;
+    if (count == 0) {
+        result->min_ns = result->median_ns = result->p99_ns = result->max_ns = 0;
+    } else {
+        result->min_ns = samples[0];
+        result->median_ns = samples[count / 2u];
+        result->p99_ns = samples[((uint32_t)count * 99u + 99u) / 100u - 1u];
+        result->max_ns = samples[count - 1u];
+    }
+    result->total_us = (uint32_t)(total_ns / 1000u);
+    result->total_nodes = (uint32_t)total_nodes;
+    result->nodes_per_s = (total_ns == 0) ? 0 : (uint32_t)((total_nodes * 1000000000ULL) / total_ns);
+}
+
+/**
+ * @brief  Nombre de un motor (columna "engine" del CSV)
+ */
+const char* AIBench_EngineName(AIBench_Engine_t engine)
+{
+    return (engine < AI_BENCH_NUM_ENGINES) ? engine_names[engine] : "?";
+}
+
+/**
+ * @brief  Imprime el encabezado del CSV
+ */
+void AIBench_PrintHeader(void)
+{
+    printf("engine,positions,min_ns,median_ns,p99_ns,max_ns,total_us,nodes,nodes_per_s\n");
+}
+
+/**
+ * @brief  Imprime una fila del CSV
+ */
+void AIBench_PrintResult(const AIBench_Result_t* result)
+{
+    printf("%s,%lu,%lu,%lu,%lu,%lu,%lu,%lu,%lu\n", AIBench_EngineName(result->engine),
+           (unsigned long)result->positions, (unsigned long)result->min_ns,
+           (unsigned long)result->median_ns, (unsigned long)result->p99_ns,
+           (unsigned long)result->max_ns, (unsigned long)result->total_us,
+           (unsigned long)result->total_nodes, (unsigned long)result->nodes_per_s);
+}
+
+/**
+ * @brief  Corre el benchmark en la placa con el contador de ciclos DWT
+ * @note   La salida va por printf (USART3). Restaura el nivel de dificultad.
+ * @param  engine_mask: Motores a medir (bit n = AIBench_Engine_t n)
+ */
+void AIBench_RunTarget(uint32_t engine_mask)
+{
+    AI_Difficulty_t saved = AI_GetDifficulty();
+    uint16_t count = AIBench_CollectPositions(bench_positions, AI_BENCH_MAX_POSITIONS);
+    AIBench_Result_t result;
+
+    CoreDebug->DEMCR |= CoreDebug_DEMCR_TRCENA_Msk;
+    DWT->CTRL |= DWT_CTRL_CYCCNTENA_Msk;
+
+    AIBench_PrintHeader();
+    for (uint8_t e = 0; e < AI_BENCH_NUM_ENGINES; e++) {
+        if (engine_mask & (1u << e)) {
+            AIBench_RunEngine((AIBench_Engine_t)e, bench_positions, count, TargetClock,
+                              SystemCoreClock / 1000000u, &result);
+            AIBench_PrintResult(&result);
+        }
+    }
+
+    AI_SetDifficulty(saved);
+}
+
+/**
+ * @brief  Arma el contexto de partida de una posición (fuera de la medición)
+ */
+static void PrepareContext(GameContext_t* ctx, const Bitboard_t* board)
+{
+    GameCtx_Init(ctx);
+    for (uint8_t i = 0; i < BB_NUM_CELLS; i++) {
+        if (board->p1 & (1u << i)) GameCtx_MakeMove(ctx, i, CELL_PLAYER1);
+        if (board->p2 & (1u << i)) GameCtx_MakeMove(ctx, i, CELL_PLAYER2);
+    }
+}
+
+/**
+ * @brief  Calcula una jugada con el motor indicado (nivel ya configurado)
+ * @retval Nodos visitados (en AI_EASY, AI_MEDIUM y AI_HARD los de la búsqueda
+ *         de respaldo para posiciones fuera de la tabla, tiene que dar 0; en
+ *         AI_MCTS, simulaciones; en overlay, también los de respaldo)
+ */
+static uint32_t RunOnce(AIBench_Engine_t engine, const Bitboard_t* board, const GameContext_t* ctx)
+{
+    AISearch_ResetNodeCount();
+
+    if (engine == AI_BENCH_SEARCH) {
+        AISearch_BestMove(*board, true, NULL);
+        return AISearch_GetNodeCount();
+    }
+    if (engine == AI_BENCH_OVERLAY) {
+        // Nodos: solo los de posiciones fuera de la tabla (tiene que dar 0)
+        AI_MoveValues_t values;
+        AI_EvaluateMoves(ctx, CELL_PLAYER2, &values);
+        return AISearch_GetNodeCount();
+    }
+
+    AI_CalculateMoveCtx(ctx);
+    return AI_GetLastNodeCount();
+}
+
+static int CompareSamples(const void* a, const void* b)
+{
+    uint32_t x = *(const uint32_t*)a;
+    uint32_t y = *(const uint32_t*)b;
+    return (x > y) - (x < y);
+}
+
+/**
+ * @brief  Reloj de la placa: contador de ciclos DWT
+ */
+static uint32_t TargetClock(void)
+{
+    return DWT->CYCCNT;
+}
@@ -0,0 +1,41 @@
+/**
+ ******************************************************************************
+ * @file    ai_policy.c
+ * @brief   Consulta de la política aprendida
+ ******************************************************************************
+ */
+
+#include "ai_policy.h"
+#include "ai_table.h"
+
+/**
+ * @brief  Elige la jugada del jugador 2 con la política aprendida
+ * @param  board: Tablero actual (debe ser turno del jugador 2)
+ * @param  move_out: Celda libre de mayor preferencia (a igual preferencia,
+ *         la de menor índice en el tablero real)
+ * @retval true si la posición está en la tabla, false en caso contrario
+ */
+bool AIPolicy_Move(const Bitboard_t* board, uint8_t* move_out)
+{
+    uint16_t index;
+    uint8_t sym;
+
+    if (!AITable_Find(board, &index, &sym) || index >= AI_PolicySize) {
+        return false;
+    }
+
+    const uint8_t* prefs = AI_PolicyPrefs[index];
+    uint16_t empty = Bitboard_Empty(board);
+    int16_t best = -1;
+
+    while (empty) {
+        uint8_t cell = Bitboard_PopLowest(&empty);
+        uint8_t canonical = (uint8_t)__builtin_ctz(Bitboard_Transform((uint16_t)(1u << cell), sym));
+
+        if ((int16_t)prefs[canonical] > best) {
+            best = prefs[canonical];
+            *move_out = cell;
+        }
+    }
+    return best >= 0;
+}
@@ -0,0 +1,646 @@
+/**
+ ******************************************************************************
+ * @file    ai_policy_data.c
+ * @brief   Política aprendida (GENERADO por Tools/ai_rltrain.c)
+ ******************************************************************************
+ * @attention
+ *
+ * 1000000 episodios, alpha 0.250, gamma 0.900, epsilon 1.00 -> 0.10.
+ * Posiciones con juego óptimo: 627 de 627.
+ *
+ ******************************************************************************
+ */
+
+#include "ai_policy.h"
+
+const uint16_t AI_PolicySize = 627;
+
+const uint8_t AI_PolicyPrefs[627][BB_NUM_CELLS] = {
+    {128, 128, 128, 128, 128, 128, 128, 128, 128},
+    {  0,  53,  53,  53, 128,  53,  53,  53,  53},
+    {128,   0, 128,  53, 128,  53,  53, 128,  53},
+    {128,  53, 128,  53,   0,  53, 128,  53, 128},
+    {  0,   0, 128, 211, 211, 128, 211, 128, 128},
+    {  0,   0,  53, 128, 128,  53, 128,  53, 128},
+    {  0,  53,   0, 211, 128, 128, 211, 128, 211},
+    {211,   0,  53,   0, 211, 128, 128,  53, 128},
+    {  0, 128, 128, 128,   0, 128, 128, 128, 128},
+    {  0, 128, 128, 128,   0, 128, 128, 128, 128},
+    {128,   0, 128, 128,   0, 128, 128,  53, 128},
+    {211,   0, 211, 211,   0, 211, 211, 128, 211},
+    {  0,  53, 211, 128, 211,   0, 211, 128, 128},
+    {211,   0,  53,  53, 128,  53,   0,  53, 128},
+    {128,   0, 128, 128, 128, 128, 128,   0, 128},
+    {  0,  53, 211,  53, 128, 128, 211, 128,   0},
+    {  0,   0,   0, 211, 128,  35, 211, 128,  35},
+    {  0,   0,   0,  35, 128,  35,  35,  35,  35},
+    {  0,   0,  35,   0, 128, 128,  35, 128,  35},
+    {  0,   0,  14,   0,  14,  14,  35,  14,  14},
+    {  0,  35,   0,   0, 128, 128,  35,  35,  35},
+    { 35,   0,   0,   0, 128,  35,  35,  35,  35},
+    {  0,   0,  14,  14,   0,  14,  14, 128,  14},
+    {  0,   0,  14,  14,   0,  14,  14,  14,  35},
+    {  0,   0, 128,  14,   0,  14,  14,  14,  14},
+    {  0,  14,   0,  14,   0,  14, 128,  14,  14},
+    {  0, 128,   0,  14,   0,  14,  14,  14,  14},
+    { 14,   0,  14,   0,   0,  35,  14,  14,  14},
+    {128,   0, 128,   0,   0,  35, 128,  35,  35},
+    {128, 128,   0,   0,   0,  35, 128, 128,  35},
+    {  0,   0,  35,  53, 128,   0, 211, 128,  35},
+    {  0,  14,   0,  14,  14,   0,  14,  14,  35},
+    {  0,  14,  14,   0, 211,   0,  14,  14,  14},
+    { 14,   0,  14,   0, 211,   0,  14,  14,  14},
+    {  0,  14,  14, 128,   0,   0,  14,  14,  14},
+    {211, 211, 211,   0,   0,   0, 211, 211, 211},
+    {  0,   0,  14,  35,  14,  14,   0,  14,  14},
+    {  0,  14,   0,  14,  35,  14,   0,  14,  14},
+    { 14,   0,   0,  14, 128,  14,   0,  14,  14},
+    {211,   0,  14,   0,  14,  14,   0,  14,  14},
+    { 14,   0,  35,  14,   0,  14,   0,  14,  14},
+    { 35, 128,   0, 128,   0, 128,   0, 128,  35},
+    {  0,  35, 128,  35,  35,   0,   0,  35,  35},
+    { 35,   0,  53,  35, 128,   0,   0,  35,  35},
+    {  0,   0,  35,  35,  35,  35, 128,   0, 128},
+    { 53,   0,  53,   0,  35,  35, 128,   0, 128},
+    {128,   0, 128,  35,   0,  35, 128,   0, 128},
+    {  0,  53, 211,  53,  35,   0, 211,   0,  35},
+    { 14,   0,  14,  14,  14,  14,   0,   0, 128},
+    {  0,   0,  35,  53, 128,  35, 128, 128,   0},
+    {  0,  14,   0,  14,  14,  35,  14,  14,   0},
+    {  0,  35, 128,  35,   0,  35, 128,  35,   0},
+    {  0,  14, 211,  14,  14,   0,  14,  14,   0},
+    { 14,   0,  14,  14,  14,  14,   0,  35,   0},
+    {  0,   0,   0,   0, 231, 128,  35,  35,  35},
+    {  0,   0,   0,   0, 231, 128,  35, 128, 231},
+    {  0,   0,   0,   0, 231,  35,  35,  35, 128},
+    {  0,   0,   0,   0, 231, 231,  35, 211, 211},
+    {  0,   0,   0,  14,   0,  14, 128,  14,  14},
+    {  0,   0,   0,  14,   0,  14,  14, 128,  14},
+    {  0,   0,   0, 231,   0, 231, 231, 128, 255},
+    {  0,   0,   0, 231,   0, 231, 128, 255, 128},
+    {  0,   0, 255,   0,   0, 128,  14,  14,  14},
+    {  0,   0,  14,   0,   0,  14,  14,  14, 128},
+    {  0,   0, 231,   0,   0, 128, 231, 128, 255},
+    {  0,   0,  14,   0,   0,  14, 231, 255,  14},
+    {  0, 255,   0,   0,   0, 231,  14,  14,  14},
+    {  0,  14,   0,   0,   0,  14,  14,  14, 128},
+    {  0, 231,   0,   0,   0, 128, 128, 231, 255},
+    { 14,   0,   0,   0,   0,  14, 128,  14,  14},
+    { 14,   0,   0,   0,   0,  14,  14, 128,  14},
+    {231,   0,   0,   0,   0, 128, 128, 255, 231},
+    {  0,   0,   0,  14,  14,   0,  14,  14,  35},
+    {  0,   0, 255,   0, 231,   0,  14,  14,  14},
+    {  0,   0, 128,   0, 128,   0,  35, 128, 128},
+    {  0,   0, 231,   0, 255,   0,  14,  14,  14},
+    {  0, 255,   0,   0, 231,   0,  14,  14,  14},
+    {  0, 128,   0,   0, 128,   0, 128, 128, 128},
+    {  0,  35,   0,   0, 255,   0,  14,  14,  14},
+    { 14,   0,   0,   0,  14,   0,  14,  14, 211},
+    {128,   0,   0,   0, 128,   0, 231, 128, 128},
+    {  0,   0, 255, 231,   0,   0,  14,  14,  14},
+    {  0,   0, 231, 231,   0,   0, 231, 128, 255},
+    {  0,  14,   0,  14,   0,   0,  14,  14, 255},
+    {  0, 231, 231,   0,   0,   0, 231, 231, 255},
+    {  0,  14,  14,   0,   0,   0,  14,  14,  35},
+    {231,   0, 128,   0,   0,   0, 128,  35, 128},
+    {231,   0, 231,   0,   0,   0, 231, 255, 231},
+    { 14,   0,  14,   0,   0,   0,  14,  35,  14},
+    {231, 128,   0,   0,   0,   0, 128, 128, 128},
+    {  0,   0,   0,  14, 231,  14,   0,  14,  14},
+    {  0,   0,   0,  35, 128, 128,   0, 128, 231},
+    {  0,   0,   0,  35, 255, 231,   0, 231, 231},
+    {  0,   0, 255,   0, 231, 211,   0, 231, 231},
+    {  0, 255,   0,   0, 231, 231,   0, 211, 231},
+    {  0,  35,   0,   0, 128, 231,   0, 128, 128},
+    { 14,   0,   0,   0, 231,  14,   0,  14,  14},
+    { 35,   0,   0,   0, 128, 231,   0, 128, 128},
+    { 35,   0,   0,   0, 255, 231,   0, 231, 231},
+    {  0,   0, 255,  14,   0,  14,   0,  14,  14},
+    {  0,   0,  14, 231,   0,  14,   0, 255,  14},
+    {  0, 255,   0, 128,   0, 231,   0, 128, 231},
+    {  0, 231,   0, 231,   0, 231,   0, 231, 255},
+    {  0,  14,   0,  14,   0,  14,   0,  14, 231},
+    {231,   0,   0, 231,   0, 231,   0, 255, 231},
+    { 14,   0,   0,  14,   0,  14,   0, 128,  14},
+    {231,   0,  14,   0,   0,  14,   0, 255,  14},
+    {128, 128,   0,   0,   0,  35,   0, 128, 128},
+    {  0,   0, 255,  35, 231,   0,   0, 231, 231},
+    {  0, 255,   0, 128, 231,   0,   0, 128, 231},
+    {  0,  35,   0, 128, 255,   0,   0, 231, 231},
+    {231,   0,   0, 231, 255,   0,   0, 231, 231},
+    {  0,  35, 231,   0, 255,   0,   0,  35, 231},
+    { 35,   0, 128,   0, 128,   0,   0, 128, 128},
+    { 35,   0, 231,   0, 255,   0,   0, 128, 231},
+    {128, 128,   0,   0, 128,   0,   0, 128, 128},
+    { 14,  14,   0,   0, 255,   0,   0,  14,  14},
+    { 14,  14,   0,   0, 255,   0,   0,  14,  14},
+    {  0, 231, 231,  35,   0,   0,   0, 231, 255},
+    {231,   0, 231, 128,   0,   0,   0, 255, 231},
+    {  0,   0,   0,  35,  35,  35, 128,   0, 128},
+    {  0,   0,   0,  14, 231,  14,  14,   0,  14},
+    {  0,   0, 255,   0, 231, 128, 128,   0, 231},
+    {  0, 255,   0,   0, 231, 231, 231,   0, 231},
+    {  0,  35,   0,   0, 231, 231,  35,   0, 128},
+    { 14,   0,   0,   0, 231,  14,  14,   0,  14},
+    {  0,   0, 255, 231,   0, 128, 231,   0, 128},
+    {  0,   0,  35, 128,   0, 128, 128,   0, 128},
+    {  0, 255,   0,  14,   0,  14,  14,   0,  14},
+    {231,   0, 231,   0,   0,  35, 128,   0, 128},
+    { 14, 128,   0,   0,   0,  14,  14,   0,  14},
+    {  0,   0, 255, 231, 231,   0, 231,   0, 231},
+    {231,   0, 128,   0,  35,   0, 128,   0, 128},
+    { 14,   0,  14,   0, 255,   0,  14,   0,  14},
+    {231, 128,   0,   0, 128,   0, 231,   0, 128},
+    {  0, 231, 231, 231,   0,   0, 231,   0, 255},
+    {  0,   0, 255,  14,  14,  14,   0,   0, 231},
+    {  0, 255,   0,  14,  14,  14,   0,   0, 231},
+    { 14,  14,   0,   0,  14,  14,   0,   0, 211},
+    { 14,   0,  14,  14,   0,  14,   0,   0, 128},
+    {  0,   0,   0,  14,  14,  35,  14,  14,   0},
+    {  0,   0, 255,   0, 231, 128, 128, 231,   0},
+    {  0,   0,  14,   0, 231,  14,  14,  14,   0},
+    {  0,  14,   0,   0, 231,  14,  14,  14,   0},
+    { 14,   0,   0,   0,  14,  35,  14,  14,   0},
+    {128,   0,   0,   0, 231,  35, 231, 128,   0},
+    {  0,   0, 255, 231,   0, 128, 231,  35,   0},
+    {  0,   0, 128, 231,   0, 128, 231, 128,   0},
+    {  0,  14,   0,  14,   0, 128,  14,  14,   0},
+    {231,   0,  14,   0,   0,  14,  14,  14,   0},
+    {231,  14,   0,   0,   0,  14,  14,  14,   0},
+    {  0,   0, 255,  14,  14,   0,  14,  14,   0},
+    { 14,   0, 211,   0,  14,   0,  14,  14,   0},
+    {231, 211,   0,   0, 128,   0, 231, 211,   0},
+    {  0,  14, 231,  14,   0,   0,  14,  14,   0},
+    {  0,   0, 255,  14,  14,  14,   0, 231,   0},
+    {  0, 255,   0,  14,  14,  14,   0, 128,   0},
+    {  0,  14,   0,  14, 255,  14,   0,  14,   0},
+    { 14,  14,   0,   0,  14,  14,   0, 128,   0},
+    { 14,   0,  14,  14,   0,  14,   0, 255,   0},
+    {  0,   0, 255,  14,  14,  14, 231,   0,   0},
+    { 14,  14,   0,   0,  14,  14, 231,   0,   0},
+    {  0,   0,   0,   0,   0,  14,  14,  14,  14},
+    {  0,   0,   0,   0,   0,  14,  14,  14,  14},
+    {  0,   0,   0,   0,   0,  14,  14,  14,  14},
+    {  0,   0,   0,   0,   0,  14,  14,  14,  14},
+    {  0,   0,   0,   0,   0, 128, 128, 128, 255},
+    {  0,   0,   0,   0,   0,  14, 128, 255,  14},
+    {  0,   0,   0,   0,  14,   0,  14,  14,  14},
+    {  0,   0,   0,   0, 231,   0,  14,  14,  14},
+    {  0,   0,   0,   0,  14,   0,  14,  14, 128},
+    {  0,   0,   0,   0, 128,   0,  35, 128, 128},
+    {  0,   0,   0,  14,   0,   0,  14,  14,  14},
+    {  0,   0,   0,  14,   0,   0,  14,  14, 255},
+    {  0,   0,  14,   0,   0,   0,  14,  14, 128},
+    {  0,   0, 231,   0,   0,   0, 231, 128, 255},
+    {  0,   0,  14,   0,   0,   0, 231, 255,  14},
+    {  0,   0,  14,   0,   0,   0,  14,  14,  14},
+    {  0,  14,   0,   0,   0,   0,  14,  14, 128},
+    {  0,  14,   0,   0,   0,   0,  14,  14, 255},
+    {  0,  14,   0,   0,   0,   0,  14,  14,  14},
+    { 14,   0,   0,   0,   0,   0,  14,  14,  14},
+    { 14,   0,   0,   0,   0,   0,  14, 128,  14},
+    {  0,   0,   0,   0, 231,  14,   0,  14,  14},
+    {  0,   0,   0,   0, 128, 128,   0, 128, 231},
+    {  0,   0,   0,   0, 231,  14,   0,  14,  14},
+    {  0,   0,   0,   0, 128, 231,   0, 128, 128},
+    {  0,   0,   0,   0, 255, 231,   0, 231, 231},
+    {  0,   0,   0,  14,   0,  14,   0, 128,  14},
+    {  0,   0,   0, 231,   0, 231,   0, 128, 255},
+    {  0,   0,   0, 231,   0,  14,   0, 255,  14},
+    {  0,   0,   0,  14,   0,  14,   0,  14,  14},
+    {  0,   0, 255,   0,   0,  14,   0,  14,  14},
+    {  0, 255,   0,   0,   0, 231,   0,  14,  14},
+    {  0,  14,   0,   0,   0,  14,   0,  14, 128},
+    { 14,   0,   0,   0,   0,  14,   0, 128,  14},
+    {231,   0,   0,   0,   0,  14,   0, 255,  14},
+    { 14,   0,   0,   0,   0,  14,   0,  14,  14},
+    {  0,   0,   0,  14,  14,   0,   0,  14,  14},
+    {  0,   0,   0,  35, 128,   0,   0, 128,  35},
+    {  0,   0,   0,  35, 255,   0,   0, 231, 231},
+    {  0,   0, 255,   0, 231,   0,   0,  14,  14},
+    {  0,   0,  35,   0, 128,   0,   0,  35, 128},
+    {  0,   0, 231,   0, 255,   0,   0,  14,  14},
+    {  0, 255,   0,   0, 231,   0,   0,  14,  14},
+    {  0,  35,   0,   0, 128,   0,   0, 128, 128},
+    {  0,  14,   0,   0, 255,   0,   0,  14,  14},
+    {  0,  14,   0,   0, 255,   0,   0,  14,  14},
+    { 14,   0,   0,   0,  14,   0,   0,  14,  14},
+    { 35,   0,   0,   0, 128,   0,   0, 128, 128},
+    { 14,   0,   0,   0, 255,   0,   0,  14,  14},
+    { 14,   0,   0,   0, 255,   0,   0,  14,  14},
+    {  0,   0, 255,  14,   0,   0,   0,  14,  14},
+    {  0,   0, 128,  35,   0,   0,   0, 128, 255},
+    {  0,   0,  14, 128,   0,   0,   0, 255,  14},
+    {  0, 255,   0, 128,   0,   0,   0,  14,  14},
+    {  0,  14,   0,  14,   0,   0,   0,  14, 255},
+    {  0,  14,   0,  14,   0,   0,   0,  14,  14},
+    { 14,   0,   0,  14,   0,   0,   0, 255, 231},
+    { 14,   0,   0,  14,   0,   0,   0,  14,  14},
+    {  0, 231, 231,   0,   0,   0,   0, 231, 255},
+    {  0,  14,  14,   0,   0,   0,   0,  14,  14},
+    { 14,   0, 128,   0,   0,   0,   0,  14,  14},
+    {231,   0,  14,   0,   0,   0,   0, 255,  14},
+    { 14,   0,  14,   0,   0,   0,   0,  14,  14},
+    {128, 128,   0,   0,   0,   0,   0, 128, 128},
+    {  0,   0,   0,   0,  35,  35,  35,   0,  35},
+    {  0,   0,   0,   0, 231,  14,  14,   0,  14},
+    {  0,   0,   0,   0, 231,  14,  14,   0,  14},
+    {  0,   0,   0,  14,   0,  14, 128,   0,  14},
+    {  0,   0,   0, 128,   0, 128, 128,   0, 128},
+    {  0,   0, 255,   0,   0, 128,  14,   0,  14},
+    {  0,   0,  14,   0,   0,  14, 128,   0,  14},
+    {  0, 255,   0,   0,   0,  14,  14,   0,  14},
+    {  0,  14,   0,   0,   0,  14,  14,   0,  14},
+    { 35,   0,   0,   0,   0,  35, 128,   0, 128},
+    {  0,   0,   0,  14,  14,   0,  14,   0,  35},
+    {  0,   0, 255,   0, 231,   0,  14,   0,  14},
+    {  0,   0,  35,   0,  35,   0,  35,   0, 128},
+    {  0,   0,  14,   0, 255,   0,  14,   0,  14},
+    {  0, 255,   0,   0, 231,   0,  14,   0,  14},
+    {  0,  35,   0,   0, 128,   0,  35,   0, 128},
+    {  0,  35,   0,   0, 255,   0,  14,   0,  14},
+    { 14,   0,   0,   0,  14,   0,  14,   0, 128},
+    { 14,   0,   0,   0, 128,   0,  14,   0,  14},
+    {  0,   0, 255, 231,   0,   0,  14,   0,  14},
+    {  0,   0, 231, 231,   0,   0, 231,   0, 255},
+    {  0,  14,   0,  14,   0,   0,  14,   0, 255},
+    {231,   0, 128,   0,   0,   0, 128,   0, 128},
+    {231,   0, 231,   0,   0,   0, 128,   0, 128},
+    { 14, 128,   0,   0,   0,   0,  14,   0,  14},
+    {  0,   0,   0,  14,  14,  14,   0,   0,  14},
+    {  0,   0,   0,  14,  14,  14,   0,   0,  14},
+    {  0,   0, 255,   0,  14,  14,   0,   0, 231},
+    {  0, 255,   0,   0,  14,  14,   0,   0, 231},
+    {  0,  14,   0,   0,  14,  14,   0,   0, 128},
+    { 14,   0,   0,   0,  14,  14,   0,   0,  14},
+    {  0,   0, 255,  14,   0,  14,   0,   0,  14},
+    {  0,   0,  14,  14,   0,  14,   0,   0,  14},
+    {  0, 255,   0,  14,   0,  14,   0,   0,  14},
+    { 14,   0,   0,  14,   0,  14,   0,   0, 128},
+    { 14,   0,  14,   0,   0,  14,   0,   0,  14},
+    { 14,  14,   0,   0,   0,  14,   0,   0,  14},
+    {  0,   0, 255,  14,  14,   0,   0,   0, 231},
+    {  0, 255,   0,  14,  14,   0,   0,   0, 231},
+    {  0,  35,   0,  35, 255,   0,   0,   0,  35},
+    { 14,  14,   0,   0,  14,   0,   0,   0, 128},
+    { 14,   0,  14,  14,   0,   0,   0,   0, 128},
+    {  0,   0,   0,   0,  14,  35,  14,  14,   0},
+    {  0,   0,   0,   0,  14,  14,  14,  14,   0},
+    {  0,   0,   0,   0, 231,  14,  14,  14,   0},
+    {  0,   0,   0,  14,   0,  14,  14,  14,   0},
+    {  0,   0,   0,  14,   0, 128,  14,  14,   0},
+    {  0,   0, 255,   0,   0, 128,  14,  14,   0},
+    {  0,   0, 128,   0,   0, 128, 128, 128,   0},
+    {  0,  14,   0,   0,   0, 128,  14,  14,   0},
+    { 14,   0,   0,   0,   0,  14,  14,  14,   0},
+    { 14,   0,   0,   0,   0,  14,  14,  14,   0},
+    {  0,   0, 255,   0,  14,   0,  14,  14,   0},
+    {  0,   0,  14,   0,  14,   0,  14,  14,   0},
+    {  0,  14,   0,   0, 128,   0,  14,  14,   0},
+    {128,   0,   0,   0, 128,   0, 231, 128,   0},
+    {  0,   0, 255,  14,   0,   0,  14,  14,   0},
+    {  0,   0, 128,  14,   0,   0,  14,  14,   0},
+    {  0,  14, 231,   0,   0,   0,  14,  14,   0},
+    { 14,   0,  14,   0,   0,   0,  14,  14,   0},
+    {231,  14,   0,   0,   0,   0,  14,  14,   0},
+    {  0,   0,   0,  14,  14,  14,   0,  14,   0},
+    {  0,   0,   0,  14,  14,  14,   0, 128,   0},
+    {  0,   0,   0,  14, 255,  14,   0,  14,   0},
+    {  0,   0, 255,   0,  14,  14,   0, 231,   0},
+    {  0, 255,   0,   0,  14,  14,   0, 128,   0},
+    {  0,  14,   0,   0,  14,  14,   0,  14,   0},
+    { 14,   0,   0,   0,  14,  14,   0,  14,   0},
+    { 14,   0,   0,   0,  14,  14,   0, 128,   0},
+    {  0,   0, 255,  14,   0,  14,   0,  14,   0},
+    {  0,   0,  14,  14,   0,  14,   0, 255,   0},
+    {  0, 255,   0,  14,   0,  14,   0, 128,   0},
+    {  0,  14,   0,  14,   0,  14,   0,  14,   0},
+    { 14,   0,  14,   0,   0,  14,   0, 255,   0},
+    { 14,  14,   0,   0,   0,  14,   0,  14,   0},
+    {  0,   0, 255,  14,  14,   0,   0,  14,   0},
+    { 14,   0,  14,   0,  14,   0,   0,  14,   0},
+    { 14,  14,   0,   0,  14,   0,   0, 128,   0},
+    {  0,  14,  14,  14,   0,   0,   0,  14,   0},
+    {  0,   0,   0,  14,  14,  14,  14,   0,   0},
+    {  0,   0, 255,   0,  14,  14, 128,   0,   0},
+    {  0,  14,   0,   0,  14,  14,  14,   0,   0},
+    { 14,   0,   0,   0,  14,  14,  14,   0,   0},
+    {  0,   0, 255,  14,   0,  14, 231,   0,   0},
+    { 14,  14,   0,   0,   0,  14,  14,   0,   0},
+    {  0,   0, 255,  14,  14,   0,  14,   0,   0},
+    { 14,   0,  14,   0,  14,   0,  14,   0,   0},
+    { 14,  14,   0,   0,  14,   0, 231,   0,   0},
+    {  0,  14,  14,  14,   0,   0,  14,   0,   0},
+    {  0,   0,   0,   0,   0,   0, 255,  14,  14},
+    {  0,   0,   0,   0,   0,   0, 255, 128,  14},
+    {  0,   0,   0,   0,   0,   0,  14,  14, 128},
+    {  0,   0,   0,   0,   0,   0,  14, 255, 255},
+    {  0,   0,   0,   0,   0,   0, 255, 231, 255},
+    {  0,   0,   0,   0,   0,   0,  14, 255, 128},
+    {  0,   0,   0,   0,   0,   0, 255, 128, 128},
+    {  0,   0,   0,   0,   0,   0, 255,  14,  14},
+    {  0,   0,   0,   0,   0,   0,  14,  14,  14},
+    {  0,   0,   0,   0,   0,  14,   0, 128,  14},
+    {  0,   0,   0,   0,   0,  14,   0,  14, 128},
+    {  0,   0,   0,   0,   0, 231,   0, 255, 255},
+    {  0,   0,   0,   0,   0, 128,   0, 128, 255},
+    {  0,   0,   0,   0,   0, 255,   0, 255, 231},
+    {  0,   0,   0,   0,   0, 255,   0, 128, 128},
+    {  0,   0,   0,   0,   0,  14,   0,  14,  14},
+    {  0,   0,   0,   0,   0,  14,   0,  14,  14},
+    {  0,   0,   0,   0,  14,   0,   0,  14,  14},
+    {  0,   0,   0,   0, 128,   0,   0, 128, 128},
+    {  0,   0,   0,   0, 128,   0,   0, 128, 128},
+    {  0,   0,   0,   0, 255,   0,   0,  14,  14},
+    {  0,   0,   0,   0, 255,   0,   0,  14,  14},
+    {  0,   0,   0,   0, 255,   0,   0,  14,  14},
+    {  0,   0,   0,   0, 255,   0,   0,  14,  14},
+    {  0,   0,   0,   0, 128,   0,   0, 128, 231},
+    {  0,   0,   0,   0, 128,   0,   0, 231, 128},
+    {  0,   0,   0,  14,   0,   0,   0, 255, 255},
+    {  0,   0,   0, 128,   0,   0,   0, 128, 255},
+    {  0,   0,   0, 255,   0,   0,   0,  14,  14},
+    {  0,   0,   0,  14,   0,   0,   0,  14,  14},
+    {  0,   0,   0, 255,   0,   0,   0, 231,  14},
+    {  0,   0,   0,  14,   0,   0,   0,  14, 128},
+    {  0,   0, 255,   0,   0,   0,   0,  14,  14},
+    {  0,   0, 255,   0,   0,   0,   0, 255, 255},
+    {  0,   0, 128,   0,   0,   0,   0, 255, 128},
+    {  0,   0,  14,   0,   0,   0,   0,  14,  14},
+    {  0,   0,  14,   0,   0,   0,   0,  14,  14},
+    {  0,   0,  14,   0,   0,   0,   0, 128,  14},
+    {  0,   0,  14,   0,   0,   0,   0,  14, 231},
+    {  0, 255,   0,   0,   0,   0,   0, 128, 128},
+    {  0, 255,   0,   0,   0,   0,   0, 231, 255},
+    {  0, 128,   0,   0,   0,   0,   0, 128, 128},
+    {  0, 128,   0,   0,   0,   0,   0, 128, 128},
+    {255,   0,   0,   0,   0,   0,   0, 128, 128},
+    { 14,   0,   0,   0,   0,   0,   0, 255, 231},
+    {128,   0,   0,   0,   0,   0,   0, 128, 128},
+    {128,   0,   0,   0,   0,   0,   0, 128, 128},
+    {  0,   0,   0,   0,   0,  14,  14,   0, 128},
+    {  0,   0,   0,   0,   0, 128, 128,   0, 255},
+    {  0,   0,   0,   0,   0, 231, 255,   0, 255},
+    {  0,   0,   0,   0,   0, 255, 255,   0, 231},
+    {  0,   0,   0,   0,  14,   0, 255,   0, 231},
+    {  0,   0,   0,   0, 231,   0, 255,   0,  14},
+    {  0,   0,   0,   0, 128,   0, 128,   0, 128},
+    {  0,   0,   0,   0, 255,   0, 255,   0,  14},
+    {  0,   0,   0,   0, 255,   0, 128,   0, 128},
+    {  0,   0,   0,  14,   0,   0,  14,   0, 255},
+    {  0,   0, 255,   0,   0,   0, 255,   0, 231},
+    {  0,   0, 255,   0,   0,   0, 231,   0, 255},
+    {  0,   0, 128,   0,   0,   0, 128,   0, 128},
+    {  0,   0,  14,   0,   0,   0,  14,   0, 128},
+    {  0, 255,   0,   0,   0,   0, 255,   0,  14},
+    {  0, 255,   0,   0,   0,   0, 255,   0, 255},
+    {  0, 128,   0,   0,   0,   0, 255,   0, 128},
+    {  0,  14,   0,   0,   0,   0, 255,   0,  14},
+    {255,   0,   0,   0,   0,   0, 128,   0, 128},
+    { 14,   0,   0,   0,   0,   0,  14,   0, 128},
+    {231,   0,   0,   0,   0,   0, 255,   0, 231},
+    {  0,   0,   0,   0,  14,  14,   0,   0,  14},
+    {  0,   0,   0,   0,  14,  14,   0,   0, 128},
+    {  0,   0,   0,   0, 255, 231,   0,   0, 231},
+    {  0,   0,   0,  14,   0,  14,   0,   0, 255},
+    {  0,   0,   0,  14,   0,  14,   0,   0, 255},
+    {  0,   0,   0,  14,   0,  14,   0,   0, 128},
+    {  0,   0, 255,   0,   0,  14,   0,   0, 255},
+    {  0, 255,   0,   0,   0,  14,   0,   0,  14},
+    {  0, 255,   0,   0,   0,  14,   0,   0, 255},
+    {  0,  14,   0,   0,   0, 255,   0,   0, 128},
+    {255,   0,   0,   0,   0,  14,   0,   0, 231},
+    { 14,   0,   0,   0,   0, 255,   0,   0, 231},
+    {255,   0,   0,   0,   0, 231,   0,   0,  14},
+    {  0,   0,   0, 255, 255,   0,   0,   0,  14},
+    {  0,   0,   0, 128, 255,   0,   0,   0, 128},
+    {  0,   0,   0, 255, 231,   0,   0,   0,  14},
+    {  0,   0,   0, 128, 128,   0,   0,   0, 128},
+    {  0,   0,  14,   0, 255,   0,   0,   0,  14},
+    {  0,   0,  14,   0, 255,   0,   0,   0, 231},
+    {  0,   0,  14,   0, 231,   0,   0,   0,  14},
+    {  0,   0, 231,   0, 128,   0,   0,   0, 128},
+    {  0, 255,   0,   0,  14,   0,   0,   0, 231},
+    {  0,  14,   0,   0, 255,   0,   0,   0,  14},
+    {  0, 128,   0,   0, 128,   0,   0,   0, 128},
+    {255,   0,   0,   0,  14,   0,   0,   0, 128},
+    { 14,   0,   0,   0, 255,   0,   0,   0,  14},
+    {255,   0,   0,   0, 255,   0,   0,   0,  14},
+    {128,   0,   0,   0, 128,   0,   0,   0, 128},
+    {  0,   0, 255,  14,   0,   0,   0,   0, 255},
+    {  0,   0,  14,  14,   0,   0,   0,   0, 128},
+    {  0, 255,   0,  14,   0,   0,   0,   0, 255},
+    {  0, 255,   0, 255,   0,   0,   0,   0,  14},
+    {  0, 128,   0, 255,   0,   0,   0,   0,  14},
+    {255,   0,   0, 128,   0,   0,   0,   0,  14},
+    {  0,  14,  14,   0,   0,   0,   0,   0,  14},
+    { 14,   0,  14,   0,   0,   0,   0,   0,  14},
+    {128,   0, 231,   0,   0,   0,   0,   0, 128},
+    { 14,  14,   0,   0,   0,   0,   0,   0, 128},
+    {  0,   0,   0,   0,   0,  14, 255,  14,   0},
+    {  0,   0,   0,   0,   0,  14, 255, 128,   0},
+    {  0,   0,   0,   0,   0, 128,  14, 255,   0},
+    {  0,   0,   0,   0,   0, 255,  14, 255,   0},
+    {  0,   0,   0,   0,   0, 255, 255, 231,   0},
+    {  0,   0,   0,   0, 128,   0, 255, 128,   0},
+    {  0,   0,   0,   0, 231,   0,  14,  14,   0},
+    {  0,   0,   0,   0, 255,   0, 255, 231,   0},
+    {  0,   0, 255,   0,   0,   0, 255,  14,   0},
+    {  0,   0, 255,   0,   0,   0,  14, 255,   0},
+    {  0,   0, 231,   0,   0,   0,  14, 255,   0},
+    {  0,   0,  14,   0,   0,   0, 255, 128,   0},
+    {  0, 255,   0,   0,   0,   0, 255, 231,   0},
+    {  0, 231,   0,   0,   0,   0, 255, 231,   0},
+    {  0,  14,   0,   0,   0,   0, 255,  14,   0},
+    {255,   0,   0,   0,   0,   0,  14,  14,   0},
+    {128,   0,   0,   0,   0,   0, 255, 128,   0},
+    {  0,   0,   0,   0,  14,  14,   0,  14,   0},
+    {  0,   0,   0,   0,  14,  14,   0, 128,   0},
+    {  0,   0,   0,   0,  14,  14,   0,  14,   0},
+    {  0,   0,   0,   0, 255, 128,   0, 128,   0},
+    {  0,   0,   0,   0, 255,  14,   0,  14,   0},
+    {  0,   0,   0,  14,   0,  14,   0, 255,   0},
+    {  0,   0,   0,  14,   0,  14,   0, 128,   0},
+    {  0,   0,   0, 255,   0,  14,   0, 128,   0},
+    {  0,   0, 255,   0,   0,  14,   0, 255,   0},
+    {  0, 255,   0,   0,   0,  14,   0, 128,   0},
+    {  0, 255,   0,   0,   0,  14,   0, 128,   0},
+    {  0,  14,   0,   0,   0, 255,   0, 231,   0},
+    {255,   0,   0,   0,   0,  14,   0,  14,   0},
+    { 14,   0,   0,   0,   0, 255,   0, 255,   0},
+    { 14,   0,   0,   0,   0, 255,   0, 128,   0},
+    {255,   0,   0,   0,   0,  14,   0,  14,   0},
+    {  0,   0,   0, 255, 255,   0,   0, 231,   0},
+    {  0,   0,   0,  14, 255,   0,   0,  14,   0},
+    {  0,   0,   0, 255, 128,   0,   0, 128,   0},
+    {  0,   0,   0,  14, 231,   0,   0,  14,   0},
+    {  0,   0, 255,   0,  14,   0,   0,  14,   0},
+    {  0,   0,  14,   0, 255,   0,   0, 128,   0},
+    {  0,   0,  14,   0, 255,   0,   0,  14,   0},
+    {  0,   0,  14,   0, 231,   0,   0,  14,   0},
+    {  0, 255,   0,   0,  14,   0,   0, 128,   0},
+    {  0,  14,   0,   0, 255,   0,   0,  14,   0},
+    {  0, 255,   0,   0, 255,   0,   0,  14,   0},
+    {  0, 128,   0,   0, 128,   0,   0, 128,   0},
+    {255,   0,   0,   0,  14,   0,   0, 231,   0},
+    {255,   0,   0,   0, 255,   0,   0,  14,   0},
+    {  0,   0, 255,  14,   0,   0,   0, 255,   0},
+    {  0, 255,   0, 255,   0,   0,   0,  14,   0},
+    {  0, 128,   0, 255,   0,   0,   0, 128,   0},
+    {255,   0,   0,  14,   0,   0,   0,  14,   0},
+    {  0,  14,  14,   0,   0,   0,   0,  14,   0},
+    { 14,   0,  14,   0,   0,   0,   0, 255,   0},
+    { 14,   0,  14,   0,   0,   0,   0,  14,   0},
+    { 14,  14,   0,   0,   0,   0,   0, 128,   0},
+    {  0,   0,   0,   0,  14,  14, 255,   0,   0},
+    {  0,   0,   0,   0,  14,  14,  14,   0,   0},
+    {  0,   0,   0,  14,   0,  14,  14,   0,   0},
+    {  0,   0, 255,   0,   0,  14, 128,   0,   0},
+    {  0, 255,   0,   0,   0,  14, 255,   0,   0},
+    {  0,  14,   0,   0,   0, 255, 255,   0,   0},
+    {255,   0,   0,   0,   0,  14,  14,   0,   0},
+    { 14,   0,   0,   0,   0, 255, 255,   0,   0},
+    {  0,   0, 255,   0,  14,   0, 255,   0,   0},
+    {  0,   0,  14,   0, 255,   0, 255,   0,   0},
+    {  0, 255,   0,   0,  14,   0, 255,   0,   0},
+    {  0,  14,   0,   0, 255,   0, 255,   0,   0},
+    {255,   0,   0,   0,  14,   0, 231,   0,   0},
+    {  0,   0, 255,  14,   0,   0,  14,   0,   0},
+    {  0,  14,  14,   0,   0,   0, 255,   0,   0},
+    { 14,   0,  14,   0,   0,   0,  14,   0,   0},
+    { 14,  14,   0,   0,   0,   0, 255,   0,   0},
+    {  0,   0,   0,  14, 255,  14,   0,   0,   0},
+    {255,   0,   0,   0, 255, 231,   0,   0,   0},
+    {255,   0,   0,  14,   0,  14,   0,   0,   0},
+    {  0, 255,   0, 255, 255,   0,   0,   0,   0},
+    {255,   0,   0, 231, 255,   0,   0,   0,   0},
+    {  0,   0,   0,   0,   0,   0,   0, 128,  14},
+    {  0,   0,   0,   0,   0,   0,   0,  14, 128},
+    {  0,   0,   0,   0,   0,   0,   0, 255, 255},
+    {  0,   0,   0,   0,   0,   0,   0, 128, 255},
+    {  0,   0,   0,   0,   0,   0,   0, 255, 128},
+    {  0,   0,   0,   0,   0,   0,   0, 128, 128},
+    {  0,   0,   0,   0,   0,   0,   0, 128,  14},
+    {  0,   0,   0,   0,   0,   0,   0,  14, 128},
+    {  0,   0,   0,   0,   0,   0, 255,   0,  14},
+    {  0,   0,   0,   0,   0,   0,  14,   0, 128},
+    {  0,   0,   0,   0,   0,   0,  14,   0, 255},
+    {  0,   0,   0,   0,   0,   0, 255,   0, 255},
+    {  0,   0,   0,   0,   0,   0,  14,   0, 128},
+    {  0,   0,   0,   0,   0,   0, 255,   0, 128},
+    {  0,   0,   0,   0,   0,   0,  14,   0,  14},
+    {  0,   0,   0,   0,   0,  14,   0,   0, 128},
+    {  0,   0,   0,   0,   0,  14,   0,   0, 255},
+    {  0,   0,   0,   0,   0,  14,   0,   0, 255},
+    {  0,   0,   0,   0,   0, 255,   0,   0, 128},
+    {  0,   0,   0,   0,   0,  14,   0,   0,  14},
+    {  0,   0,   0,   0,  14,   0,   0,   0,  14},
+    {  0,   0,   0,   0,  14,   0,   0,   0,  14},
+    {  0,   0,   0,   0,  14,   0,   0,   0, 128},
+    {  0,   0,   0,   0, 255,   0,   0,   0,  14},
+    {  0,   0,   0,   0, 255,   0,   0,   0,  14},
+    {  0,   0,   0,   0, 255,   0,   0,   0,  14},
+    {  0,   0,   0,   0, 255,   0,   0,   0,  14},
+    {  0,   0,   0,   0, 128,   0,   0,   0,  14},
+    {  0,   0,   0,   0, 128,   0,   0,   0, 128},
+    {  0,   0,   0,  14,   0,   0,   0,   0, 255},
+    {  0,   0,   0,  14,   0,   0,   0,   0, 255},
+    {  0,   0,   0,  14,   0,   0,   0,   0,  14},
+    {  0,   0,   0,  14,   0,   0,   0,   0, 128},
+    {  0,   0, 255,   0,   0,   0,   0,   0, 255},
+    {  0,   0,  14,   0,   0,   0,   0,   0,  14},
+    {  0,   0,  14,   0,   0,   0,   0,   0, 128},
+    {  0, 255,   0,   0,   0,   0,   0,   0,  14},
+    {  0, 255,   0,   0,   0,   0,   0,   0, 255},
+    {  0,  14,   0,   0,   0,   0,   0,   0, 128},
+    {  0, 128,   0,   0,   0,   0,   0,   0,  14},
+    {255,   0,   0,   0,   0,   0,   0,   0, 128},
+    { 14,   0,   0,   0,   0,   0,   0,   0, 128},
+    { 14,   0,   0,   0,   0,   0,   0,   0, 128},
+    {128,   0,   0,   0,   0,   0,   0,   0, 128},
+    {  0,   0,   0,   0,   0,   0, 255, 128,   0},
+    {  0,   0,   0,   0,   0,   0, 255, 128,   0},
+    {  0,   0,   0,   0,   0,   0, 255,  14,   0},
+    {  0,   0,   0,   0,   0,  14,   0, 128,   0},
+    {  0,   0,   0,   0,   0,  14,   0, 255,   0},
+    {  0,   0,   0,   0,   0,  14,   0, 128,   0},
+    {  0,   0,   0,   0,   0, 255,   0, 255,   0},
+    {  0,   0,   0,   0,   0, 255,   0, 128,   0},
+    {  0,   0,   0,   0,   0,  14,   0,  14,   0},
+    {  0,   0,   0,   0,  14,   0,   0, 128,   0},
+    {  0,   0,   0,   0,  14,   0,   0,  14,   0},
+    {  0,   0,   0,   0, 255,   0,   0,  14,   0},
+    {  0,   0,   0,   0, 255,   0,   0,  14,   0},
+    {  0,   0,   0,   0, 255,   0,   0,  14,   0},
+    {  0,   0,   0,   0, 255,   0,   0,  14,   0},
+    {  0,   0,   0,   0, 128,   0,   0, 128,   0},
+    {  0,   0,   0,   0, 128,   0,   0,  14,   0},
+    {  0,   0,   0, 255,   0,   0,   0,  14,   0},
+    {  0,   0,   0, 255,   0,   0,   0, 128,   0},
+    {  0,   0, 255,   0,   0,   0,   0,  14,   0},
+    {  0,   0, 255,   0,   0,   0,   0, 255,   0},
+    {  0,   0,  14,   0,   0,   0,   0, 255,   0},
+    {  0,   0,  14,   0,   0,   0,   0,  14,   0},
+    {  0, 255,   0,   0,   0,   0,   0, 128,   0},
+    {  0, 255,   0,   0,   0,   0,   0, 128,   0},
+    {  0,  14,   0,   0,   0,   0,   0, 128,   0},
+    {  0, 128,   0,   0,   0,   0,   0, 128,   0},
+    {255,   0,   0,   0,   0,   0,   0,  14,   0},
+    { 14,   0,   0,   0,   0,   0,   0, 128,   0},
+    {  0,   0,   0,   0,   0,  14,  14,   0,   0},
+    {  0,   0,   0,   0,   0, 255, 255,   0,   0},
+    {  0,   0,   0,   0,  14,   0, 255,   0,   0},
+    {  0,   0,   0,   0,  14,   0,  14,   0,   0},
+    {  0,   0,   0,   0, 255,   0, 255,   0,   0},
+    {  0,   0, 255,   0,   0,   0, 255,   0,   0},
+    {  0,   0, 255,   0,   0,   0,  14,   0,   0},
+    {  0,   0,  14,   0,   0,   0,  14,   0,   0},
+    {  0, 255,   0,   0,   0,   0, 255,   0,   0},
+    {  0,  14,   0,   0,   0,   0, 255,   0,   0},
+    {  0,  14,   0,   0,   0,   0, 255,   0,   0},
+    {255,   0,   0,   0,   0,   0,  14,   0,   0},
+    { 14,   0,   0,   0,   0,   0, 255,   0,   0},
+    {  0,   0,   0,   0, 255,  14,   0,   0,   0},
+    {255,   0,   0,   0,   0,  14,   0,   0,   0},
+    {  0,   0,   0, 255, 255,   0,   0,   0,   0},
+    {  0,   0,   0,  14, 255,   0,   0,   0,   0},
+    {  0,   0,   0, 255, 128,   0,   0,   0,   0},
+    {  0,   0,  14,   0, 128,   0,   0,   0,   0},
+    {255,   0,   0,   0, 255,   0,   0,   0,   0},
+    {  0, 255,   0, 255,   0,   0,   0,   0,   0},
+    {255,   0,   0,  14,   0,   0,   0,   0,   0},
+    {  0,   0,   0,   0,   0,   0,   0,   0, 255},
+    {  0,   0,   0,   0,   0,   0,   0,   0, 255},
+    {  0,   0,   0,   0,   0,   0,   0,   0, 128},
+    {  0,   0,   0,   0,   0,   0,   0,   0, 128},
+    {  0,   0,   0,   0,   0,   0,   0,   0, 128},
+    {  0,   0,   0,   0,   0,   0,   0,   0, 255},
+    {  0,   0,   0,   0,   0,   0,   0,   0, 128},
+    {  0,   0,   0,   0,   0,   0,   0,   0, 255},
+    {  0,   0,   0,   0,   0,   0,   0,   0, 128},
+    {  0,   0,   0,   0,   0,   0,   0, 128,   0},
+    {  0,   0,   0,   0,   0,   0,   0, 255,   0},
+    {  0,   0,   0,   0,   0,   0,   0, 128,   0},
+    {  0,   0,   0,   0,   0,   0,   0, 128,   0},
+    {  0,   0,   0,   0,   0,   0,   0, 128,   0},
+    {  0,   0,   0,   0,   0,   0,   0, 128,   0},
+    {  0,   0,   0,   0,   0,   0,   0, 255,   0},
+    {  0,   0,   0,   0,   0,   0, 255,   0,   0},
+    {  0,   0,   0,   0,   0,   0, 255,   0,   0},
+    {  0,   0,   0,   0,   0,   0, 255,   0,   0},
+    {  0,   0,   0,   0, 255,   0,   0,   0,   0},
+    {  0,   0,   0,   0, 128,   0,   0,   0,   0},
+    {  0,   0,   0,   0, 255,   0,   0,   0,   0},
+    {  0,   0,   0,   0, 255,   0,   0,   0,   0},
+    {  0,   0,   0,   0, 255,   0,   0,   0,   0},
+    {  0,   0,   0,   0, 255,   0,   0,   0,   0},
+    {  0,   0,   0,   0, 255,   0,   0,   0,   0},
+    {  0,   0,   0,   0, 255,   0,   0,   0,   0},
+    {  0,   0,   0, 255,   0,   0,   0,   0,   0},
+    {  0,   0,   0, 255,   0,   0,   0,   0,   0},
+    {  0,   0, 255,   0,   0,   0,   0,   0,   0},
+    {  0,   0, 255,   0,   0,   0,   0,   0,   0},
+    {  0, 255,   0,   0,   0,   0,   0,   0,   0},
+    {255,   0,   0,   0,   0,   0,   0,   0,   0},
+    {255,   0,   0,   0,   0,   0,   0,   0,   0}
+};
@@ -0,0 +1,259 @@
+/**
+ ******************************************************************************
+ * @file    ai_search.c
+ * @brief   Implementación de negamax con poda alfa-beta y orden de jugadas
+ ******************************************************************************
+ */
+
+#include "ai_search.h"
+#include <stddef.h>
+#include <string.h>
+
+#define MEMO_UNKNOWN    INT8_MIN    // Posición todavía no resuelta
+
+/* Orden estático de exploración: centro, esquinas y luego lados */
+static const uint8_t move_order[BB_NUM_CELLS] = {4, 0, 2, 6, 8, 1, 3, 5, 7};
+
+/* Contador de nodos visitados en la última búsqueda */
+static uint32_t node_count = 0;
+
+/* Valor exacto de cada posición para el jugador que mueve, como si fuera la
+ * raíz (índice = Base3(propias) + 2 * Base3(rival)) */
+static int8_t memo[AI_SEARCH_MEMO_SIZE];
+static bool memo_ready = false;
+
+static const uint16_t pow3[BB_NUM_CELLS] = {1, 3, 9, 27, 81, 243, 729, 2187, 6561};
+
+/* Prototipos funciones privadas */
+static uint16_t ThreatCells(uint16_t own, uint16_t empty);
+static int8_t Solve(uint16_t own, uint16_t opp);
+static uint16_t Base3(uint16_t mask);
+
+/**
+ * @brief  Calcula la mejor jugada para el jugador que mueve
+ * @param  board: Tablero actual
+ * @param  p2_to_move: true si mueve el jugador 2, false si mueve el jugador 1
+ * @param  score_out: Puntaje de la jugada elegida (puede ser NULL)
+ * @retval Posición elegida (0-8). Ante empate de puntaje se queda con la de
+ *         menor índice, igual que el Minimax de ancho completo original.
+ */
+uint8_t AISearch_BestMove(Bitboard_t board, bool p2_to_move, int8_t* score_out)
+{
+    uint16_t own = p2_to_move ? board.p2 : board.p1;
+    uint16_t opp = p2_to_move ? board.p1 : board.p2;
+    uint16_t empty = Bitboard_Empty(&board);
+    int8_t best_score = -AI_SEARCH_SCORE_INF;
+    uint8_t best_move = 0;
+
+    node_count = 0;
+
+    // La raíz se recorre en orden de índice con ventana (best, +inf):
+    // una jugada solo reemplaza a la anterior si es estrictamente mejor
+    while (empty) {
+        uint8_t i = Bitboard_PopLowest(&empty);
+        int8_t score = (int8_t)-AISearch_Negamax(opp, (uint16_t)(own | (1u << i)), 0,
+                                                 -AI_SEARCH_SCORE_INF, (int8_t)-best_score);
+
+        if (score > best_score) {
+            best_score = score;
+            best_move = i;
+        }
+    }
+
+    if (score_out != NULL) {
+        *score_out = best_score;
+    }
+    return best_move;
+}
+
+/**
+ * @brief  Negamax con poda alfa-beta
+ * @param  own: Celdas del jugador que mueve
+ * @param  opp: Celdas del rival (que acaba de mover)
+ * @param  depth: Jugadas realizadas desde la raíz
+ * @param  alpha: Cota inferior de la ventana
+ * @param  beta: Cota superior de la ventana
+ * @retval Puntaje desde el punto de vista del jugador que mueve
+ */
+int8_t AISearch_Negamax(uint16_t own, uint16_t opp, uint8_t depth, int8_t alpha, int8_t beta)
+{
+    node_count++;
+
+    // Solo puede haber completado una línea el rival, que acaba de mover
+    if (Bitboard_HasWin(opp)) {
+        return (int8_t)(depth - AI_SEARCH_SCORE_WIN);
+    }
+
+    uint16_t empty = (uint16_t)(~(own | opp) & BB_FULL_MASK);
+    if (empty == 0) {
+        return 0;  // Empate
+    }
+
+    // Ganar en la próxima jugada es el mejor resultado posible
+    if (ThreatCells(own, empty) != 0) {
+        return (int8_t)(AI_SEARCH_SCORE_WIN - (depth + 1));
+    }
+
+    // Ordenar: primero bloqueos, después centro, esquinas y lados
+    uint16_t blocks = ThreatCells(opp, empty);
+    uint8_t moves[BB_NUM_CELLS];
+    uint8_t count = 0;
+
+    uint16_t pending = blocks;
+    while (pending) {
+        moves[count++] = Bitboard_PopLowest(&pending);
+    }
+    for (uint8_t k = 0; k < BB_NUM_CELLS; k++) {
+        uint16_t bit = (uint16_t)(1u << move_order[k]);
+        if ((empty & bit) && !(blocks & bit)) {
+            moves[count++] = move_order[k];
+        }
+    }
+
+    int8_t best = -AI_SEARCH_SCORE_INF;
+    for (uint8_t k = 0; k < count; k++) {
+        uint16_t bit = (uint16_t)(1u << moves[k]);
+        int8_t score = (int8_t)-AISearch_Negamax(opp, (uint16_t)(own | bit), (uint8_t)(depth + 1),
+                                                 (int8_t)-beta, (int8_t)-alpha);
+        if (score > best) {
+            best = score;
+            if (score > alpha) {
+                alpha = score;
+                if (alpha >= beta) {
+                    break;  // Poda
+                }
+            }
+        }
+    }
+
+    return best;
+}
+
+/**
+ * @brief  Puntúa todas las jugadas de la raíz en un solo recorrido
+ * @note   La primera llamada resuelve (y memoriza) todas las posiciones que
+ *         cuelgan del tablero; desde ahí una llamada sobre una posición ya
+ *         vista no visita nodos ni escribe estado. Para usarla desde varios
+ *         hilos, hacer antes una llamada con el tablero vacío.
+ *         Los nodos resueltos se suman al contador sin reiniciarlo.
+ * @param  board: Tablero actual
+ * @param  p2_to_move: true si mueve el jugador 2, false si mueve el jugador 1
+ * @param  moves: Salida, de mayor a menor puntaje (mismo puntaje: menor
+ *         índice primero, así moves[0] coincide con AISearch_BestMove)
+ * @retval Cantidad de jugadas (celdas libres)
+ */
+uint8_t AISearch_RankMoves(Bitboard_t board, bool p2_to_move, AISearch_Move_t moves[BB_NUM_CELLS])
+{
+    uint16_t own = p2_to_move ? board.p2 : board.p1;
+    uint16_t opp = p2_to_move ? board.p1 : board.p2;
+    uint16_t empty = Bitboard_Empty(&board);
+    uint8_t count = 0;
+
+    if (!memo_ready) {
+        memset(memo, (uint8_t)MEMO_UNKNOWN, sizeof(memo));
+        memo_ready = true;
+    }
+
+    while (empty) {
+        uint8_t i = Bitboard_PopLowest(&empty);
+        int8_t score = (int8_t)-Solve(opp, (uint16_t)(own | (1u << i)));
+
+        // Inserción estable: las celdas salen en orden de índice
+        uint8_t k = count++;
+        while (k > 0 && moves[k - 1u].score < score) {
+            moves[k] = moves[k - 1u];
+            k--;
+        }
+        moves[k].move = i;
+        moves[k].score = score;
+    }
+    return count;
+}
+
+/**
+ * @brief  Obtiene la cantidad de nodos visitados en la última búsqueda
+ */
+uint32_t AISearch_GetNodeCount(void)
+{
+    return node_count;
+}
+
+/**
+ * @brief  Reinicia el contador de nodos
+ */
+void AISearch_ResetNodeCount(void)
+{
+    node_count = 0;
+}
+
+/**
+ * @brief  Calcula las celdas vacías que completan una línea del jugador
+ * @param  own: Celdas del jugador
+ * @param  empty: Celdas vacías
+ * @retval Máscara de celdas ganadoras
+ */
+static uint16_t ThreatCells(uint16_t own, uint16_t empty)
+{
+    uint16_t threats = 0;
+
+    for (uint8_t i = 0; i < BB_NUM_LINES; i++) {
+        uint16_t line = BB_WinMasks[i];
+        if (Bitboard_Count((uint16_t)(own & line)) == 2) {
+            threats |= (uint16_t)(line & empty);
+        }
+    }
+    return threats;
+}
+
+/**
+ * @brief  Valor exacto de una posición (minimax completo con memoria)
+ * @param  own: Celdas del jugador que mueve
+ * @param  opp: Celdas del rival (que acaba de mover)
+ * @retval Puntaje como si la posición fuera la raíz (el de AISearch_Negamax
+ *         con depth = 0 y ventana completa)
+ */
+static int8_t Solve(uint16_t own, uint16_t opp)
+{
+    uint16_t key = (uint16_t)(Base3(own) + 2u * Base3(opp));
+    int8_t best = memo[key];
+
+    if (best != MEMO_UNKNOWN) {
+        return best;
+    }
+    node_count++;
+
+    uint16_t empty = (uint16_t)(~(own | opp) & BB_FULL_MASK);
+    if (Bitboard_HasWin(opp)) {
+        best = -AI_SEARCH_SCORE_WIN;
+    } else if (empty == 0) {
+        best = 0;
+    } else {
+        best = -AI_SEARCH_SCORE_INF;
+        while (empty) {
+            uint8_t i = Bitboard_PopLowest(&empty);
+            int8_t child = Solve(opp, (uint16_t)(own | (1u << i)));
+
+            // Una jugada más lejos: el resultado del hijo pierde un punto
+            int8_t score = (int8_t)-(child - ((child > 0) - (child < 0)));
+            if (score > best) {
+                best = score;
+            }
+        }
+    }
+
+    memo[key] = best;
+    return best;
+}
+
+/**
+ * @brief  Convierte una máscara de celdas en su valor en base 3 (dígito 1)
+ */
+static uint16_t Base3(uint16_t mask)
+{
+    uint16_t value = 0;
+
+    while (mask) {
+        value = (uint16_t)(value + pow3[Bitboard_PopLowest(&mask)]);
+    }
+    return value;
+}
@@ -0,0 +1,224 @@
+/**
+ ******************************************************************************
+ * @file    ai_table.c
+ * @brief   Consulta de la tabla de juego perfecto
+ ******************************************************************************
+ */
+
+#include "ai_table.h"
+#include <stddef.h>
+
+/* Coeficientes binomiales C(n, k) para n, k <= 9 */
+static const uint16_t Binomial[BB_NUM_CELLS + 1][BB_NUM_CELLS + 1] = {
+    {1,  0,  0,  0,   0,   0,  0,  0, 0, 0},
+    {1,  1,  0,  0,   0,   0,  0,  0, 0, 0},
+    {1,  2,  1,  0,   0,   0,  0,  0, 0, 0},
+    {1,  3,  3,  1,   0,   0,  0,  0, 0, 0},
+    {1,  4,  6,  4,   1,   0,  0,  0, 0, 0},
+    {1,  5, 10, 10,   5,   1,  0,  0, 0, 0},
+    {1,  6, 15, 20,  15,   6,  1,  0, 0, 0},
+    {1,  7, 21, 35,  35,  21,  7,  1, 0, 0},
+    {1,  8, 28, 56,  70,  56, 28,  8, 1, 0},
+    {1,  9, 36, 84, 126, 126, 84, 36, 9, 1}
+};
+
+/* Primer índice de los tableros con k fichas: suma de C(9, j) * C(j, j/2), j < k */
+static const uint16_t CountOffset[BB_NUM_CELLS + 1] = {
+    0, 1, 10, 82, 334, 1090, 2350, 4030, 5290, AI_TABLE_INDEX_SIZE
+};
+
+/* Prototipos funciones privadas */
+static uint16_t SubsetRank(uint16_t mask);
+static uint16_t SubsetUnrank(uint8_t n, uint8_t count, uint16_t rank);
+static uint16_t Compress(uint16_t mask, uint16_t within);
+static uint16_t Expand(uint16_t mask, uint16_t within);
+
+/**
+ * @brief  Número denso de un tablero con turno del jugador 2
+ * @note   Los tableros con k fichas (k/2 de P2) ocupan
+ *         C(9, k) * C(k, k/2) números seguidos: el rango de las celdas
+ *         ocupadas entre los C(9, k) conjuntos y, dentro de él, el de las
+ *         fichas de P2 entre las k ocupadas. No verifica líneas completas.
+ * @param  board: Tablero
+ * @retval 0 a AI_TABLE_INDEX_SIZE - 1, o AI_TABLE_INDEX_SIZE si no es turno
+ *         de P2 o no quedan celdas libres
+ */
+uint16_t AITable_PositionIndex(const Bitboard_t* board)
+{
+    uint16_t occupied = Bitboard_Occupied(board);
+    uint8_t count = Bitboard_Count(occupied);
+    uint8_t p2_count = (uint8_t)(count / 2u);
+
+    if ((board->p1 & board->p2) != 0 || count >= BB_NUM_CELLS ||
+        Bitboard_Count(board->p2) != p2_count) {
+        return AI_TABLE_INDEX_SIZE;
+    }
+
+    uint16_t p2_rank = SubsetRank(Compress(board->p2, occupied));
+    return (uint16_t)(CountOffset[count] +
+                      SubsetRank(occupied) * Binomial[count][p2_count] + p2_rank);
+}
+
+/**
+ * @brief  Busca la posición canónica de un tablero en la tabla
+ * @note   El índice sirve también para las tablas generadas en el mismo
+ *         orden (p. ej. AI_PolicyPrefs de ai_policy.h)
+ * @param  board: Tablero actual (debe ser turno del jugador 2)
+ * @param  index_out: Índice de la entrada (0 a AI_TableSize - 1)
+ * @param  sym_out: Simetría que lleva el tablero a la orientación canónica
+ * @retval true si la posición está en la tabla, false en caso contrario
+ */
+bool AITable_Find(const Bitboard_t* board, uint16_t* index_out, uint8_t* sym_out)
+{
+    uint32_t key = Bitboard_Canonical(board, sym_out);
+    Bitboard_t canonical = {
+        .p1 = (uint16_t)(key & BB_FULL_MASK),
+        .p2 = (uint16_t)(key >> BB_NUM_CELLS)
+    };
+    uint16_t code = AITable_PositionIndex(&canonical);
+
+    if (code >= AI_TABLE_INDEX_SIZE) {
+        return false;
+    }
+
+    // Rango del bit: acumulado de la palabra más los bits anteriores en ella
+    uint32_t word = AI_TableIndexBits[code / 32u];
+    uint32_t bit = 1u << (code % 32u);
+    if ((word & bit) == 0) {
+        return false;
+    }
+    *index_out = (uint16_t)(AI_TableIndexRank[code / 32u] + __builtin_popcount(word & (bit - 1u)));
+    return true;
+}
+
+/**
+ * @brief  Tablero canónico de una entrada de la tabla
+ * @param  index: Índice de la entrada (0 a AI_TableSize - 1)
+ * @param  board_out: Tablero en la orientación canónica
+ * @retval true si el índice existe, false en caso contrario
+ */
+bool AITable_Position(uint16_t index, Bitboard_t* board_out)
+{
+    if (index >= AI_TableSize) {
+        return false;
+    }
+
+    // Palabra que contiene la entrada y, dentro de ella, su bit
+    uint16_t w = 0;
+    while (w + 1u < AI_TABLE_INDEX_WORDS && AI_TableIndexRank[w + 1u] <= index) {
+        w++;
+    }
+    uint32_t word = AI_TableIndexBits[w];
+    for (uint16_t skip = (uint16_t)(index - AI_TableIndexRank[w]); skip > 0; skip--) {
+        word &= word - 1u;
+    }
+    uint16_t code = (uint16_t)(w * 32u + (uint32_t)__builtin_ctz(word));
+
+    // Deshacer AITable_PositionIndex
+    uint8_t count = 0;
+    while (CountOffset[count + 1u] <= code) {
+        count++;
+    }
+    uint8_t p2_count = (uint8_t)(count / 2u);
+    uint16_t rest = (uint16_t)(code - CountOffset[count]);
+    uint16_t occupied = SubsetUnrank(BB_NUM_CELLS, count, (uint16_t)(rest / Binomial[count][p2_count]));
+    uint16_t p2 = Expand(SubsetUnrank(count, p2_count, (uint16_t)(rest % Binomial[count][p2_count])),
+                         occupied);
+
+    board_out->p1 = (uint16_t)(occupied & ~p2);
+    board_out->p2 = p2;
+    return true;
+}
+
+/**
+ * @brief  Busca la jugada óptima del jugador 2 para un tablero
+ * @param  board: Tablero actual (debe ser turno del jugador 2)
+ * @param  move_out: Posición de la jugada óptima (0-8)
+ * @param  value_out: Valor teórico de la posición (puede ser NULL)
+ * @retval true si la posición está en la tabla, false en caso contrario
+ */
+bool AITable_Lookup(const Bitboard_t* board, uint8_t* move_out, AI_TableValue_t* value_out)
+{
+    uint16_t index;
+    uint8_t sym;
+
+    if (!AITable_Find(board, &index, &sym)) {
+        return false;
+    }
+
+    // Llevar la jugada de la orientación canónica a la del tablero real
+    uint8_t move = (uint8_t)((AI_TableMoves[index / 2u] >> ((index % 2u) * 4u)) & AI_TABLE_MOVE_MASK);
+    uint16_t real_bit = Bitboard_InverseTransform((uint16_t)(1u << move), sym);
+
+    *move_out = (uint8_t)__builtin_ctz(real_bit);
+    if (value_out != NULL) {
+        *value_out = (AI_TableValue_t)((AI_TableValues[index / 4u] >> ((index % 4u) * 2u)) &
+                                       AI_TABLE_VALUE_MASK);
+    }
+    return true;
+}
+
+/**
+ * @brief  Rango colexicográfico de un conjunto: suma de C(celda, i) con i
+ *         el orden de la celda dentro del conjunto (desde 1)
+ */
+static uint16_t SubsetRank(uint16_t mask)
+{
+    uint16_t rank = 0;
+
+    for (uint8_t i = 1; mask != 0; i++) {
+        rank = (uint16_t)(rank + Binomial[Bitboard_PopLowest(&mask)][i]);
+    }
+    return rank;
+}
+
+/**
+ * @brief  Conjunto de count elementos de 0..n-1 con el rango indicado
+ */
+static uint16_t SubsetUnrank(uint8_t n, uint8_t count, uint16_t rank)
+{
+    uint16_t mask = 0;
+    uint8_t cell = n;
+
+    // De la celda más alta a la más baja: la mayor con C(celda, i) <= rango
+    for (uint8_t i = count; i > 0; i--) {
+        do {
+            cell--;
+        } while (Binomial[cell][i] > rank);
+        mask |= (uint16_t)(1u << cell);
+        rank = (uint16_t)(rank - Binomial[cell][i]);
+    }
+    return mask;
+}
+
+/**
+ * @brief  Posiciones de los bits de mask dentro de within (bit j = j-ésima
+ *         celda de within)
+ */
+static uint16_t Compress(uint16_t mask, uint16_t within)
+{
+    uint16_t out = 0;
+
+    for (uint8_t j = 0; within != 0; j++) {
+        if (mask & (1u << Bitboard_PopLowest(&within))) {
+            out |= (uint16_t)(1u << j);
+        }
+    }
+    return out;
+}
+
+/**
+ * @brief  Inversa de Compress
+ */
+static uint16_t Expand(uint16_t mask, uint16_t within)
+{
+    uint16_t out = 0;
+
+    for (uint8_t j = 0; within != 0; j++) {
+        uint8_t cell = Bitboard_PopLowest(&within);
+        if (mask & (1u << j)) {
+            out |= (uint16_t)(1u << cell);
+        }
+    }
+    return out;
+}
@@ -0,0 +1,110 @@
+/**
+ ******************************************************************************
+ * @file    ai_table_data.c
+ * @brief   Tabla de juego perfecto (GENERADO por Tools/ai_tablegen.c)
+ ******************************************************************************
+ */
+
+#include "ai_table.h"
+
+const uint16_t AI_TableSize = 627;
+
+const uint32_t AI_TableIndexBits[AI_TABLE_INDEX_WORDS] = {
+    0x43C41C27, 0x00400400, 0xC96C0004, 0x1209940B, 0x04129004, 0x10009088,
+    0x02010080, 0x24000800, 0x01001000, 0x00000400, 0x75BCC000, 0xA594138D,
+    0x34800831, 0x58506305, 0x420124C5, 0x51104410, 0x00004134, 0x45105043,
+    0x10420000, 0x04500000, 0x41000001, 0x00400000, 0x00000004, 0x05040000,
+    0x00020C61, 0x00004104, 0x00041040, 0x00050400, 0x00100100, 0x00000000,
+    0x00000010, 0x00000004, 0x00000000, 0x00000000, 0x024333CC, 0xC064311C,
+    0x50051A4C, 0x95032300, 0x07298A50, 0x0488220C, 0x42300413, 0x80141104,
+    0x94250040, 0x0200C060, 0x00C00000, 0x40100C01, 0x10140401, 0x08000080,
+    0x11004010, 0x00000000, 0x00100001, 0x90C40000, 0x18080240, 0x04014000,
+    0x00003010, 0x40100800, 0x50042300, 0x0C050180, 0x02000000, 0x00001004,
+    0x40100000, 0x00000100, 0x04010000, 0x01010040, 0x00000000, 0x00100400,
+    0x10000000, 0x00010040, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+    0x00000000, 0x18CF8000, 0x63806CF0, 0xCC6018C6, 0x002CC01A, 0xE0400344,
+    0x00638008, 0x12C00008, 0x4000AC00, 0x01300003, 0x08001180, 0x0002C000,
+    0x78000064, 0x40063000, 0x02540021, 0x44004040, 0x00040002, 0x20800008,
+    0x80000400, 0x023000C5, 0xAC000000, 0x000A4000, 0x1B800024, 0x80009800,
+    0x002C0000, 0x80000740, 0x00434007, 0x04400254, 0x00000400, 0x00400024,
+    0x0C000080, 0x00004000, 0x00800030, 0x40000800, 0x00240002, 0x14000000,
+    0x00014000, 0x00400004, 0x00000000, 0x00080000, 0x04000040, 0x00020000,
+    0x00000000, 0x00000800, 0x00000000, 0x00000080, 0x00000000, 0x00000000,
+    0x80000800, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+    0x300000CF, 0x00008674, 0x00012380, 0x018CC700, 0x08401800, 0x40084000,
+    0x000B0000, 0x00680001, 0x81000008, 0x68000008, 0xC0000016, 0x00003198,
+    0x00008400, 0x000000AC, 0x00200160, 0x00000900, 0x00108000, 0x00230000,
+    0x00000000, 0x00B00000, 0x14800000, 0x24000000, 0x00000000, 0x00000008,
+    0x00000000, 0x00000000, 0x00000000, 0x00002000, 0x000E0000, 0x00800000,
+    0x00000000, 0x02000000, 0x00000000, 0x80000000, 0x00000000, 0x00000004,
+    0x00000000, 0x00000000, 0x00000000, 0x10007000, 0x000006A8, 0x00980000,
+    0x00018600, 0x16000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+    0x0201BC00, 0x00010000, 0x00120000, 0x00000000, 0x08800000, 0x00000000,
+    0x20000000, 0x00000000, 0x80000000, 0x00000010, 0x00000000
+};
+
+const uint16_t AI_TableIndexRank[AI_TABLE_INDEX_WORDS] = {
+      0,  13,  15,  24,  34,  40,  45,  48,  51,  53,  54,  66,
+     80,  88,  99, 108, 115, 120, 129, 132, 135, 138, 139, 140,
+    143, 149, 152, 155, 158, 160, 160, 161, 162, 162, 162, 174,
+    185, 195, 204, 215, 222, 230, 236, 243, 248, 250, 255, 260,
+    262, 266, 266, 268, 273, 278, 281, 284, 287, 293, 299, 300,
+    302, 304, 305, 307, 310, 310, 312, 313, 315, 315, 315, 315,
+    315, 315, 324, 337, 349, 357, 365, 371, 376, 381, 386, 390,
+    393, 400, 405, 411, 415, 417, 420, 422, 429, 433, 436, 443,
+    447, 450, 455, 462, 468, 469, 472, 475, 476, 479, 481, 484,
+    486, 488, 490, 490, 491, 493, 494, 494, 495, 495, 496, 496,
+    496, 498, 498, 498, 498, 498, 498, 506, 513, 518, 527, 531,
+    534, 537, 541, 544, 548, 553, 559, 561, 565, 569, 571, 573,
+    576, 576, 579, 582, 584, 584, 585, 585, 585, 585, 586, 589,
+    590, 590, 591, 591, 592, 592, 593, 593, 593, 593, 597, 602,
+    605, 609, 612, 612, 612, 612, 612, 619, 620, 622, 622, 624,
+    624, 625, 625, 626, 627
+};
+
+const uint8_t AI_TableMoves[314] = {
+    0x40, 0x00, 0x33, 0x03, 0x11, 0x00, 0x02, 0x20, 0x43, 0x64, 0x44, 0x87,
+    0x62, 0x51, 0x00, 0x86, 0x44, 0x03, 0x43, 0x04, 0x12, 0x42, 0x66, 0x20,
+    0x48, 0x25, 0x72, 0x44, 0x44, 0x76, 0x78, 0x82, 0x78, 0x81, 0x68, 0x77,
+    0x28, 0x42, 0x11, 0x84, 0x26, 0x88, 0x88, 0x70, 0x07, 0x84, 0x24, 0x51,
+    0x54, 0x24, 0x17, 0x88, 0x77, 0x07, 0x12, 0x44, 0x24, 0x04, 0x44, 0x78,
+    0x46, 0x12, 0x44, 0x32, 0x01, 0x21, 0x40, 0x80, 0x12, 0x88, 0x25, 0x44,
+    0x45, 0x32, 0x05, 0x20, 0x02, 0x22, 0x41, 0x77, 0x62, 0x55, 0x55, 0x78,
+    0x44, 0x48, 0x83, 0x88, 0x27, 0x88, 0x01, 0x47, 0x48, 0x45, 0x87, 0x37,
+    0x12, 0x78, 0x07, 0x43, 0x24, 0x44, 0x41, 0x44, 0x40, 0x44, 0x82, 0x17,
+    0x18, 0x07, 0x18, 0x72, 0x00, 0x44, 0x64, 0x23, 0x16, 0x61, 0x28, 0x48,
+    0x41, 0x84, 0x24, 0x88, 0x00, 0x31, 0x23, 0x81, 0x20, 0x12, 0x08, 0x20,
+    0x41, 0x88, 0x45, 0x34, 0x25, 0x52, 0x00, 0x22, 0x64, 0x22, 0x02, 0x30,
+    0x47, 0x12, 0x01, 0x27, 0x17, 0x71, 0x20, 0x70, 0x31, 0x12, 0x20, 0x20,
+    0x60, 0x61, 0x86, 0x67, 0x67, 0x66, 0x87, 0x87, 0x55, 0x55, 0x44, 0x44,
+    0x44, 0x84, 0x77, 0x38, 0x33, 0x28, 0x72, 0x22, 0x87, 0x11, 0x11, 0x70,
+    0x00, 0x88, 0x56, 0x66, 0x44, 0x84, 0x22, 0x82, 0x11, 0x66, 0x80, 0x46,
+    0x48, 0x88, 0x28, 0x11, 0x05, 0x05, 0x43, 0x33, 0x44, 0x24, 0x41, 0x01,
+    0x04, 0x20, 0x18, 0x31, 0x10, 0x20, 0x68, 0x76, 0x55, 0x46, 0x24, 0x72,
+    0x16, 0x66, 0x60, 0x74, 0x44, 0x74, 0x37, 0x12, 0x51, 0x50, 0x05, 0x43,
+    0x43, 0x42, 0x44, 0x41, 0x11, 0x00, 0x12, 0x03, 0x71, 0x70, 0x46, 0x23,
+    0x51, 0x50, 0x42, 0x41, 0x20, 0x06, 0x46, 0x00, 0x01, 0x87, 0x87, 0x77,
+    0x87, 0x86, 0x68, 0x68, 0x86, 0x88, 0x55, 0x44, 0x48, 0x44, 0x44, 0x84,
+    0x38, 0x28, 0x82, 0x11, 0x18, 0x80, 0x08, 0x66, 0x76, 0x77, 0x55, 0x75,
+    0x44, 0x44, 0x44, 0x34, 0x23, 0x72, 0x12, 0x71, 0x01, 0x57, 0x65, 0x44,
+    0x22, 0x12, 0x66, 0x60, 0x04, 0x43, 0x43, 0x10, 0x80, 0x88, 0x88, 0x88,
+    0x88, 0x77, 0x77, 0x77, 0x67, 0x66, 0x44, 0x44, 0x44, 0x44, 0x33, 0x22,
+    0x01, 0x00
+};
+
+const uint8_t AI_TableValues[157] = {
+    0x55, 0xA6, 0x95, 0x9A, 0x16, 0x15, 0x15, 0x25, 0x9A, 0x90, 0x54, 0x95,
+    0x45, 0xA2, 0x5A, 0x6A, 0x6A, 0x96, 0x98, 0xA6, 0xAA, 0xA2, 0xA8, 0xAA,
+    0xAA, 0xAA, 0x66, 0xAA, 0x66, 0xAA, 0xA9, 0x6A, 0x9A, 0xAA, 0x6A, 0xA8,
+    0xA8, 0xA9, 0xAA, 0x9A, 0x0A, 0xA0, 0x58, 0x98, 0x92, 0x90, 0xAA, 0x29,
+    0x5A, 0x42, 0x9A, 0xA6, 0xA4, 0xAA, 0x22, 0x92, 0x84, 0x96, 0x49, 0x98,
+    0x66, 0xA9, 0x1A, 0x68, 0x88, 0x81, 0x5A, 0x20, 0x59, 0x20, 0x69, 0x22,
+    0xA9, 0x90, 0x8A, 0x48, 0x20, 0x88, 0x88, 0xA6, 0x2A, 0xA5, 0x0A, 0x94,
+    0xAA, 0xAA, 0x98, 0x0A, 0xA9, 0xA5, 0x95, 0xAA, 0xA9, 0x5A, 0xAA, 0x26,
+    0xA9, 0xA9, 0xAA, 0x6A, 0xAA, 0x9A, 0x9A, 0xA9, 0x82, 0xA9, 0xAA, 0xAA,
+    0xAA, 0x4A, 0xA8, 0xA9, 0xAA, 0xAA, 0xAA, 0xAA, 0xA6, 0xAA, 0x48, 0x82,
+    0xAA, 0xAA, 0x2A, 0xAA, 0x5A, 0x6A, 0x65, 0x9A, 0xA4, 0x02, 0xA9, 0x96,
+    0x92, 0xA4, 0x65, 0xA5, 0x66, 0x4A, 0xA8, 0x96, 0xAA, 0x68, 0x19, 0x8A,
+    0x8A, 0xAA, 0xAA, 0xA6, 0x6A, 0x65, 0x96, 0x55, 0xAA, 0xA6, 0xAA, 0xAA,
+    0x2A
+};
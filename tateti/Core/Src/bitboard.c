@@ -0,0 +1,142 @@
+/**
+ ******************************************************************************
+ * @file    bitboard.c
+ * @brief   Implementación de las operaciones sobre bitboards de tateti
+ ******************************************************************************
+ */
+
+#include "bitboard.h"
+#include <stddef.h>
+
+/* Combinaciones ganadoras como máscaras de bits */
+const uint16_t BB_WinMasks[BB_NUM_LINES] = {
+    0x0007,  // Fila 0            (0, 1, 2)
+    0x0038,  // Fila 1            (3, 4, 5)
+    0x01C0,  // Fila 2            (6, 7, 8)
+    0x0049,  // Columna 0         (0, 3, 6)
+    0x0092,  // Columna 1         (1, 4, 7)
+    0x0124,  // Columna 2         (2, 5, 8)
+    0x0111,  // Diagonal principal (0, 4, 8)
+    0x0054   // Diagonal anti     (2, 4, 6)
+};
+
+/* Prototipos funciones privadas */
+static uint16_t FlipColumns(uint16_t mask);
+static uint16_t FlipRows(uint16_t mask);
+static uint16_t Transpose(uint16_t mask);
+
+/**
+ * @brief  Vacía el tablero
+ * @param  bb: Tablero a limpiar
+ * @retval None
+ */
+void Bitboard_Clear(Bitboard_t* bb)
+{
+    bb->p1 = 0;
+    bb->p2 = 0;
+}
+
+/**
+ * @brief  Busca una línea completa dentro de la máscara de un jugador
+ * @param  mask: Celdas ocupadas por un jugador
+ * @retval 0 si no hay línea, o el índice de línea + 1 (mismo valor que WinType_t)
+ */
+uint8_t Bitboard_WinLine(uint16_t mask)
+{
+    // Con menos de 3 fichas no puede haber línea
+    if (Bitboard_Count(mask) < 3) {
+        return 0;
+    }
+
+    for (uint8_t i = 0; i < BB_NUM_LINES; i++) {
+        if ((mask & BB_WinMasks[i]) == BB_WinMasks[i]) {
+            return (uint8_t)(i + 1);
+        }
+    }
+    return 0;
+}
+
+/**
+ * @brief  Aplica una de las 8 simetrías del tablero a una máscara
+ * @param  mask: Celdas a transformar
+ * @param  sym: Simetría (0-7). Bit 0: espejo de columnas, bit 1: espejo de
+ *         filas, bit 2: transpuesta. Se aplican en ese orden.
+ * @retval Máscara transformada
+ */
+uint16_t Bitboard_Transform(uint16_t mask, uint8_t sym)
+{
+    if (sym & 1u) mask = FlipColumns(mask);
+    if (sym & 2u) mask = FlipRows(mask);
+    if (sym & 4u) mask = Transpose(mask);
+    return mask;
+}
+
+/**
+ * @brief  Deshace una simetría aplicada con Bitboard_Transform
+ * @param  mask: Celdas transformadas
+ * @param  sym: Simetría usada al transformar (0-7)
+ * @retval Máscara en la orientación original
+ */
+uint16_t Bitboard_InverseTransform(uint16_t mask, uint8_t sym)
+{
+    // Cada operación es su propia inversa: se aplican en orden contrario
+    if (sym & 4u) mask = Transpose(mask);
+    if (sym & 2u) mask = FlipRows(mask);
+    if (sym & 1u) mask = FlipColumns(mask);
+    return mask;
+}
+
+/**
+ * @brief  Obtiene la forma canónica de un tablero entre sus 8 simetrías
+ * @param  bb: Tablero
+ * @param  sym_out: Simetría que lleva el tablero a su forma canónica (puede ser NULL)
+ * @retval Clave (ver Bitboard_Key) mínima entre todas las simetrías
+ */
+uint32_t Bitboard_Canonical(const Bitboard_t* bb, uint8_t* sym_out)
+{
+    uint32_t best_key = Bitboard_Key(bb);
+    uint8_t best_sym = 0;
+
+    for (uint8_t sym = 1; sym < BB_NUM_SYMMETRIES; sym++) {
+        Bitboard_t t = {
+            .p1 = Bitboard_Transform(bb->p1, sym),
+            .p2 = Bitboard_Transform(bb->p2, sym)
+        };
+        uint32_t key = Bitboard_Key(&t);
+        if (key < best_key) {
+            best_key = key;
+            best_sym = sym;
+        }
+    }
+
+    if (sym_out != NULL) {
+        *sym_out = best_sym;
+    }
+    return best_key;
+}
+
+/**
+ * @brief  Intercambia las columnas 0 y 2
+ */
+static uint16_t FlipColumns(uint16_t mask)
+{
+    return (uint16_t)(((mask & 0x049u) << 2) | (mask & 0x092u) | ((mask & 0x124u) >> 2));
+}
+
+/**
+ * @brief  Intercambia las filas 0 y 2
+ */
+static uint16_t FlipRows(uint16_t mask)
+{
+    return (uint16_t)(((mask & 0x007u) << 6) | (mask & 0x038u) | ((mask & 0x1C0u) >> 6));
+}
+
+/**
+ * @brief  Refleja sobre la diagonal principal (fila <-> columna)
+ */
+static uint16_t Transpose(uint16_t mask)
+{
+    return (uint16_t)((mask & 0x111u) |
+                      ((mask & 0x022u) << 2) | ((mask & 0x088u) >> 2) |   // 1<->3, 5<->7
+                      ((mask & 0x004u) << 4) | ((mask & 0x040u) >> 4));   // 2<->6
+}
@@ -0,0 +1,143 @@
+/**
+ ******************************************************************************
+ * @file    bitboard_batch.c
+ * @brief   Implementación de la evaluación por lotes (AVX2, SSE2 y escalar)
+ ******************************************************************************
+ */
+
+#include "bitboard_batch.h"
+#include <string.h>
+
+#if defined(__AVX2__)
+#include <immintrin.h>
+#define BATCH_LANES     8u
+#elif defined(__SSE2__)
+#include <emmintrin.h>
+#define BATCH_LANES     4u
+#else
+#define BATCH_LANES     1u
+#endif
+
+/* Un tablero = una palabra: p1 en los bits 0-15 y p2 en los 16-31 */
+_Static_assert(sizeof(Bitboard_t) == sizeof(uint32_t), "Bitboard_t tiene que ocupar 32 bits");
+
+/* Prototipos funciones privadas */
+static uint8_t EvaluateWord(uint32_t word);
+
+/**
+ * @brief  Evalúa un lote de tableros con el núcleo SIMD disponible
+ * @param  boards: Tableros (sin requisito de alineación)
+ * @param  results: Salida, un byte por tablero (ver bitboard_batch.h)
+ * @param  count: Cantidad de tableros
+ */
+void Bitboard_BatchEvaluate(const Bitboard_t boards[], uint8_t results[], uint32_t count)
+{
+    uint32_t i = 0;
+
+#if BATCH_LANES > 1u
+#if defined(__AVX2__)
+    const __m256i full = _mm256_set1_epi32((int)BB_FULL_MASK);
+    const __m256i draw = _mm256_set1_epi32((int)BB_BATCH_DRAW);
+    const __m256i zero = _mm256_setzero_si256();
+
+    for (; i + BATCH_LANES <= count; i += BATCH_LANES) {
+        __m256i v = _mm256_loadu_si256((const __m256i*)&boards[i]);
+        __m256i res = zero;
+
+        // De la última línea a la primera: queda la de menor índice
+        for (int8_t l = BB_NUM_LINES - 1; l >= 0; l--) {
+            __m256i mask = _mm256_set1_epi16((short)BB_WinMasks[l]);
+            __m256i half = _mm256_cmpeq_epi16(_mm256_and_si256(v, mask), mask);
+            __m256i miss = _mm256_cmpeq_epi32(half, zero);
+            res = _mm256_blendv_epi8(_mm256_set1_epi32(l + 1), res, miss);
+        }
+
+        __m256i occupied = _mm256_and_si256(_mm256_or_si256(v, _mm256_srli_epi32(v, 16)), full);
+        __m256i is_draw = _mm256_and_si256(_mm256_cmpeq_epi32(occupied, full),
+                                           _mm256_cmpeq_epi32(res, zero));
+        res = _mm256_or_si256(res, _mm256_and_si256(is_draw, draw));
+
+        // 8 x 32 bits -> 8 bytes
+        __m128i words = _mm_packs_epi32(_mm256_castsi256_si128(res), _mm256_extracti128_si256(res, 1));
+        _mm_storel_epi64((__m128i*)&results[i], _mm_packus_epi16(words, words));
+    }
+#else
+    const __m128i full = _mm_set1_epi32((int)BB_FULL_MASK);
+    const __m128i draw = _mm_set1_epi32((int)BB_BATCH_DRAW);
+    const __m128i zero = _mm_setzero_si128();
+
+    for (; i + BATCH_LANES <= count; i += BATCH_LANES) {
+        __m128i v = _mm_loadu_si128((const __m128i*)&boards[i]);
+        __m128i res = zero;
+
+        // De la última línea a la primera: queda la de menor índice
+        for (int8_t l = BB_NUM_LINES - 1; l >= 0; l--) {
+            __m128i mask = _mm_set1_epi16((short)BB_WinMasks[l]);
+            __m128i half = _mm_cmpeq_epi16(_mm_and_si128(v, mask), mask);
+            __m128i miss = _mm_cmpeq_epi32(half, zero);
+            res = _mm_or_si128(_mm_and_si128(miss, res),
+                               _mm_andnot_si128(miss, _mm_set1_epi32(l + 1)));
+        }
+
+        __m128i occupied = _mm_and_si128(_mm_or_si128(v, _mm_srli_epi32(v, 16)), full);
+        __m128i is_draw = _mm_and_si128(_mm_cmpeq_epi32(occupied, full), _mm_cmpeq_epi32(res, zero));
+        res = _mm_or_si128(res, _mm_and_si128(is_draw, draw));
+
+        // 4 x 32 bits -> 4 bytes
+        __m128i words = _mm_packs_epi32(res, res);
+        uint32_t packed = (uint32_t)_mm_cvtsi128_si32(_mm_packus_epi16(words, words));
+        memcpy(&results[i], &packed, sizeof(packed));
+    }
+#endif
+#endif
+
+    // Resto del lote (o todo, sin SIMD)
+    Bitboard_BatchEvaluateScalar(&boards[i], &results[i], count - i);
+}
+
+/**
+ * @brief  Evalúa un lote de tableros de a uno (referencia y núcleo de la placa)
+ * @param  boards: Tableros
+ * @param  results: Salida, un byte por tablero (ver bitboard_batch.h)
+ * @param  count: Cantidad de tableros
+ */
+void Bitboard_BatchEvaluateScalar(const Bitboard_t boards[], uint8_t results[], uint32_t count)
+{
+    for (uint32_t i = 0; i < count; i++) {
+        uint32_t word;
+        memcpy(&word, &boards[i], sizeof(word));
+        results[i] = EvaluateWord(word);
+    }
+}
+
+/**
+ * @brief  Nombre del núcleo que usa Bitboard_BatchEvaluate
+ */
+const char* Bitboard_BatchKernel(void)
+{
+#if defined(__AVX2__)
+    return "avx2";
+#elif defined(__SSE2__)
+    return "sse2";
+#else
+    return "scalar";
+#endif
+}
+
+/**
+ * @brief  Evalúa un tablero con los dos jugadores en una palabra
+ * @note   (palabra & línea) ^ línea deja en 0 la media palabra del jugador
+ *         que completa la línea
+ */
+static uint8_t EvaluateWord(uint32_t word)
+{
+    for (uint8_t l = 0; l < BB_NUM_LINES; l++) {
+        uint32_t line = (uint32_t)BB_WinMasks[l] * 0x00010001u;
+        uint32_t diff = (word & line) ^ line;
+
+        if ((diff & 0xFFFFu) == 0 || (diff >> 16) == 0) {
+            return (uint8_t)(l + 1u);
+        }
+    }
+    return (((word | (word >> 16)) & BB_FULL_MASK) == BB_FULL_MASK) ? BB_BATCH_DRAW : 0u;
+}
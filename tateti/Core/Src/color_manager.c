@@ -10,14 +10,17 @@
 
 /* Paleta de colores disponibles para jugadores */
 /* Índices: 0=RED, 1=GREEN, 2=BLUE, 3=YELLOW, 4=CYAN, 5=MAGENTA, 6=WHITE */
+/* Valores perceptuales: el driver aplica gamma y brillo (WS2812B_SetBrightness);
+ * con WS2812B_DEFAULT_BRIGHTNESS (151) un canal en 206 sale en el PWM como
+ * 50/255, el valor que usaba la paleta antes de la corrección */
 static const WS2812B_Color_t color_palette[] = {
-    {50, 0, 0},    // RED
-    {0, 50, 0},    // GREEN
-    {0, 0, 50},    // BLUE
-    {50, 50, 0},   // YELLOW
-    {0, 50, 50},   // CYAN
-    {50, 0, 50},   // MAGENTA
-    {30, 30, 30}   // WHITE
+    {206, 0, 0},    // RED
+    {0, 206, 0},    // GREEN
+    {0, 0, 206},    // BLUE
+    {206, 206, 0},   // YELLOW
+    {0, 206, 206},   // CYAN
+    {206, 0, 206},   // MAGENTA
+    {163, 163, 163}   // WHITE
 };
 
 #define PALETTE_SIZE (sizeof(color_palette) / sizeof(WS2812B_Color_t))
@@ -0,0 +1,502 @@
+/**
+ ******************************************************************************
+ * @file    connect4.c
+ * @brief   Implementación del motor de 4 en línea: bitboards y búsqueda
+ ******************************************************************************
+ */
+
+#include "connect4.h"
+#include <stddef.h>
+#include <string.h>
+
+/* Máscaras del tablero (bit = columna * 7 + fila) */
+#define COLUMN_MASK     ((((C4_Mask_t)1u) << C4_HEIGHT) - 1u)
+#define BOTTOM_MASK     0x0040810204081ull                      // Fila 0 de cada columna
+#define BOARD_MASK      (BOTTOM_MASK * COLUMN_MASK)             // Celdas jugables
+#define CENTER_MASK     (COLUMN_MASK << (3u * C4_COL_BITS))     // Columna central
+
+/* Tipos de entrada de la tabla de transposición */
+#define TT_EXACT    0u
+#define TT_LOWER    1u
+#define TT_UPPER    2u
+#define TT_SIZE     (1u << C4_TT_BITS)
+
+/* Puntaje de la última celda con victoria posible */
+#define C4_SCORE_MATE   (C4_SCORE_WIN - C4_NUM_CELLS)
+
+typedef struct {
+    uint32_t lock;      // Parte alta de la clave de la posición
+    int16_t score;
+    uint8_t depth;      // 0 = entrada vacía (nunca se guardan hojas)
+    uint8_t info;       // Bits 0-3: mejor columna, bits 4-5: tipo de cota
+} TTEntry_t;
+
+/* Estado de una búsqueda */
+typedef struct {
+    C4_Clock_t clock;
+    uint32_t start;
+    uint32_t budget;
+    uint32_t nodes;
+    bool aborted;
+    bool can_abort;     // false durante la profundidad 1
+} SearchState_t;
+
+/* Variables privadas */
+static TTEntry_t tt[TT_SIZE];
+
+/* Columnas de la central hacia los bordes (desempate del orden de jugadas) */
+static const uint8_t column_order[C4_WIDTH] = {3, 2, 4, 1, 5, 0, 6};
+
+/* Prototipos funciones privadas */
+static C4_Mask_t WinningCells(C4_Mask_t position, C4_Mask_t mask);
+static C4_Mask_t Possible(const C4_Board_t* board);
+static uint8_t Count(C4_Mask_t mask);
+static uint8_t ColumnOf(C4_Mask_t move);
+static void PlayMask(C4_Board_t* board, C4_Mask_t move);
+static int16_t Negamax(SearchState_t* s, const C4_Board_t* board, uint8_t depth, int16_t alpha,
+                       int16_t beta, uint8_t* best_move_out);
+static uint8_t OrderMoves(const C4_Board_t* board, C4_Mask_t candidates, uint8_t first,
+                          C4_Mask_t moves[]);
+static TTEntry_t* ProbeTT(const C4_Board_t* board, uint32_t* lock);
+
+/**
+ * @brief  Vacía el tablero (mueve P1)
+ */
+void C4_Reset(C4_Board_t* board)
+{
+    board->current = 0;
+    board->mask = 0;
+    board->moves = 0;
+}
+
+/**
+ * @brief  Indica si la columna tiene lugar
+ * @param  col: Columna (0-6)
+ */
+bool C4_CanPlay(const C4_Board_t* board, uint8_t col)
+{
+    return col < C4_WIDTH && (board->mask & ((C4_Mask_t)1u << (C4_HEIGHT - 1u + col * C4_COL_BITS))) == 0;
+}
+
+/**
+ * @brief  Suelta una ficha del jugador que mueve en una columna
+ * @param  col: Columna con lugar (ver C4_CanPlay)
+ */
+void C4_Play(C4_Board_t* board, uint8_t col)
+{
+    PlayMask(board, (board->mask + ((C4_Mask_t)1u << (col * C4_COL_BITS))) &
+                        (COLUMN_MASK << (col * C4_COL_BITS)));
+}
+
+/**
+ * @brief  Indica si soltar una ficha en la columna gana la partida
+ * @param  col: Columna con lugar (ver C4_CanPlay)
+ */
+bool C4_IsWinningMove(const C4_Board_t* board, uint8_t col)
+{
+    return (WinningCells(board->current, board->mask) & Possible(board) &
+            (COLUMN_MASK << (col * C4_COL_BITS))) != 0;
+}
+
+/**
+ * @brief  Indica si las fichas de un jugador tienen 4 en línea
+ * @param  position: Fichas del jugador
+ */
+bool C4_HasWon(C4_Mask_t position)
+{
+    static const uint8_t shifts[4] = {1u, C4_COL_BITS - 1u, C4_COL_BITS, C4_COL_BITS + 1u};
+
+    for (uint8_t i = 0; i < 4u; i++) {
+        C4_Mask_t m = position & (position >> shifts[i]);
+        if (m & (m >> (2u * shifts[i]))) {
+            return true;
+        }
+    }
+    return false;
+}
+
+/**
+ * @brief  Aplica una secuencia de columnas escrita con dígitos del 1 al 7
+ * @note   Formato de las posiciones de prueba: "4453" = columnas 4, 4, 5, 3.
+ *         Se detiene en una columna inválida, llena o que gana la partida.
+ * @retval Cantidad de jugadas aplicadas
+ */
+uint8_t C4_PlayString(C4_Board_t* board, const char* moves)
+{
+    uint8_t played = 0;
+
+    for (; moves[played] != '\0'; played++) {
+        uint8_t col = (uint8_t)(moves[played] - '1');
+        if (col >= C4_WIDTH || !C4_CanPlay(board, col) || C4_IsWinningMove(board, col)) {
+            break;
+        }
+        C4_Play(board, col);
+    }
+    return played;
+}
+
+/**
+ * @brief  Evaluación estática desde el punto de vista del jugador que mueve
+ * @note   Celdas libres que completarían 4 en línea y fichas en la columna central
+ */
+int16_t C4_Evaluate(const C4_Board_t* board)
+{
+    C4_Mask_t own = board->current;
+    C4_Mask_t opp = board->current ^ board->mask;
+
+    return (int16_t)(4 * (Count(WinningCells(own, board->mask)) - Count(WinningCells(opp, board->mask))) +
+                     Count(own & CENTER_MASK) - Count(opp & CENTER_MASK));
+}
+
+/**
+ * @brief  Busca la mejor jugada con profundización iterativa y plazo
+ * @param  board: Posición a analizar (no se modifica)
+ * @param  max_depth: Profundidad máxima (hasta C4_MAX_DEPTH)
+ * @param  clock: Reloj para el plazo (NULL = sin plazo)
+ * @param  budget: Plazo en ticks de clock desde la llamada
+ * @param  result: Resultado de la última profundidad completa
+ * @retval None
+ */
+void C4_Search(const C4_Board_t* board, uint8_t max_depth, C4_Clock_t clock, uint32_t budget,
+               C4_Result_t* result)
+{
+    SearchState_t s = {clock, (clock != NULL) ? clock() : 0, budget, 0, false, false};
+    uint8_t remaining = (uint8_t)(C4_NUM_CELLS - board->moves);
+
+    result->best_move = C4_NO_MOVE;
+    result->score = 0;
+    result->depth = 0;
+    result->nodes = 0;
+    result->timed_out = false;
+
+    // Tablero lleno o el rival acaba de ganar
+    if (remaining == 0 || C4_HasWon(board->current ^ board->mask)) {
+        return;
+    }
+    if (max_depth > remaining) {
+        max_depth = remaining;
+    }
+    if (max_depth == 0) {
+        max_depth = 1;
+    }
+
+    for (uint8_t depth = 1; depth <= max_depth; depth++) {
+        uint8_t best_move = C4_NO_MOVE;
+
+        s.can_abort = (depth > 1);
+        int16_t score = Negamax(&s, board, depth, -C4_SCORE_INF, C4_SCORE_INF, &best_move);
+        if (s.aborted) {
+            result->timed_out = true;
+            break;
+        }
+
+        result->best_move = best_move;
+        result->score = score;
+        result->depth = depth;
+
+        // Resultado forzado: más profundidad no cambia nada
+        if (score >= C4_SCORE_MATE || score <= -C4_SCORE_MATE) {
+            break;
+        }
+    }
+    result->nodes = s.nodes;
+}
+
+/**
+ * @brief  Resuelve la posición con búsquedas de ventana nula
+ * @note   Puntaje en la escala habitual de las posiciones de prueba: 0 es
+ *         empate y ganar con la ficha n del ganador vale 22 - n (negativo
+ *         si pierde el que mueve). La posición no puede estar terminada.
+ * @param  clock: Reloj para el plazo (NULL = sin plazo)
+ * @param  budget: Plazo en ticks de clock desde la llamada
+ * @param  score: Puntaje exacto
+ * @param  nodes: Nodos visitados (puede ser NULL)
+ * @retval false si el plazo cortó la búsqueda
+ */
+bool C4_Solve(const C4_Board_t* board, C4_Clock_t clock, uint32_t budget, int8_t* score,
+              uint32_t* nodes)
+{
+    SearchState_t s = {clock, (clock != NULL) ? clock() : 0, budget, 0, false, true};
+    int8_t min = (int8_t)(-(C4_NUM_CELLS - board->moves) / 2);
+    int8_t max = (int8_t)((C4_NUM_CELLS + 1 - board->moves) / 2);
+
+    while (min < max && !s.aborted) {
+        int8_t med = (int8_t)(min + (max - min) / 2);
+        // Probar primero cerca de 0: la mayoría de las posiciones terminan cerca
+        if (med <= 0 && min / 2 < med) {
+            med = (int8_t)(min / 2);
+        } else if (med >= 0 && max / 2 > med) {
+            med = (int8_t)(max / 2);
+        }
+
+        // ¿puntaje >= q? En fichas totales: ganar con a lo sumo 44 - 2q, perder con al menos 43 + 2q
+        int8_t q = (int8_t)(med + 1);
+        int16_t threshold = (q > 0) ? (int16_t)(C4_SCORE_WIN - (C4_NUM_CELLS + 2) + 2 * q)
+                          : (q < 0) ? (int16_t)(-C4_SCORE_WIN + (C4_NUM_CELLS + 1) + 2 * q)
+                          : 0;
+        int16_t r = Negamax(&s, board, C4_MAX_DEPTH, (int16_t)(threshold - 1), threshold, NULL);
+        if (r >= threshold) {
+            min = q;
+        } else {
+            max = med;
+        }
+    }
+
+    *score = min;
+    if (nodes != NULL) {
+        *nodes = s.nodes;
+    }
+    return !s.aborted;
+}
+
+/**
+ * @brief  Vacía la tabla de transposición
+ */
+void C4_ClearTT(void)
+{
+    memset(tt, 0, sizeof(tt));
+}
+
+/**
+ * @brief  Celdas libres que completarían 4 en línea para un jugador
+ * @note   Desplazamientos en las 4 direcciones: 1 (vertical), 7 (horizontal),
+ *         6 y 8 (diagonales). La fila de relleno corta los pasos entre columnas.
+ * @param  position: Fichas del jugador
+ * @param  mask: Todas las fichas
+ */
+static C4_Mask_t WinningCells(C4_Mask_t position, C4_Mask_t mask)
+{
+    // Vertical: solo hacia arriba
+    C4_Mask_t r = (position << 1) & (position << 2) & (position << 3);
+
+    // Horizontal y diagonales: el hueco puede estar en cualquiera de las 4 celdas
+    for (uint8_t d = C4_COL_BITS - 1u; d <= C4_COL_BITS + 1u; d++) {
+        C4_Mask_t p = (position << d) & (position << (2u * d));
+        r |= p & (position << (3u * d));
+        r |= p & (position >> d);
+        p = (position >> d) & (position >> (2u * d));
+        r |= p & (position << d);
+        r |= p & (position >> (3u * d));
+    }
+    return r & (BOARD_MASK ^ mask);
+}
+
+/**
+ * @brief  Celda libre más baja de cada columna
+ */
+static C4_Mask_t Possible(const C4_Board_t* board)
+{
+    return (board->mask + BOTTOM_MASK) & BOARD_MASK;
+}
+
+/**
+ * @brief  Cantidad de bits en 1
+ */
+static uint8_t Count(C4_Mask_t mask)
+{
+    return (uint8_t)__builtin_popcountll(mask);
+}
+
+/**
+ * @brief  Columna de una jugada (máscara de un bit)
+ */
+static uint8_t ColumnOf(C4_Mask_t move)
+{
+    return (uint8_t)(__builtin_ctzll(move) / C4_COL_BITS);
+}
+
+/**
+ * @brief  Aplica una jugada dada como máscara de un bit y pasa el turno
+ */
+static void PlayMask(C4_Board_t* board, C4_Mask_t move)
+{
+    board->current ^= board->mask;  // Las fichas del rival pasan a ser las del que mueve
+    board->mask |= move;
+    board->moves++;
+}
+
+/**
+ * @brief  Negamax con poda alfa-beta
+ * @note   Solo se exploran las jugadas que no dejan ganar al rival en la
+ *         jugada siguiente; si el rival tiene una amenaza la jugada es el
+ *         bloqueo. Con profundidad >= celdas libres el resultado es exacto.
+ * @param  best_move_out: Mejor columna encontrada (solo se usa en la raíz)
+ * @retval Puntaje desde el punto de vista del jugador que mueve
+ */
+static int16_t Negamax(SearchState_t* s, const C4_Board_t* board, uint8_t depth, int16_t alpha,
+                       int16_t beta, uint8_t* best_move_out)
+{
+    C4_Mask_t moves[C4_WIDTH];
+
+    s->nodes++;
+    if (s->can_abort && s->clock != NULL && (s->nodes % C4_CHECK_NODES) == 0 &&
+        (s->clock() - s->start) >= s->budget) {
+        s->aborted = true;
+    }
+    if (s->aborted) {
+        return 0;
+    }
+
+    C4_Mask_t possible = Possible(board);
+    C4_Mask_t wins = WinningCells(board->current, board->mask) & possible;
+    if (wins) {
+        if (best_move_out != NULL) {
+            *best_move_out = ColumnOf(wins & (~wins + 1u));
+        }
+        return (int16_t)(C4_SCORE_WIN - (board->moves + 1));
+    }
+
+    // Sin jugadas que eviten la derrota: el rival gana en la jugada siguiente
+    C4_Mask_t threats = WinningCells(board->current ^ board->mask, board->mask);
+    C4_Mask_t forced = possible & threats;
+    C4_Mask_t next = possible;
+    if (forced) {
+        next = (forced & (forced - 1u)) ? 0 : forced;
+    }
+    next &= ~(threats >> 1);
+    if (next == 0) {
+        if (best_move_out != NULL) {
+            *best_move_out = ColumnOf(possible & (~possible + 1u));
+        }
+        return (int16_t)(-(C4_SCORE_WIN - (board->moves + 2)));
+    }
+
+    // Dos celdas libres y ninguna amenaza: empate
+    if (board->moves >= C4_NUM_CELLS - 2) {
+        if (best_move_out != NULL) {
+            *best_move_out = ColumnOf(next & (~next + 1u));
+        }
+        return 0;
+    }
+
+    uint8_t remaining = (uint8_t)(C4_NUM_CELLS - board->moves);
+    if (depth > remaining) {
+        depth = remaining;  // Misma profundidad para entradas exactas de cualquier búsqueda
+    }
+    if (depth == 0) {
+        return C4_Evaluate(board);
+    }
+
+    // Cotas: no se puede ganar antes de la próxima jugada propia ni perder antes de la siguiente del rival
+    int16_t max = (int16_t)(C4_SCORE_WIN - (board->moves + 3));
+    int16_t min = (int16_t)(-(C4_SCORE_WIN - (board->moves + 4)));
+    if (beta > max) {
+        beta = max;
+        if (alpha >= beta) {
+            return beta;
+        }
+    }
+    if (alpha < min) {
+        alpha = min;
+        if (alpha >= beta) {
+            return alpha;
+        }
+    }
+
+    // Consultar la tabla de transposición
+    uint32_t lock;
+    TTEntry_t* entry = ProbeTT(board, &lock);
+    uint8_t tt_move = C4_NO_MOVE;
+    int16_t alpha_orig = alpha;
+
+    if (entry->lock == lock && entry->depth != 0) {
+        tt_move = entry->info & 0x0Fu;
+        if (entry->depth >= depth) {
+            uint8_t flag = entry->info >> 4;
+            if (flag == TT_EXACT || (flag == TT_LOWER && entry->score >= beta) ||
+                (flag == TT_UPPER && entry->score <= alpha)) {
+                if (best_move_out != NULL) {
+                    *best_move_out = tt_move;
+                }
+                return entry->score;
+            }
+        }
+    }
+
+    uint8_t count = OrderMoves(board, next, tt_move, moves);
+    int16_t best = -C4_SCORE_INF;
+    uint8_t best_move = ColumnOf(moves[0]);
+
+    for (uint8_t i = 0; i < count; i++) {
+        C4_Board_t child = *board;
+        PlayMask(&child, moves[i]);
+        int16_t score = (int16_t)-Negamax(s, &child, (uint8_t)(depth - 1u), (int16_t)-beta,
+                                          (int16_t)-alpha, NULL);
+        if (s->aborted) {
+            return 0;
+        }
+        if (score > best) {
+            best = score;
+            best_move = ColumnOf(moves[i]);
+            if (score > alpha) {
+                alpha = score;
+                if (alpha >= beta) {
+                    break;  // Poda
+                }
+            }
+        }
+    }
+
+    // Guardar (reemplazo por profundidad)
+    if (entry->lock == lock || depth >= entry->depth) {
+        uint8_t flag = (best <= alpha_orig) ? TT_UPPER : (best >= beta) ? TT_LOWER : TT_EXACT;
+        entry->lock = lock;
+        entry->score = best;
+        entry->depth = depth;
+        entry->info = (uint8_t)((flag << 4) | best_move);
+    }
+
+    if (best_move_out != NULL) {
+        *best_move_out = best_move;
+    }
+    return best;
+}
+
+/**
+ * @brief  Ordena las jugadas: primero 'first', después las que crean más
+ *         celdas ganadoras y, al empatar, las más centrales
+ * @param  candidates: Una celda por columna jugable
+ * @param  moves: Arreglo de salida (máscaras de un bit)
+ * @retval Cantidad de jugadas
+ */
+static uint8_t OrderMoves(const C4_Board_t* board, C4_Mask_t candidates, uint8_t first,
+                          C4_Mask_t moves[])
+{
+    uint8_t keys[C4_WIDTH];
+    uint8_t count = 0;
+
+    for (uint8_t i = 0; i < C4_WIDTH; i++) {
+        uint8_t col = column_order[i];
+        C4_Mask_t move = candidates & (COLUMN_MASK << (col * C4_COL_BITS));
+        if (move == 0) {
+            continue;
+        }
+
+        uint8_t key = (col == first) ? 0xFFu
+                                     : Count(WinningCells(board->current | move, board->mask));
+
+        // Inserción estable: conserva el orden de centro a borde entre iguales
+        uint8_t j = count;
+        while (j > 0 && keys[j - 1] < key) {
+            keys[j] = keys[j - 1];
+            moves[j] = moves[j - 1];
+            j--;
+        }
+        keys[j] = key;
+        moves[j] = move;
+        count++;
+    }
+    return count;
+}
+
+/**
+ * @brief  Entrada de la tabla para la posición
+ * @param  lock: Parte de la clave guardada para verificar la entrada
+ */
+static TTEntry_t* ProbeTT(const C4_Board_t* board, uint32_t* lock)
+{
+    uint64_t key = C4_Key(board);
+
+    *lock = (uint32_t)(key >> (C4_NUM_CELLS + C4_WIDTH - 32u));
+    return &tt[(key * 0x9E3779B97F4A7C15ull) >> (64u - C4_TT_BITS)];
+}
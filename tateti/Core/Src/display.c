@@ -8,6 +8,9 @@
 #include "display.h"
 #include "ws2812b.h"
 #include "main.h"
+#include "ultimate.h"
+
+#define ULTIMATE_OVERVIEW_MS  400u  // Tiempo que se ve el tablero grande antes del sub-tablero
 
 /* Mapeo de posiciones lógicas del tablero a LEDs físicos WS2812B
  * 
@@ -34,9 +37,26 @@ static const uint8_t p2_score_leds[3] = {2, 1, 0};
 // LED para indicador de turno (fila 0, columna 3)
 static const uint8_t turn_led = 3;
 
-// Colores actuales de los jugadores
-static WS2812B_Color_t player1_color = {50, 0, 0};  // Rojo por defecto
-static WS2812B_Color_t player2_color = {0, 0, 50};  // Azul por defecto
+// Colores actuales de los jugadores (todos los colores de este archivo son
+// perceptuales: el driver aplica gamma y brillo, ver WS2812B_DEFAULT_BRIGHTNESS)
+static WS2812B_Color_t player1_color = {206, 0, 0};  // Rojo por defecto
+static WS2812B_Color_t player2_color = {0, 0, 206};  // Azul por defecto
+
+// Modo entrenador: tiñe las celdas libres con el valor de cada jugada de P1
+// (tenue para que no se confunda con una ficha)
+static bool coach_mode = false;
+static const WS2812B_Color_t coach_win_color = {0, 99, 0};     // Verde
+static const WS2812B_Color_t coach_draw_color = {90, 79, 0};   // Ámbar
+static const WS2812B_Color_t coach_loss_color = {99, 0, 0};    // Rojo
+
+// Ultimate: sub-tablero que se muestra cuando vence ULTIMATE_OVERVIEW_MS
+// (lo resuelve Display_Process desde el loop principal, sin HAL_Delay)
+static bool overview_pending = false;
+static uint8_t overview_board;
+static uint32_t overview_start;
+
+/* Prototipos funciones privadas */
+static void ShowUltimateBoard(uint8_t sub_board);
 
 /**
  * @brief  Inicializa el módulo de display
@@ -56,6 +76,7 @@ void Display_Init(void)
  */
 void Display_Clear(void)
 {
+    overview_pending = false;
     WS2812B_Clear();
     WS2812B_Update();
 }
@@ -153,6 +174,8 @@ void Display_MatchWinAnimation(WinType_t win_type, CellState_t winner)
 {
     WS2812B_Color_t winner_color = (winner == CELL_PLAYER1) ? player1_color : player2_color;
     uint8_t winning_leds[3];
+
+    overview_pending = false;
     
     // Determinar qué LEDs forman la línea ganadora
     switch (win_type) {
@@ -226,6 +249,8 @@ void Display_MatchWinAnimation(WinType_t win_type, CellState_t winner)
 void Display_GameWinAnimation(CellState_t winner)
 {
     WS2812B_Color_t winner_color = (winner == CELL_PLAYER1) ? player1_color : player2_color;
+
+    overview_pending = false;
     // Animación de barrido de toda la matriz 4x4
     for (uint8_t repeat = 0; repeat < 3; repeat++) {
         // Encender todos los LEDs
@@ -275,8 +300,29 @@ void Display_Update(void)
 void Display_UpdateAll(uint8_t p1_score, uint8_t p2_score, CellState_t current_player)
 {
     CellState_t board[9];
+
+    if (GetGameVariant() == 1) {
+        // Ultimate: primero dónde se juega y, pasado ULTIMATE_OVERVIEW_MS,
+        // las celdas de ese sub-tablero (ver Display_Process)
+        uint8_t active = Ultimate_GetActiveBoard();
+
+        Display_ShowScores(p1_score, p2_score);
+        Display_ShowTurn(current_player);
+        Display_ShowUltimateOverview(active);
+        overview_pending = (active != UT_ANY_BOARD);
+        overview_board = active;
+        overview_start = HAL_GetTick();
+        return;
+    }
+
     Game_GetBoard(board);
     Display_UpdateBoard(board);
+    if (coach_mode && current_player == CELL_PLAYER1) {
+        // Se evalúa antes del envío: el tinte sale en el mismo cuadro que el turno
+        AI_MoveValues_t values;
+        AI_EvaluateMoves(Game_GetDefaultContext(), CELL_PLAYER1, &values);
+        Display_ShowMoveValues(&values);
+    }
     Display_ShowScores(p1_score, p2_score);
     Display_ShowTurn(current_player);
     Display_Update();
@@ -289,6 +335,8 @@ void Display_UpdateAll(uint8_t p1_score, uint8_t p2_score, CellState_t current_p
  */
 void Display_ShowColorSelection(void)
 {
+    overview_pending = false;
+
     // Mitad superior del tablero (LEDs 0-4): Color P1
     for (uint8_t i = 0; i < 5; i++) {
         WS2812B_SetPixelColor(board_to_led[i], player1_color);
@@ -324,7 +372,7 @@ void Display_ShowGameMode(uint8_t mode)
     // PvIA: LED turno con color específico (ej: blanco)
     WS2812B_Color_t mode_color = (mode == 0) ? 
         (WS2812B_Color_t){0, 0, 0} :      // PvP: apagado
-        (WS2812B_Color_t){20, 20, 20};    // PvIA: blanco tenue
+        (WS2812B_Color_t){136, 136, 136};    // PvIA: blanco tenue
     
     WS2812B_SetPixelColor(turn_led, mode_color);
     WS2812B_Update();
@@ -332,26 +380,34 @@ void Display_ShowGameMode(uint8_t mode)
 
 /**
  * @brief  Muestra el nivel de dificultad de la IA en las 9 posiciones del tablero
- * @param  difficulty: Nivel de dificultad (AI_EASY, AI_MEDIUM, AI_HARD)
+ * @param  difficulty: Nivel de dificultad (AI_EASY, AI_MEDIUM, AI_HARD, AI_MCTS, AI_LEARNED)
  * @retval None
  */
 void Display_ShowAIDifficulty(AI_Difficulty_t difficulty)
 {
     WS2812B_Color_t indicator_color;
+
+    overview_pending = false;
     
     // Seleccionar color según dificultad
     switch (difficulty) {
         case AI_EASY:
-            indicator_color = (WS2812B_Color_t){0, 80, 0};  // Verde
+            indicator_color = (WS2812B_Color_t){0, 254, 0};  // Verde
             break;
         case AI_MEDIUM:
-            indicator_color = (WS2812B_Color_t){80, 40, 0};  // Naranja
+            indicator_color = (WS2812B_Color_t){254, 186, 0};  // Naranja
             break;
         case AI_HARD:
-            indicator_color = (WS2812B_Color_t){80, 0, 0};  // Rojo
+            indicator_color = (WS2812B_Color_t){254, 0, 0};  // Rojo
+            break;
+        case AI_MCTS:
+            indicator_color = (WS2812B_Color_t){206, 0, 254};  // Violeta
+            break;
+        case AI_LEARNED:
+            indicator_color = (WS2812B_Color_t){240, 223, 0};  // Amarillo
             break;
         default:
-            indicator_color = (WS2812B_Color_t){20, 20, 20};  // Gris
+            indicator_color = (WS2812B_Color_t){136, 136, 136};  // Gris
             break;
     }
     
@@ -362,3 +418,127 @@ void Display_ShowAIDifficulty(AI_Difficulty_t difficulty)
     
     WS2812B_Update();
 }
+
+/**
+ * @brief  Indica la variante de juego en las 9 posiciones del tablero
+ * @param  variant: 0=tateti (no muestra nada), 1=ultimate (cian)
+ * @retval None
+ */
+void Display_ShowGameVariant(uint8_t variant)
+{
+    if (variant == 0) {
+        return;
+    }
+
+    overview_pending = false;
+    for (uint8_t i = 0; i < 9; i++) {
+        WS2812B_SetPixelColor(board_to_led[i], (WS2812B_Color_t){0, 186, 186});  // Cian
+    }
+    WS2812B_Update();
+}
+
+/**
+ * @brief  Muestra el tablero grande del ultimate: un LED por sub-tablero
+ * @note   Ganado: color del ganador. Empatado: apagado. Abierto: blanco
+ *         tenue (se puede elegir si la jugada es libre). El sub-tablero
+ *         donde se juega, blanco intenso.
+ * @param  highlight: Sub-tablero donde se juega (UT_ANY_BOARD = ninguno)
+ * @retval None
+ */
+void Display_ShowUltimateOverview(uint8_t highlight)
+{
+    const UT_Board_t* ut = Ultimate_GetBoard();
+
+    for (uint8_t i = 0; i < 9; i++) {
+        uint16_t bit = (uint16_t)(1u << i);
+        WS2812B_Color_t color = {0, 0, 0};
+
+        if (i == highlight) {
+            color = (WS2812B_Color_t){186, 186, 186};
+        } else if (ut->won[0] & bit) {
+            color = player1_color;
+        } else if (ut->won[1] & bit) {
+            color = player2_color;
+        } else if (!(ut->closed & bit)) {
+            color = (WS2812B_Color_t){90, 90, 90};
+        }
+        WS2812B_SetPixelColor(board_to_led[i], color);
+    }
+    WS2812B_Update();
+}
+
+/**
+ * @brief  Tareas del display que dependen del tiempo
+ * @note   Llamar en cada vuelta del loop principal. Pasado
+ *         ULTIMATE_OVERVIEW_MS desde Display_UpdateAll muestra las celdas del
+ *         sub-tablero donde se juega; cualquier otra pantalla lo cancela.
+ * @retval None
+ */
+void Display_Process(void)
+{
+    if (overview_pending && (HAL_GetTick() - overview_start) >= ULTIMATE_OVERVIEW_MS) {
+        overview_pending = false;
+        ShowUltimateBoard(overview_board);
+    }
+}
+
+/**
+ * @brief  Activa o desactiva el modo entrenador
+ * @note   Tiene efecto en el próximo Display_UpdateAll (solo tateti 3x3)
+ * @param  enabled: true para teñir las celdas libres durante el turno de P1
+ * @retval None
+ */
+void Display_SetCoachMode(bool enabled)
+{
+    coach_mode = enabled;
+}
+
+/**
+ * @brief  Indica si el modo entrenador está activo
+ * @param  None
+ * @retval true si está activo
+ */
+bool Display_GetCoachMode(void)
+{
+    return coach_mode;
+}
+
+/**
+ * @brief  Tiñe cada celda libre según el valor de jugar ahí
+ * @note   Solo escribe el buffer: lo envía el próximo Display_Update
+ * @param  values: Máscaras de AI_EvaluateMoves (las celdas ocupadas no se tocan)
+ * @retval None
+ */
+void Display_ShowMoveValues(const AI_MoveValues_t* values)
+{
+    for (uint8_t i = 0; i < 9; i++) {
+        uint16_t bit = (uint16_t)(1u << i);
+
+        if (values->win & bit) {
+            WS2812B_SetPixelColor(board_to_led[i], coach_win_color);
+        } else if (values->draw & bit) {
+            WS2812B_SetPixelColor(board_to_led[i], coach_draw_color);
+        } else if (values->loss & bit) {
+            WS2812B_SetPixelColor(board_to_led[i], coach_loss_color);
+        }
+    }
+}
+
+/**
+ * @brief  Muestra las celdas de un sub-tablero del ultimate en el tablero
+ * @param  sub_board: Sub-tablero (0-8)
+ * @retval None
+ */
+static void ShowUltimateBoard(uint8_t sub_board)
+{
+    const UT_Board_t* ut = Ultimate_GetBoard();
+    CellState_t board[9];
+
+    for (uint8_t i = 0; i < 9; i++) {
+        uint16_t bit = (uint16_t)(1u << i);
+        board[i] = (ut->cells[0][sub_board] & bit) ? CELL_PLAYER1 :
+                   (ut->cells[1][sub_board] & bit) ? CELL_PLAYER2 : CELL_EMPTY;
+    }
+    Display_UpdateBoard(board);
+    Display_Update();
+}
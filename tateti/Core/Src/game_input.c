@@ -161,6 +161,29 @@ bool GameInput_IsResetAction(Keyboard_Key_t key)
     return (GameInput_ProcessKey(key).action == ACTION_RESET);
 }
 
+/**
+ * @brief  Verifica si la tecla es deshacer jugada
+ * @note   Es la misma tecla que el color de P1: el statechart solo la
+ *         interpreta como deshacer en Playing y como color en Idle
+ * @param  key: Tecla presionada
+ * @retval true si es deshacer (P3), false en caso contrario
+ */
+bool GameInput_IsUndoAction(Keyboard_Key_t key)
+{
+    return (key == KEY_P3);
+}
+
+/**
+ * @brief  Verifica si la tecla es rehacer jugada
+ * @note   Misma tecla que el color de P2 (ver GameInput_IsUndoAction)
+ * @param  key: Tecla presionada
+ * @retval true si es rehacer (P7), false en caso contrario
+ */
+bool GameInput_IsRedoAction(Keyboard_Key_t key)
+{
+    return (key == KEY_P7);
+}
+
 /**
  * @brief  Convierte tecla a posición del tablero
  * @param  key: Tecla presionada
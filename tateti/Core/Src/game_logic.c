@@ -5,24 +5,301 @@
  ******************************************************************************
  */
 
+#include <stddef.h>
 #include "game_logic.h"
-#include <string.h>
 
 /* Variables privadas */
-static CellState_t board[9];
-
-/* Combinaciones ganadoras: [fila][columna] */
-static const uint8_t win_combinations[8][3] = {
-    {0, 1, 2},  // Fila 0
-    {3, 4, 5},  // Fila 1
-    {6, 7, 8},  // Fila 2
-    {0, 3, 6},  // Columna 0
-    {1, 4, 7},  // Columna 1
-    {2, 5, 8},  // Columna 2
-    {0, 4, 8},  // Diagonal principal
-    {2, 4, 6}   // Diagonal anti
+static GameContext_t default_ctx;
+
+/* Líneas que pasan por cada celda (bit i = BB_WinMasks[i]) */
+static const uint8_t cell_lines[BB_NUM_CELLS] = {
+    0x49, 0x11, 0xA1,   // Fila 0: (F0, C0, DP)  (F0, C1)  (F0, C2, DA)
+    0x0A, 0xD2, 0x22,   // Fila 1: (F1, C0)  (F1, C1, DP, DA)  (F1, C2)
+    0x8C, 0x14, 0x64    // Fila 2: (F2, C0, DA)  (F2, C1)  (F2, C2, DP)
 };
 
+/* Prototipos funciones privadas */
+static bool ApplyMove(GameContext_t* ctx, uint8_t position, CellState_t player, GameMove_t* move);
+static WinType_t UpdateLines(GameContext_t* ctx, uint8_t p, uint8_t position, int8_t delta);
+
+/*============================================================================*/
+/* Funciones con contexto explícito                                           */
+/*============================================================================*/
+
+/**
+ * @brief  Inicializa el tablero de un contexto
+ * @param  ctx: Contexto de la partida
+ * @retval None
+ */
+void GameCtx_Init(GameContext_t* ctx)
+{
+    Bitboard_Clear(&ctx->board);
+    ctx->move_count = 0;
+    for (uint8_t i = 0; i < BB_NUM_LINES; i++) {
+        ctx->line_count[0][i] = 0;
+        ctx->line_count[1][i] = 0;
+    }
+    ctx->win = WIN_NONE;
+    ctx->history_head = 0;
+    ctx->history_undo = 0;
+    ctx->history_redo = 0;
+}
+
+/**
+ * @brief  Resetea el tablero de un contexto (equivalente a Init)
+ * @param  ctx: Contexto de la partida
+ * @retval None
+ */
+void GameCtx_Reset(GameContext_t* ctx)
+{
+    GameCtx_Init(ctx);
+}
+
+/**
+ * @brief  Verifica si un movimiento es válido
+ * @param  ctx: Contexto de la partida
+ * @param  position: Posición del tablero (0-8)
+ * @retval true si la posición está vacía y es válida, false en caso contrario
+ */
+bool GameCtx_IsValidMove(const GameContext_t* ctx, uint8_t position)
+{
+    if (position > 8) {
+        return false;
+    }
+    return (Bitboard_Empty(&ctx->board) & (1u << position)) != 0;
+}
+
+/**
+ * @brief  Realiza un movimiento en el tablero y lo agrega al historial
+ * @param  ctx: Contexto de la partida
+ * @param  position: Posición del tablero (0-8)
+ * @param  player: CELL_PLAYER1 o CELL_PLAYER2
+ * @retval None
+ */
+void GameCtx_MakeMove(GameContext_t* ctx, uint8_t position, CellState_t player)
+{
+    GameMove_t move;
+
+    if (!ApplyMove(ctx, position, player, &move)) {
+        return;
+    }
+
+    // Una jugada nueva descarta las deshechas; lleno, se pisa la más vieja
+    ctx->history[ctx->history_head] = move;
+    ctx->history_head = (uint8_t)((ctx->history_head + 1u) & (GAME_HISTORY_SIZE - 1u));
+    if (ctx->history_undo < GAME_HISTORY_SIZE) {
+        ctx->history_undo++;
+    }
+    ctx->history_redo = 0;
+}
+
+/**
+ * @brief  Deshace la última jugada del historial en O(1)
+ * @param  ctx: Contexto de la partida
+ * @param  move_out: Jugada deshecha (puede ser NULL)
+ * @retval true si había una jugada para deshacer
+ */
+bool GameCtx_UndoMove(GameContext_t* ctx, GameMove_t* move_out)
+{
+    if (ctx->history_undo == 0) {
+        return false;
+    }
+
+    ctx->history_head = (uint8_t)((ctx->history_head - 1u) & (GAME_HISTORY_SIZE - 1u));
+    ctx->history_undo--;
+    ctx->history_redo++;
+
+    const GameMove_t* move = &ctx->history[ctx->history_head];
+    uint16_t bit = (uint16_t)(1u << move->position);
+    uint8_t p = (uint8_t)(move->player - CELL_PLAYER1);
+
+    // Sacar la ficha y devolver la celda a su dueño anterior
+    if (p == 0) {
+        ctx->board.p1 &= (uint16_t)~bit;
+    } else {
+        ctx->board.p2 &= (uint16_t)~bit;
+    }
+    UpdateLines(ctx, p, move->position, -1);
+
+    if (move->previous == CELL_EMPTY) {
+        ctx->move_count--;
+    } else {
+        uint8_t q = (uint8_t)(move->previous - CELL_PLAYER1);
+        if (q == 0) {
+            ctx->board.p1 |= bit;
+        } else {
+            ctx->board.p2 |= bit;
+        }
+        UpdateLines(ctx, q, move->position, 1);
+    }
+    ctx->win = (WinType_t)move->win;
+
+    if (move_out != NULL) {
+        *move_out = *move;
+    }
+    return true;
+}
+
+/**
+ * @brief  Rehace la última jugada deshecha
+ * @param  ctx: Contexto de la partida
+ * @param  move_out: Jugada rehecha (puede ser NULL)
+ * @retval true si había una jugada para rehacer
+ */
+bool GameCtx_RedoMove(GameContext_t* ctx, GameMove_t* move_out)
+{
+    if (ctx->history_redo == 0) {
+        return false;
+    }
+
+    GameMove_t move = ctx->history[ctx->history_head];
+    ApplyMove(ctx, move.position, (CellState_t)move.player, &move);
+
+    ctx->history_head = (uint8_t)((ctx->history_head + 1u) & (GAME_HISTORY_SIZE - 1u));
+    ctx->history_undo++;
+    ctx->history_redo--;
+
+    if (move_out != NULL) {
+        *move_out = move;
+    }
+    return true;
+}
+
+/**
+ * @brief  Indica si hay jugadas para deshacer
+ * @param  ctx: Contexto de la partida
+ * @retval true si GameCtx_UndoMove() tendría efecto
+ */
+bool GameCtx_CanUndo(const GameContext_t* ctx)
+{
+    return ctx->history_undo != 0;
+}
+
+/**
+ * @brief  Indica si hay jugadas deshechas para rehacer
+ * @param  ctx: Contexto de la partida
+ * @retval true si GameCtx_RedoMove() tendría efecto
+ */
+bool GameCtx_CanRedo(const GameContext_t* ctx)
+{
+    return ctx->history_redo != 0;
+}
+
+/**
+ * @brief  Verifica si hay un ganador
+ * @param  ctx: Contexto de la partida
+ * @retval WIN_NONE si no hay ganador, o el tipo de victoria (WIN_ROW0, etc.)
+ */
+WinType_t GameCtx_CheckWin(const GameContext_t* ctx)
+{
+    return ctx->win;
+}
+
+/**
+ * @brief  Verifica si hay empate (tablero lleno sin ganador)
+ * @param  ctx: Contexto de la partida
+ * @retval true si hay empate, false en caso contrario
+ */
+bool GameCtx_CheckDraw(const GameContext_t* ctx)
+{
+    return ctx->move_count == BB_NUM_CELLS && ctx->win == WIN_NONE;
+}
+
+/**
+ * @brief  Obtiene el estado de una celda específica
+ * @param  ctx: Contexto de la partida
+ * @param  position: Posición del tablero (0-8)
+ * @retval Estado de la celda (CELL_EMPTY, CELL_PLAYER1, CELL_PLAYER2)
+ */
+CellState_t GameCtx_GetCell(const GameContext_t* ctx, uint8_t position)
+{
+    if (position > 8) {
+        return CELL_EMPTY;
+    }
+
+    uint16_t bit = (uint16_t)(1u << position);
+    if (ctx->board.p1 & bit) return CELL_PLAYER1;
+    if (ctx->board.p2 & bit) return CELL_PLAYER2;
+    return CELL_EMPTY;
+}
+
+/**
+ * @brief  Copia el tablero completo a un array externo
+ * @param  ctx: Contexto de la partida
+ * @param  board_out: Array de destino [9]
+ * @retval None
+ */
+void GameCtx_GetBoard(const GameContext_t* ctx, CellState_t board_out[9])
+{
+    for (uint8_t i = 0; i < 9; i++) {
+        board_out[i] = GameCtx_GetCell(ctx, i);
+    }
+}
+
+/**
+ * @brief  Obtiene el tablero en formato de máscaras de bits
+ * @param  ctx: Contexto de la partida
+ * @retval Copia del bitboard
+ */
+Bitboard_t GameCtx_GetBitboard(const GameContext_t* ctx)
+{
+    return ctx->board;
+}
+
+/*============================================================================*/
+/* Evaluación pura                                                            */
+/*============================================================================*/
+
+/**
+ * @brief  Verifica si hay un ganador en un tablero arbitrario
+ * @param  board: Tablero a evaluar [9]
+ * @retval WIN_NONE si no hay ganador, o el tipo de victoria
+ */
+WinType_t Game_CheckWinOn(const CellState_t board[9])
+{
+    Bitboard_t bb = {0, 0};
+
+    for (uint8_t i = 0; i < 9; i++) {
+        if (board[i] == CELL_PLAYER1) {
+            bb.p1 |= (uint16_t)(1u << i);
+        } else if (board[i] == CELL_PLAYER2) {
+            bb.p2 |= (uint16_t)(1u << i);
+        }
+    }
+    return Game_CheckWinBitboard(&bb);
+}
+
+/**
+ * @brief  Verifica si hay un ganador en un bitboard arbitrario
+ * @param  board: Tablero a evaluar
+ * @retval WIN_NONE si no hay ganador, o el tipo de victoria
+ */
+WinType_t Game_CheckWinBitboard(const Bitboard_t* board)
+{
+    // Una línea de P1 y otra de P2 no pueden coexistir en partidas válidas;
+    // se respeta el orden de líneas para devolver siempre la primera
+    uint8_t line1 = Bitboard_WinLine(board->p1);
+    uint8_t line2 = Bitboard_WinLine(board->p2);
+
+    if (line1 == 0) return (WinType_t)line2;
+    if (line2 == 0) return (WinType_t)line1;
+    return (WinType_t)((line1 < line2) ? line1 : line2);
+}
+
+/*============================================================================*/
+/* Contexto por defecto (API original)                                        */
+/*============================================================================*/
+
+/**
+ * @brief  Obtiene el contexto usado por las funciones Game_* sin contexto
+ * @param  None
+ * @retval Puntero al contexto por defecto
+ */
+GameContext_t* Game_GetDefaultContext(void)
+{
+    return &default_ctx;
+}
+
 /**
  * @brief  Inicializa el tablero del juego
  * @param  None
@@ -30,7 +307,7 @@ static const uint8_t win_combinations[8][3] = {
  */
 void Game_Init(void)
 {
-    memset(board, CELL_EMPTY, sizeof(board));
+    GameCtx_Init(&default_ctx);
 }
 
 /**
@@ -40,7 +317,7 @@ void Game_Init(void)
  */
 void Game_Reset(void)
 {
-    Game_Init();
+    GameCtx_Reset(&default_ctx);
 }
 
 /**
@@ -50,10 +327,7 @@ void Game_Reset(void)
  */
 bool Game_IsValidMove(uint8_t position)
 {
-    if (position > 8) {
-        return false;
-    }
-    return (board[position] == CELL_EMPTY);
+    return GameCtx_IsValidMove(&default_ctx, position);
 }
 
 /**
@@ -64,9 +338,7 @@ bool Game_IsValidMove(uint8_t position)
  */
 void Game_MakeMove(uint8_t position, CellState_t player)
 {
-    if (position <= 8 && player != CELL_EMPTY) {
-        board[position] = player;
-    }
+    GameCtx_MakeMove(&default_ctx, position, player);
 }
 
 /**
@@ -76,19 +348,7 @@ void Game_MakeMove(uint8_t position, CellState_t player)
  */
 WinType_t Game_CheckWin(void)
 {
-    for (uint8_t i = 0; i < 8; i++) {
-        uint8_t pos0 = win_combinations[i][0];
-        uint8_t pos1 = win_combinations[i][1];
-        uint8_t pos2 = win_combinations[i][2];
-        
-        if (board[pos0] != CELL_EMPTY &&
-            board[pos0] == board[pos1] &&
-            board[pos1] == board[pos2]) {
-            // Retornar el tipo de victoria (1-8)
-            return (WinType_t)(i + 1);
-        }
-    }
-    return WIN_NONE;
+    return GameCtx_CheckWin(&default_ctx);
 }
 
 /**
@@ -98,19 +358,7 @@ WinType_t Game_CheckWin(void)
  */
 bool Game_CheckDraw(void)
 {
-    // Si hay ganador, no puede haber empate
-    if (Game_CheckWin() != WIN_NONE) {
-        return false;
-    }
-    
-    // Verificar si todas las celdas están ocupadas
-    for (uint8_t i = 0; i < 9; i++) {
-        if (board[i] == CELL_EMPTY) {
-            return false;
-        }
-    }
-    
-    return true;
+    return GameCtx_CheckDraw(&default_ctx);
 }
 
 /**
@@ -120,18 +368,136 @@ bool Game_CheckDraw(void)
  */
 CellState_t Game_GetCell(uint8_t position)
 {
-    if (position > 8) {
-        return CELL_EMPTY;
-    }
-    return board[position];
+    return GameCtx_GetCell(&default_ctx, position);
 }
 
 /**
  * @brief  Copia el tablero completo a un array externo
- * @param  board: Array de destino [9]
+ * @param  board_out: Array de destino [9]
  * @retval None
  */
 void Game_GetBoard(CellState_t board_out[9])
 {
-    memcpy(board_out, board, sizeof(board));
+    GameCtx_GetBoard(&default_ctx, board_out);
+}
+
+/**
+ * @brief  Obtiene el tablero en formato de máscaras de bits
+ * @param  None
+ * @retval Copia del bitboard actual
+ */
+Bitboard_t Game_GetBitboard(void)
+{
+    return GameCtx_GetBitboard(&default_ctx);
+}
+
+/**
+ * @brief  Deshace la última jugada
+ * @param  move_out: Jugada deshecha (puede ser NULL)
+ * @retval true si había una jugada para deshacer
+ */
+bool Game_UndoMove(GameMove_t* move_out)
+{
+    return GameCtx_UndoMove(&default_ctx, move_out);
+}
+
+/**
+ * @brief  Rehace la última jugada deshecha
+ * @param  move_out: Jugada rehecha (puede ser NULL)
+ * @retval true si había una jugada para rehacer
+ */
+bool Game_RedoMove(GameMove_t* move_out)
+{
+    return GameCtx_RedoMove(&default_ctx, move_out);
+}
+
+/**
+ * @brief  Indica si hay jugadas para deshacer
+ * @param  None
+ * @retval true si Game_UndoMove() tendría efecto
+ */
+bool Game_CanUndo(void)
+{
+    return GameCtx_CanUndo(&default_ctx);
+}
+
+/**
+ * @brief  Indica si hay jugadas deshechas para rehacer
+ * @param  None
+ * @retval true si Game_RedoMove() tendría efecto
+ */
+bool Game_CanRedo(void)
+{
+    return GameCtx_CanRedo(&default_ctx);
+}
+
+/**
+ * @brief  Ocupa una celda y actualiza contadores y resultado (sin historial)
+ * @param  position: Posición del tablero (0-8)
+ * @param  player: CELL_PLAYER1 o CELL_PLAYER2
+ * @param  move: Datos para deshacer la jugada
+ * @retval false si la jugada no cambia el tablero
+ */
+static bool ApplyMove(GameContext_t* ctx, uint8_t position, CellState_t player, GameMove_t* move)
+{
+    if (position > 8 || (player != CELL_PLAYER1 && player != CELL_PLAYER2)) {
+        return false;
+    }
+
+    uint16_t bit = (uint16_t)(1u << position);
+    uint8_t p = (uint8_t)(player - CELL_PLAYER1);
+    uint16_t* own = (p == 0) ? &ctx->board.p1 : &ctx->board.p2;
+    uint16_t* other = (p == 0) ? &ctx->board.p2 : &ctx->board.p1;
+
+    if (*own & bit) {
+        return false;  // La celda ya era suya
+    }
+    move->position = position;
+    move->player = (uint8_t)player;
+    move->previous = CELL_EMPTY;
+    move->win = (uint8_t)ctx->win;
+
+    if (*other & bit) {
+        // Sobrescribir una ficha del rival puede romper su línea: recalcular
+        move->previous = (uint8_t)((p == 0) ? CELL_PLAYER2 : CELL_PLAYER1);
+        *other &= (uint16_t)~bit;
+        *own |= bit;
+        UpdateLines(ctx, (uint8_t)(p ^ 1u), position, -1);
+        UpdateLines(ctx, p, position, 1);
+        ctx->win = Game_CheckWinBitboard(&ctx->board);
+        return true;
+    }
+
+    *own |= bit;
+    ctx->move_count++;
+
+    // Solo las líneas de esta celda pueden completarse; se conserva la primera
+    WinType_t win = UpdateLines(ctx, p, position, 1);
+    if (win != WIN_NONE && (ctx->win == WIN_NONE || win < ctx->win)) {
+        ctx->win = win;
+    }
+    return true;
+}
+
+/**
+ * @brief  Suma o resta una ficha en los contadores de las líneas de una celda
+ * @param  p: Jugador (0 = P1, 1 = P2)
+ * @param  position: Celda (0-8)
+ * @param  delta: +1 al ocupar, -1 al liberar
+ * @retval Primera línea completada por la ficha (WIN_NONE si ninguna)
+ */
+static WinType_t UpdateLines(GameContext_t* ctx, uint8_t p, uint8_t position, int8_t delta)
+{
+    uint8_t lines = cell_lines[position];
+    WinType_t win = WIN_NONE;
+
+    while (lines) {
+        uint8_t line = (uint8_t)__builtin_ctz(lines);
+        lines &= (uint8_t)(lines - 1u);
+        ctx->line_count[p][line] = (uint8_t)(ctx->line_count[p][line] + delta);
+        if (ctx->line_count[p][line] == 3 && win == WIN_NONE) {
+            win = (WinType_t)(line + 1);
+        }
+    }
+    return win;
 }
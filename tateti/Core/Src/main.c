@@ -35,6 +35,10 @@
 #include "game_input.h"
 #include "color_manager.h"
 #include "ai.h"
+#include "ai_bench.h"
+#include "nn_bench.h"
+#include "ws2812b_bench.h"
+#include "ultimate.h"
 /* USER CODE END Includes */
 
 /* Private typedef -----------------------------------------------------------*/
@@ -44,7 +48,9 @@
 
 /* Private define ------------------------------------------------------------*/
 /* USER CODE BEGIN PD */
-
+#define AI_THINK_DELAY_MS    500u   // Tiempo mínimo de "pensamiento" visible
+#define AI_MOVE_DEADLINE_MS  2000u  // Plazo máximo de búsqueda por jugada
+#define AI_STEP_BUDGET_US    2000u  // CPU cedida a la IA por vuelta del loop
 /* USER CODE END PD */
 
 /* Private macro -------------------------------------------------------------*/
@@ -57,11 +63,23 @@
 /* USER CODE BEGIN PV */
 static Tateti statechart_handle;
 static uint8_t game_mode = 0;  // 0=PvP, 1=PvIA
+static uint8_t game_variant = 0;  // 0=tateti, 1=ultimate tateti
+static bool ai_thinking = false;
+static bool ai_pondering = false;
+static uint32_t ai_think_start = 0;
+#if WS2812B_DITHER
+static uint32_t dither_last_ms = 0;       // Último refresco del dithering de los LEDs
+#endif
 
 // Getter para game_mode
 uint8_t GetGameMode(void) {
     return game_mode;
 }
+
+// Getter para game_variant
+uint8_t GetGameVariant(void) {
+    return game_variant;
+}
 /* USER CODE END PV */
 
 /* Private function prototypes -----------------------------------------------*/
@@ -122,6 +140,19 @@ int main(void)
   
   // Iniciar timer para teclado
   HAL_TIM_Base_Start_IT(&htim6);
+  
+#ifdef AI_BENCH_ON_TARGET
+  // Benchmark de la IA por USART3 (CSV) antes de arrancar el juego
+  AIBench_RunTarget(AI_BENCH_ON_TARGET);
+#endif
+#ifdef NN_BENCH_ON_TARGET
+  // Exactitud de los núcleos y latencia de la red de evaluación por USART3 (CSV)
+  NNBench_RunTarget();
+#endif
+#ifdef WS2812B_BENCH_ON_TARGET
+  // Codificadores WS2812B (saltos contra tabla) en ciclos por USART3 (CSV)
+  WS2812BBench_RunTarget();
+#endif
   /* USER CODE END 2 */
 
   /* Infinite loop */
@@ -142,14 +173,25 @@ int main(void)
         // Si estamos en IDLE, procesar teclas especiales
         if (tateti_is_state_active(&statechart_handle, Tateti_main_region_Idle)) {
             if (key == KEY_P11) {
-                // P11: Toggle modo de juego (PvP ↔ PvIA)
+                // P11: Ciclo de modo de juego
+                // PvP → PvIA → PvP ultimate → PvIA ultimate → PvP
                 game_mode = !game_mode;
+                if (game_mode == 0) {
+                    game_variant = !game_variant;
+                }
                 Display_ShowGameMode(game_mode);
                 
                 // Mostrar nivel de dificultad si se activa modo IA
                 if (game_mode == 1) {
                     Display_ShowAIDifficulty(AI_GetDifficulty());
                 }
+                // Ultimate: después, todo el tablero en cian
+                if (game_variant == 1) {
+                    if (game_mode == 1) {
+                        HAL_Delay(500);
+                    }
+                    Display_ShowGameVariant(game_variant);
+                }
                 
                 HAL_Delay(500);
                 Display_ShowColorSelection();
@@ -167,29 +209,119 @@ int main(void)
                 Display_ShowColorSelection();
             } else if (key == KEY_P2 && game_mode == 1) {
                 // P2: Dificultad Difícil (solo en modo IA) - Rojo en esquinas
-                AI_SetDifficulty(AI_HARD);
-                Display_ShowAIDifficulty(AI_HARD);
+                // Pulsado de nuevo pasa a Monte-Carlo (violeta), después a la
+                // política aprendida (amarillo) y vuelve a Difícil
+                AI_Difficulty_t current = AI_GetDifficulty();
+                AI_Difficulty_t level = (current == AI_HARD) ? AI_MCTS :
+                                        (current == AI_MCTS) ? AI_LEARNED : AI_HARD;
+                AI_SetDifficulty(level);
+                Display_ShowAIDifficulty(level);
                 HAL_Delay(500);
                 Display_ShowColorSelection();
             } else {
                 // Otras teclas: enviar al statechart
                 tateti_raise_key_pressed(&statechart_handle, (sc_integer)key);
             }
+        } else if (key == KEY_P0 && game_variant == 0 &&
+                   tateti_is_state_active(&statechart_handle, Tateti_main_region_Playing)) {
+            // P0 en juego: modo entrenador (valor de cada jugada de P1)
+            Display_SetCoachMode(!Display_GetCoachMode());
+            Display_UpdateAll((uint8_t)tateti_get_p1_score(&statechart_handle),
+                              (uint8_t)tateti_get_p2_score(&statechart_handle),
+                              (CellState_t)tateti_get_current_player(&statechart_handle));
+        } else if (ai_thinking && GameInput_IsBoardAction(key)) {
+            // Mientras piensa la IA las casillas no son del jugador humano
+        } else if (game_variant == 1 && GameInput_IsBoardAction(key) &&
+                   tateti_is_state_active(&statechart_handle, Tateti_main_region_Playing) &&
+                   Ultimate_GetActiveBoard() == UT_ANY_BOARD) {
+            // Ultimate con jugada libre: la primera tecla elige el sub-tablero
+            if (Ultimate_SelectBoard(GameInput_KeyToPosition(key))) {
+                Display_UpdateAll((uint8_t)tateti_get_p1_score(&statechart_handle),
+                                  (uint8_t)tateti_get_p2_score(&statechart_handle),
+                                  (CellState_t)tateti_get_current_player(&statechart_handle));
+            }
         } else {
-            // Fuera de IDLE: enviar evento al statechart
+            // Fuera de IDLE: enviar evento al statechart (P15 resetea siempre)
             tateti_raise_key_pressed(&statechart_handle, (sc_integer)key);
+
+            // Deshacer/rehacer cambia la posición: descartar lo que pensaba la IA
+            if ((GameInput_IsUndoAction(key) || GameInput_IsRedoAction(key)) &&
+                (ai_thinking || ai_pondering)) {
+                ai_thinking = false;
+                ai_pondering = false;
+                AI_CancelSearch();
+                AI_StopPonder();
+            }
         }
     }
     
-    // Si modo IA y es turno de P2 en estado PLAYING, generar movimiento
+    // Si modo IA y es turno de P2 en estado PLAYING, avanzar la búsqueda sin
+    // bloquear: el teclado se sigue atendiendo en cada vuelta del loop
     if (game_mode == 1 && 
         tateti_is_state_active(&statechart_handle, Tateti_main_region_Playing) &&
         tateti_get_current_player(&statechart_handle) == 2) {
         
-        HAL_Delay(500);  // Delay para simular "pensamiento" de la IA
-        Keyboard_Key_t ai_move = AI_CalculateMove();
-        tateti_raise_key_pressed(&statechart_handle, (sc_integer)ai_move);
+        if (!ai_thinking && game_variant == 1) {
+            // Ultimate: AI_Step la avanza hasta ULTIMATE_AI_BUDGET_MS
+            AI_BeginSearchUltimate(Ultimate_GetBoard());
+            ai_think_start = HAL_GetTick();
+            ai_thinking = true;
+        } else if (!ai_thinking) {
+            // Usa la respuesta pensada durante el turno de P1 si la hay
+            ai_pondering = false;
+            AI_BeginSearch(Game_GetDefaultContext(), AI_MOVE_DEADLINE_MS);
+            ai_think_start = HAL_GetTick();
+            ai_thinking = true;
+        }
+        
+        AI_Step(AI_STEP_BUDGET_US);
+        
+        uint8_t ai_position;
+        if (AI_Poll(&ai_position) &&
+            (HAL_GetTick() - ai_think_start) >= AI_THINK_DELAY_MS) {
+            ai_thinking = false;
+            AI_CancelSearch();
+            if (game_variant == 1) {
+                // La jugada es sub-tablero * 9 + celda: elegir el sub-tablero si es libre
+                if (Ultimate_GetActiveBoard() == UT_ANY_BOARD) {
+                    Ultimate_SelectBoard(ai_position / 9u);
+                }
+                ai_position %= 9u;
+            }
+            tateti_raise_key_pressed(&statechart_handle, (sc_integer)AI_PositionToKey(ai_position));
+        }
+    } else if (game_mode == 1 && game_variant == 0 &&
+               tateti_is_state_active(&statechart_handle, Tateti_main_region_Playing) &&
+               tateti_get_current_player(&statechart_handle) == 1) {
+        
+        // Turno de P1: aprovechar el tiempo ocioso para pensar las respuestas
+        if (ai_thinking) {
+            ai_thinking = false;
+            AI_CancelSearch();
+        }
+        if (!ai_pondering) {
+            AI_BeginPonder(Game_GetDefaultContext());
+            ai_pondering = true;
+        }
+        AI_Ponder(AI_STEP_BUDGET_US);
+    } else if (ai_thinking || ai_pondering) {
+        // Reset o fin de partida durante la búsqueda: descartarla
+        ai_thinking = false;
+        ai_pondering = false;
+        AI_CancelSearch();
+        AI_StopPonder();
+    }
+
+    // Pantallas temporizadas (p. ej. el tablero grande del ultimate)
+    Display_Process();
+
+#if WS2812B_DITHER
+    // El dithering temporal necesita tramas seguidas para promediar los restos
+    if ((HAL_GetTick() - dither_last_ms) >= WS2812B_DITHER_PERIOD_MS) {
+        dither_last_ms = HAL_GetTick();
+        WS2812B_Update();
     }
+#endif
   }
   /* USER CODE END 3 */
 }
@@ -207,6 +339,30 @@ void HAL_TIM_PeriodElapsedCallback(TIM_HandleTypeDef *htim)
     }
 }
 
+/**
+  * @brief  PWM pulse finished callback (fin de la trama DMA de los LEDs)
+  * @param  htim : TIM handle
+  * @retval None
+  */
+void HAL_TIM_PWM_PulseFinishedCallback(TIM_HandleTypeDef *htim)
+{
+    if (htim->Instance == WS2812B_TIMER.Instance) {
+        WS2812B_TransferComplete();
+    }
+}
+
+/**
+  * @brief  PWM pulse finished half complete callback (medio buffer DMA de los LEDs)
+  * @param  htim : TIM handle
+  * @retval None
+  */
+void HAL_TIM_PWM_PulseFinishedHalfCpltCallback(TIM_HandleTypeDef *htim)
+{
+    if (htim->Instance == WS2812B_TIMER.Instance) {
+        WS2812B_HalfTransfer();
+    }
+}
+
 /**
   * @brief System Clock Configuration
   * @retval None
@@ -253,7 +409,17 @@ void SystemClock_Config(void)
 }
 
 /* USER CODE BEGIN 4 */
-
+/**
+  * @brief  Salida de printf por USART3 (puerto virtual del ST-LINK)
+  * @param  ch: Caracter a enviar
+  * @retval El mismo caracter
+  */
+int __io_putchar(int ch)
+{
+  uint8_t c = (uint8_t)ch;
+  HAL_UART_Transmit(&huart3, &c, 1, HAL_MAX_DELAY);
+  return ch;
+}
 /* USER CODE END 4 */
 
 /**
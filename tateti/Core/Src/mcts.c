@@ -0,0 +1,433 @@
+/**
+ ******************************************************************************
+ * @file    mcts.c
+ * @brief   Implementación de la búsqueda Monte-Carlo (UCT)
+ ******************************************************************************
+ */
+
+#include "mcts.h"
+#include <math.h>
+
+/* Prototipos funciones privadas */
+static uint32_t NextRandom(uint32_t* rng);
+static uint16_t AllocNode(MCTS_Tree_t* tree, uint16_t parent, uint8_t move, const MNK_Board_t* board);
+static uint16_t NewRoot(MCTS_Tree_t* tree, const MNK_Board_t* board);
+static uint16_t FindChild(const MCTS_Tree_t* tree, uint16_t index, uint8_t move);
+static uint16_t FindDescendant(const MCTS_Tree_t* tree, const MNK_Board_t* board);
+static void KeepSubtree(MCTS_Tree_t* tree, uint16_t index);
+static uint16_t SelectChild(const MCTS_Tree_t* tree, const MCTS_Node_t* node);
+static uint8_t RandomCell(MNK_Mask_t mask, uint32_t* rng);
+
+/**
+ * @brief  Inicializa un árbol vacío
+ * @param  tree: Árbol a inicializar
+ * @param  rules: Variante en juego
+ * @param  nodes: Arreglo de nodos (techo de memoria del árbol)
+ * @param  capacity: Cantidad de nodos del arreglo (hasta MCTS_MAX_NODES)
+ * @param  seed: Semilla del generador de simulaciones
+ */
+void MCTS_Init(MCTS_Tree_t* tree, const MNK_Rules_t* rules, MCTS_Node_t* nodes, uint16_t capacity,
+               uint32_t seed)
+{
+    tree->rules = rules;
+    tree->nodes = nodes;
+    tree->capacity = (capacity > MCTS_MAX_NODES) ? MCTS_MAX_NODES : capacity;
+    tree->rng = (seed != 0) ? seed : 0x9E3779B9u;
+    MCTS_Reset(tree);
+}
+
+/**
+ * @brief  Descarta el árbol completo en O(1)
+ * @note   No hace falta limpiar los nodos: se reescriben al asignarlos
+ */
+void MCTS_Reset(MCTS_Tree_t* tree)
+{
+    tree->used = 0;
+    tree->live = 0;
+    tree->free_list = MCTS_NULL;
+    tree->root = MCTS_NULL;
+    tree->iterations = 0;
+    tree->reused = 0;
+}
+
+/**
+ * @brief  Fija la posición a analizar
+ * @note   Si la posición desciende de la raíz actual (hasta dos jugadas) se
+ *         conserva su subárbol y se libera el resto; si no, se empieza de cero
+ * @param  tree: Árbol
+ * @param  board: Posición nueva (se copia)
+ */
+void MCTS_SetRoot(MCTS_Tree_t* tree, const MNK_Board_t* board)
+{
+    uint16_t index = FindDescendant(tree, board);
+
+    if (index == MCTS_NULL) {
+        MCTS_Reset(tree);
+        tree->root = NewRoot(tree, board);
+        tree->root_board = *board;
+        return;
+    }
+
+    // Marcar el subárbol conservado y devolver el resto a la lista libre
+    KeepSubtree(tree, index);
+    tree->live = 0;
+    for (uint16_t i = 0; i < tree->used; i++) {
+        MCTS_Node_t* node = &tree->nodes[i];
+        if (node->flags & MCTS_FLAG_KEEP) {
+            node->flags &= (uint8_t)~MCTS_FLAG_KEEP;
+            tree->live++;
+        } else if (!(node->flags & MCTS_FLAG_FREE)) {
+            node->flags = MCTS_FLAG_FREE;
+            node->next_sibling = tree->free_list;
+            tree->free_list = i;
+        }
+    }
+
+    MCTS_Node_t* root = &tree->nodes[index];
+    root->parent = MCTS_NULL;
+    root->next_sibling = MCTS_NULL;
+
+    tree->root = index;
+    tree->root_board = *board;
+    tree->iterations = root->visits;
+    tree->reused = tree->live;
+}
+
+/**
+ * @brief  Ejecuta iteraciones de selección, expansión, simulación y propagación
+ * @param  tree: Árbol con la raíz fijada por MCTS_SetRoot()
+ * @param  iterations: Iteraciones a ejecutar
+ * @retval Iteraciones ejecutadas
+ */
+uint32_t MCTS_Run(MCTS_Tree_t* tree, uint32_t iterations)
+{
+    const MNK_Rules_t* rules = tree->rules;
+
+    if (tree->root == MCTS_NULL) {
+        return 0;
+    }
+
+    for (uint32_t n = 0; n < iterations; n++) {
+        MNK_Board_t board = tree->root_board;
+        uint16_t index = tree->root;
+        MCTS_Node_t* node = &tree->nodes[index];
+
+        // 1. Selección: bajar por UCT mientras el nodo esté completamente expandido
+        while (!(node->flags & MCTS_FLAG_TERMINAL) && node->untried == 0 &&
+               node->first_child != MCTS_NULL) {
+            index = SelectChild(tree, node);
+            node = &tree->nodes[index];
+            MNK_MakeMove(rules, &board, node->move);
+        }
+
+        // 2. Expansión de una jugada nueva (si queda lugar en el arreglo)
+        if (!(node->flags & MCTS_FLAG_TERMINAL) && node->untried != 0) {
+            uint8_t cell = RandomCell(node->untried, &tree->rng);
+            uint16_t child = AllocNode(tree, index, cell, &board);
+            if (child != MCTS_NULL) {
+                node = &tree->nodes[index];
+                node->untried &= ~((MNK_Mask_t)1u << cell);
+                index = child;
+                node = &tree->nodes[index];
+                MNK_MakeMove(rules, &board, cell);
+            }
+        }
+
+        // 3. Simulación (o resultado conocido si la partida ya terminó)
+        uint8_t winner;
+        if (node->flags & MCTS_FLAG_TERMINAL) {
+            winner = (node->flags & MCTS_FLAG_WIN) ? ((node->flags & MCTS_FLAG_P2) ? 1u : 0u) : MCTS_DRAW;
+        } else {
+            winner = MCTS_Playout(rules, &board, &tree->rng);
+        }
+
+        // 4. Propagación hasta la raíz
+        while (index != MCTS_NULL) {
+            node = &tree->nodes[index];
+            uint8_t mover = (node->flags & MCTS_FLAG_P2) ? 1u : 0u;
+            node->visits++;
+            node->score += (winner == mover) ? 2u : (winner == MCTS_DRAW) ? 1u : 0u;
+            index = (index == tree->root) ? MCTS_NULL : node->parent;
+        }
+    }
+
+    tree->iterations += iterations;
+    return iterations;
+}
+
+/**
+ * @brief  Elige la jugada de la raíz
+ * @note   Una victoria inmediata se juega siempre; si no, la jugada más
+ *         visitada (criterio robusto de UCT)
+ * @retval Celda elegida, o MNK_NO_MOVE si no hay jugadas
+ */
+uint8_t MCTS_BestMove(const MCTS_Tree_t* tree)
+{
+    const MNK_Rules_t* rules = tree->rules;
+    const MNK_Board_t* board = &tree->root_board;
+    MNK_Mask_t empty = MNK_Empty(rules, board);
+    MNK_Mask_t own = board->cells[board->side];
+
+    if (empty == 0) {
+        return MNK_NO_MOVE;
+    }
+
+    MNK_Mask_t pending = empty;
+    while (pending) {
+        uint8_t cell = (uint8_t)__builtin_ctzll(pending);
+        pending &= pending - 1u;
+        if (MNK_IsWinningMove(rules, own | ((MNK_Mask_t)1u << cell), cell)) {
+            return cell;
+        }
+    }
+
+    uint8_t best_move = MNK_NO_MOVE;
+    uint32_t best_visits = 0;
+    uint32_t best_score = 0;
+    if (tree->root != MCTS_NULL) {
+        uint16_t child = tree->nodes[tree->root].first_child;
+        while (child != MCTS_NULL) {
+            const MCTS_Node_t* node = &tree->nodes[child];
+            if (best_move == MNK_NO_MOVE || node->visits > best_visits ||
+                (node->visits == best_visits && node->score > best_score)) {
+                best_move = node->move;
+                best_visits = node->visits;
+                best_score = node->score;
+            }
+            child = node->next_sibling;
+        }
+    }
+
+    // Sin iteraciones: la celda más central
+    if (best_move == MNK_NO_MOVE) {
+        for (uint8_t i = 0; i < rules->num_cells; i++) {
+            if (empty & ((MNK_Mask_t)1u << rules->move_order[i])) {
+                return rules->move_order[i];
+            }
+        }
+    }
+    return best_move;
+}
+
+/**
+ * @brief  Juega al azar hasta el final de la partida
+ * @note   Baraja las celdas libres una sola vez (Fisher-Yates) y las juega en
+ *         orden alternando jugadores; solo se verifican las líneas de cada celda
+ * @param  rules: Variante en juego
+ * @param  board: Posición inicial (se modifica)
+ * @param  rng: Estado del generador
+ * @retval Jugador ganador (0 = P1, 1 = P2) o MCTS_DRAW
+ */
+uint8_t MCTS_Playout(const MNK_Rules_t* rules, MNK_Board_t* board, uint32_t* rng)
+{
+    uint8_t cells[MNK_MAX_CELLS];
+    uint8_t count = 0;
+    MNK_Mask_t empty = MNK_Empty(rules, board);
+
+    while (empty) {
+        cells[count++] = (uint8_t)__builtin_ctzll(empty);
+        empty &= empty - 1u;
+    }
+
+    uint8_t side = board->side;
+    for (uint8_t i = 0; i < count; i++) {
+        uint8_t j = (uint8_t)(i + NextRandom(rng) % (uint32_t)(count - i));
+        uint8_t cell = cells[j];
+        cells[j] = cells[i];
+
+        board->cells[side] |= (MNK_Mask_t)1u << cell;
+        if (MNK_IsWinningMove(rules, board->cells[side], cell)) {
+            return side;
+        }
+        side ^= 1u;
+    }
+    return MCTS_DRAW;
+}
+
+/**
+ * @brief  Generador xorshift32
+ */
+static uint32_t NextRandom(uint32_t* rng)
+{
+    uint32_t x = *rng;
+    x ^= x << 13;
+    x ^= x >> 17;
+    x ^= x << 5;
+    *rng = x;
+    return x;
+}
+
+/**
+ * @brief  Elige al azar una celda de una máscara no vacía
+ */
+static uint8_t RandomCell(MNK_Mask_t mask, uint32_t* rng)
+{
+    uint8_t skip = (uint8_t)(NextRandom(rng) % (uint32_t)__builtin_popcountll(mask));
+
+    while (skip--) {
+        mask &= mask - 1u;
+    }
+    return (uint8_t)__builtin_ctzll(mask);
+}
+
+/**
+ * @brief  Toma un nodo de la lista libre o del arreglo y lo cuelga de su padre
+ * @param  board: Posición antes de jugar move
+ * @retval Índice del nodo, o MCTS_NULL si el arreglo está lleno
+ */
+static uint16_t AllocNode(MCTS_Tree_t* tree, uint16_t parent, uint8_t move, const MNK_Board_t* board)
+{
+    const MNK_Rules_t* rules = tree->rules;
+    uint16_t index;
+
+    if (tree->free_list != MCTS_NULL) {
+        index = tree->free_list;
+        tree->free_list = tree->nodes[index].next_sibling;
+    } else if (tree->used < tree->capacity) {
+        index = tree->used++;
+    } else {
+        return MCTS_NULL;
+    }
+    tree->live++;
+
+    MCTS_Node_t* node = &tree->nodes[index];
+    MNK_Mask_t bit = (MNK_Mask_t)1u << move;
+    MNK_Mask_t empty = MNK_Empty(rules, board) & ~bit;
+
+    node->visits = 0;
+    node->score = 0;
+    node->parent = parent;
+    node->first_child = MCTS_NULL;
+    node->move = move;
+    node->flags = (board->side == 1u) ? MCTS_FLAG_P2 : 0u;
+    node->untried = empty;
+
+    if (MNK_IsWinningMove(rules, board->cells[board->side] | bit, move)) {
+        node->flags |= MCTS_FLAG_TERMINAL | MCTS_FLAG_WIN;
+        node->untried = 0;
+    } else if (empty == 0) {
+        node->flags |= MCTS_FLAG_TERMINAL;
+    }
+
+    // Insertar al principio de la lista de hijos
+    node->next_sibling = tree->nodes[parent].first_child;
+    tree->nodes[parent].first_child = index;
+    return index;
+}
+
+/**
+ * @brief  Crea el nodo raíz de un árbol vacío
+ */
+static uint16_t NewRoot(MCTS_Tree_t* tree, const MNK_Board_t* board)
+{
+    if (tree->capacity == 0) {
+        return MCTS_NULL;
+    }
+
+    MCTS_Node_t* node = &tree->nodes[0];
+    tree->used = 1;
+    tree->live = 1;
+
+    node->untried = MNK_Empty(tree->rules, board);
+    node->visits = 0;
+    node->score = 0;
+    node->parent = MCTS_NULL;
+    node->first_child = MCTS_NULL;
+    node->next_sibling = MCTS_NULL;
+    node->move = MNK_NO_MOVE;
+    node->flags = (board->side == 0u) ? MCTS_FLAG_P2 : 0u;  // Movió el rival del que mueve
+    return 0;
+}
+
+/**
+ * @brief  Busca el hijo de un nodo que corresponde a una jugada
+ */
+static uint16_t FindChild(const MCTS_Tree_t* tree, uint16_t index, uint8_t move)
+{
+    uint16_t child = tree->nodes[index].first_child;
+
+    while (child != MCTS_NULL && tree->nodes[child].move != move) {
+        child = tree->nodes[child].next_sibling;
+    }
+    return child;
+}
+
+/**
+ * @brief  Busca en el árbol la posición dada (la raíz o hasta dos jugadas después)
+ * @retval Índice del nodo, o MCTS_NULL si no está en el árbol
+ */
+static uint16_t FindDescendant(const MCTS_Tree_t* tree, const MNK_Board_t* board)
+{
+    MNK_Board_t current = tree->root_board;
+    uint16_t index = tree->root;
+
+    if (index == MCTS_NULL || board->move_count < current.move_count ||
+        board->move_count > current.move_count + 2u) {
+        return MCTS_NULL;
+    }
+
+    while (index != MCTS_NULL && current.move_count < board->move_count) {
+        uint8_t side = current.side;
+        MNK_Mask_t added = board->cells[side] & ~current.cells[side];
+        if (added == 0 || (added & (added - 1u)) != 0) {
+            return MCTS_NULL;  // No hay exactamente una ficha nueva de quien movía
+        }
+        uint8_t cell = (uint8_t)__builtin_ctzll(added);
+        index = FindChild(tree, index, cell);
+        MNK_MakeMove(tree->rules, &current, cell);
+    }
+
+    if (index == MCTS_NULL || current.side != board->side ||
+        current.cells[0] != board->cells[0] || current.cells[1] != board->cells[1]) {
+        return MCTS_NULL;
+    }
+    return index;
+}
+
+/**
+ * @brief  Marca un subárbol con MCTS_FLAG_KEEP
+ * @note   Recorrido en profundidad sin pila, usando los enlaces al padre
+ */
+static void KeepSubtree(MCTS_Tree_t* tree, uint16_t index)
+{
+    uint16_t top = index;
+
+    while (index != MCTS_NULL) {
+        MCTS_Node_t* node = &tree->nodes[index];
+        node->flags |= MCTS_FLAG_KEEP;
+
+        if (node->first_child != MCTS_NULL) {
+            index = node->first_child;
+            continue;
+        }
+
+        // Subir hasta encontrar un hermano pendiente
+        while (index != top && tree->nodes[index].next_sibling == MCTS_NULL) {
+            index = tree->nodes[index].parent;
+        }
+        index = (index == top) ? MCTS_NULL : tree->nodes[index].next_sibling;
+    }
+}
+
+/**
+ * @brief  Elige el hijo con mayor cota UCT
+ */
+static uint16_t SelectChild(const MCTS_Tree_t* tree, const MCTS_Node_t* node)
+{
+    float log_visits = logf((float)node->visits);
+    float best_value = -1.0f;
+    uint16_t best = node->first_child;
+    uint16_t child = node->first_child;
+
+    while (child != MCTS_NULL) {
+        const MCTS_Node_t* c = &tree->nodes[child];
+        float visits = (float)c->visits;
+        float value = (float)c->score / (2.0f * visits) + MCTS_UCT_C * sqrtf(log_visits / visits);
+        if (value > best_value) {
+            best_value = value;
+            best = child;
+        }
+        child = c->next_sibling;
+    }
+    return best;
+}
@@ -0,0 +1,604 @@
+/**
+ ******************************************************************************
+ * @file    mnk.c
+ * @brief   Implementación del motor m,n,k: generación de líneas y búsqueda
+ ******************************************************************************
+ */
+
+#include "mnk.h"
+#include <string.h>
+
+/* Tipos de entrada de la tabla de transposición */
+#define TT_EXACT    0u
+#define TT_LOWER    1u
+#define TT_UPPER    2u
+#define TT_SIZE     (1u << MNK_TT_BITS)
+#define TT_MOVE_MASK    0x3Fu   // Bits 0-5 de info: mejor jugada (0-48)
+#define TT_FLAG_SHIFT   6u      // Bits 6-7 de info: tipo de cota
+
+/* Puntajes a partir de los cuales se considera victoria forzada */
+#define MNK_SCORE_MATE  (MNK_SCORE_WIN - 1000L)
+
+typedef struct {
+    int32_t score;
+    uint16_t lock;      // Bits 48-63 de la clave Zobrist (los bajos dan el índice)
+    uint8_t depth;      // 0 = entrada vacía (nunca se guardan hojas)
+    uint8_t info;       // Bits 0-5: mejor jugada, bits 6-7: tipo de cota
+} TTEntry_t;
+
+_Static_assert(sizeof(TTEntry_t) == 8u, "TTEntry_t tiene que ocupar 8 bytes");
+
+/* Variables privadas */
+static TTEntry_t tt[TT_SIZE];
+static uint64_t zobrist[2][MNK_MAX_CELLS];
+static bool zobrist_ready = false;
+static MNK_Evaluator_t leaf_evaluator = MNK_Evaluate;
+
+/* Estado usado por la búsqueda bloqueante MNK_Search() */
+static MNK_Search_t blocking_search;
+
+/* Variantes predefinidas: ancho, alto, k */
+static const uint8_t variant_params[][3] = {
+    {3, 3, 3},
+    {4, 4, 4},
+    {5, 5, 4},
+    {7, 7, 5}
+};
+
+/* Prototipos funciones privadas */
+static void InitZobrist(void);
+static void AddLine(MNK_Rules_t* rules, uint8_t row, uint8_t col, int8_t d_row, int8_t d_col);
+static void StartIteration(MNK_Search_t* s);
+static bool EnterNode(MNK_Search_t* s, uint8_t depth, int32_t alpha, int32_t beta, int32_t* value);
+static void ApplyScore(MNK_Frame_t* f, int32_t score, uint8_t cell);
+static void StoreTT(MNK_Search_t* s, const MNK_Frame_t* f);
+static uint8_t OrderMoves(const MNK_Rules_t* rules, MNK_Mask_t empty, uint8_t first, uint8_t moves[]);
+
+/**
+ * @brief  Genera las tablas de una variante m,n,k
+ * @param  rules: Estructura a completar
+ * @param  width: Columnas (1-7)
+ * @param  height: Filas (1-7)
+ * @param  k: Fichas en línea necesarias para ganar (3-7)
+ * @retval true si los parámetros son válidos
+ */
+bool MNK_Init(MNK_Rules_t* rules, uint8_t width, uint8_t height, uint8_t k)
+{
+    if (width == 0 || height == 0 || width > MNK_MAX_WIDTH || height > MNK_MAX_HEIGHT ||
+        k < 3 || k > MNK_MAX_CELL_LINES / 4 || (k > width && k > height)) {
+        return false;
+    }
+
+    memset(rules, 0, sizeof(*rules));
+    rules->width = width;
+    rules->height = height;
+    rules->k = k;
+    rules->num_cells = (uint8_t)(width * height);
+    rules->full_mask = (rules->num_cells == 64) ? ~0ULL : ((1ULL << rules->num_cells) - 1u);
+
+    // Generar todas las líneas de k celdas en las 4 direcciones
+    for (uint8_t row = 0; row < height; row++) {
+        for (uint8_t col = 0; col < width; col++) {
+            AddLine(rules, row, col, 0, 1);     // Horizontal
+            AddLine(rules, row, col, 1, 0);     // Vertical
+            AddLine(rules, row, col, 1, 1);     // Diagonal principal
+            AddLine(rules, row, col, 1, -1);    // Diagonal anti
+        }
+    }
+
+    // Orden de exploración: distancia al centro (en medios de celda)
+    uint8_t count = 0;
+    for (uint8_t dist = 0; dist <= (uint8_t)(width + height); dist++) {
+        for (uint8_t cell = 0; cell < rules->num_cells; cell++) {
+            int8_t dr = (int8_t)(2 * (cell / width) - (height - 1));
+            int8_t dc = (int8_t)(2 * (cell % width) - (width - 1));
+            uint8_t d = (uint8_t)((dr < 0 ? -dr : dr) > (dc < 0 ? -dc : dc) ?
+                                  (dr < 0 ? -dr : dr) : (dc < 0 ? -dc : dc));
+            if (d == dist) {
+                rules->move_order[count++] = cell;
+            }
+        }
+    }
+
+    InitZobrist();
+    MNK_ClearTT();  // Las entradas de otra variante no son válidas
+    return true;
+}
+
+/**
+ * @brief  Genera las tablas de una variante predefinida
+ */
+bool MNK_InitVariant(MNK_Rules_t* rules, MNK_Variant_t variant)
+{
+    if ((uint8_t)variant >= sizeof(variant_params) / sizeof(variant_params[0])) {
+        return false;
+    }
+    return MNK_Init(rules, variant_params[variant][0], variant_params[variant][1],
+                    variant_params[variant][2]);
+}
+
+/**
+ * @brief  Vacía el tablero; empieza moviendo el jugador 1
+ */
+void MNK_Reset(const MNK_Rules_t* rules, MNK_Board_t* board)
+{
+    (void)rules;
+    board->cells[0] = 0;
+    board->cells[1] = 0;
+    board->hash = 0;
+    board->side = 0;
+    board->move_count = 0;
+}
+
+/**
+ * @brief  Coloca una ficha del jugador que mueve y pasa el turno
+ */
+void MNK_MakeMove(const MNK_Rules_t* rules, MNK_Board_t* board, uint8_t cell)
+{
+    (void)rules;
+    board->cells[board->side] |= (1ULL << cell);
+    board->hash ^= zobrist[board->side][cell];
+    board->side ^= 1u;
+    board->move_count++;
+}
+
+/**
+ * @brief  Deshace la última jugada (que debe haber sido en 'cell')
+ */
+void MNK_UnmakeMove(const MNK_Rules_t* rules, MNK_Board_t* board, uint8_t cell)
+{
+    (void)rules;
+    board->side ^= 1u;
+    board->cells[board->side] &= ~(1ULL << cell);
+    board->hash ^= zobrist[board->side][cell];
+    board->move_count--;
+}
+
+/**
+ * @brief  Verifica si las fichas 'own' completan una línea que pasa por 'cell'
+ * @note   Solo revisa las líneas de la celda jugada: O(4k) en lugar de todas
+ */
+bool MNK_IsWinningMove(const MNK_Rules_t* rules, MNK_Mask_t own, uint8_t cell)
+{
+    for (uint8_t i = 0; i < rules->cell_line_count[cell]; i++) {
+        MNK_Mask_t line = rules->lines[rules->cell_lines[cell][i]];
+        if ((own & line) == line) {
+            return true;
+        }
+    }
+    return false;
+}
+
+/**
+ * @brief  Verifica si las fichas 'own' contienen alguna línea completa
+ */
+bool MNK_HasWin(const MNK_Rules_t* rules, MNK_Mask_t own)
+{
+    for (uint8_t i = 0; i < rules->num_lines; i++) {
+        if ((own & rules->lines[i]) == rules->lines[i]) {
+            return true;
+        }
+    }
+    return false;
+}
+
+/**
+ * @brief  Evaluación heurística desde el punto de vista del jugador que mueve
+ * @note   Suma 4^n por cada línea con n fichas propias y ninguna rival, y resta
+ *         lo mismo para el rival
+ */
+int32_t MNK_Evaluate(const MNK_Rules_t* rules, const MNK_Board_t* board)
+{
+    MNK_Mask_t own = board->cells[board->side];
+    MNK_Mask_t opp = board->cells[board->side ^ 1u];
+    int32_t score = 0;
+
+    for (uint8_t i = 0; i < rules->num_lines; i++) {
+        MNK_Mask_t line = rules->lines[i];
+        MNK_Mask_t mine = own & line;
+        MNK_Mask_t theirs = opp & line;
+
+        if (mine && !theirs) {
+            score += 1L << (2 * __builtin_popcountll(mine));
+        } else if (theirs && !mine) {
+            score -= 1L << (2 * __builtin_popcountll(theirs));
+        }
+    }
+    return score;
+}
+
+/**
+ * @brief  Cambia la evaluación de las hojas de la búsqueda
+ * @note   Vacía la tabla de transposición: sus puntajes son de la anterior.
+ *         No llamar con una búsqueda incremental en curso.
+ * @param  evaluator: Función a usar (NULL = MNK_Evaluate)
+ */
+void MNK_SetEvaluator(MNK_Evaluator_t evaluator)
+{
+    leaf_evaluator = (evaluator != NULL) ? evaluator : MNK_Evaluate;
+    MNK_ClearTT();
+}
+
+/**
+ * @brief  Búsqueda alfa-beta con profundización iterativa (bloqueante)
+ * @param  rules: Variante en juego
+ * @param  board: Posición (no se modifica)
+ * @param  max_depth: Profundidad máxima en jugadas
+ * @param  node_limit: Máximo de nodos (0 = sin límite). Al agotarse se
+ *         devuelve la mejor jugada de la última iteración completa.
+ * @param  result: Resultado de la búsqueda
+ */
+void MNK_Search(const MNK_Rules_t* rules, const MNK_Board_t* board, uint8_t max_depth,
+                uint32_t node_limit, MNK_Result_t* result)
+{
+    MNK_SearchBegin(&blocking_search, rules, board, max_depth);
+
+    while (!MNK_SearchStep(&blocking_search, MNK_STEP_NODES)) {
+        if (node_limit != 0 && blocking_search.nodes >= node_limit) {
+            break;
+        }
+    }
+
+    *result = blocking_search.result;
+    result->nodes = blocking_search.nodes;
+}
+
+/**
+ * @brief  Prepara una búsqueda incremental
+ * @note   Si la posición se resuelve sin buscar (sin jugadas, victoria
+ *         inmediata o una sola celda libre) la búsqueda queda terminada.
+ *         En cualquier caso s->result.best_move contiene siempre una jugada
+ *         válida mientras haya celdas libres.
+ * @param  s: Estado de la búsqueda (provisto por el llamador)
+ * @param  rules: Variante en juego
+ * @param  board: Posición a analizar (se copia)
+ * @param  max_depth: Profundidad máxima en jugadas
+ */
+void MNK_SearchBegin(MNK_Search_t* s, const MNK_Rules_t* rules, const MNK_Board_t* board,
+                     uint8_t max_depth)
+{
+    MNK_Mask_t empty = MNK_Empty(rules, board);
+    uint8_t remaining = (uint8_t)(rules->num_cells - board->move_count);
+
+    s->rules = rules;
+    s->board = *board;
+    s->nodes = 0;
+    s->done = false;
+    s->max_depth = (max_depth > remaining) ? remaining : max_depth;
+    s->result.best_move = MNK_NO_MOVE;
+    s->result.score = 0;
+    s->result.depth = 0;
+    s->result.nodes = 0;
+
+    if (empty == 0 || s->max_depth == 0) {
+        s->done = true;
+        return;
+    }
+
+    // Mejor jugada provisoria: la primera según el orden estático
+    uint8_t moves[MNK_MAX_CELLS];
+    OrderMoves(rules, empty, MNK_NO_MOVE, moves);
+    s->result.best_move = moves[0];
+
+    // Victoria inmediata o última celda: no hace falta buscar
+    MNK_Mask_t own = board->cells[board->side];
+    MNK_Mask_t pending = empty;
+    while (pending) {
+        uint8_t cell = (uint8_t)__builtin_ctzll(pending);
+        pending &= pending - 1u;
+        if (MNK_IsWinningMove(rules, own | (1ULL << cell), cell)) {
+            s->result.best_move = cell;
+            s->result.score = MNK_SCORE_WIN - 1;
+            s->result.depth = 1;
+            s->done = true;
+            return;
+        }
+    }
+    if (remaining == 1) {
+        s->result.depth = 1;
+        s->done = true;
+        return;
+    }
+
+    s->iter_depth = 1;
+    StartIteration(s);
+}
+
+/**
+ * @brief  Avanza una búsqueda incremental
+ * @param  s: Estado de la búsqueda
+ * @param  max_nodes: Nodos a visitar como máximo en este paso
+ * @retval true si la búsqueda terminó (profundidad máxima o resultado forzado)
+ */
+bool MNK_SearchStep(MNK_Search_t* s, uint32_t max_nodes)
+{
+    uint32_t stop = s->nodes + max_nodes;
+
+    while (!s->done && s->nodes < stop) {
+        MNK_Frame_t* f = &s->stack[s->sp];
+
+        if (f->index < f->count) {
+            // Bajar por la próxima jugada del nodo actual
+            uint8_t cell = f->moves[f->index++];
+            int32_t value;
+
+            MNK_MakeMove(s->rules, &s->board, cell);
+            if (EnterNode(s, (uint8_t)(f->depth - 1), -f->beta, -f->alpha, &value)) {
+                MNK_UnmakeMove(s->rules, &s->board, cell);
+                ApplyScore(f, -value, cell);
+            }
+            continue;
+        }
+
+        if (s->sp == 0) {
+            // Iteración completa en la raíz
+            s->result.best_move = f->best_move;
+            s->result.score = f->best;
+            s->result.depth = s->iter_depth;
+
+            if (s->iter_depth >= s->max_depth ||
+                f->best >= MNK_SCORE_MATE || f->best <= -MNK_SCORE_MATE) {
+                s->done = true;  // Profundizar no cambia la decisión
+            } else {
+                s->iter_depth++;
+                StartIteration(s);
+            }
+            continue;
+        }
+
+        // Nodo interno terminado: guardar en la tabla y devolver al padre
+        StoreTT(s, f);
+        int32_t value = f->best;
+        s->sp--;
+        MNK_Frame_t* parent = &s->stack[s->sp];
+        uint8_t cell = parent->moves[parent->index - 1u];
+        MNK_UnmakeMove(s->rules, &s->board, cell);
+        ApplyScore(parent, -value, cell);
+    }
+
+    s->result.nodes = s->nodes;
+    return s->done;
+}
+
+/**
+ * @brief  Copia un tablero de 3x3 (máscaras de 9 bits) a un tablero m,n,k
+ * @param  rules: Variante en juego (misma numeración de celdas)
+ * @param  board: Tablero destino
+ * @param  p1: Celdas del jugador 1
+ * @param  p2: Celdas del jugador 2
+ * @param  side: Jugador que mueve (0 = P1, 1 = P2)
+ */
+void MNK_SetPosition(const MNK_Rules_t* rules, MNK_Board_t* board, MNK_Mask_t p1, MNK_Mask_t p2,
+                     uint8_t side)
+{
+    MNK_Reset(rules, board);
+    board->cells[0] = p1 & rules->full_mask;
+    board->cells[1] = p2 & rules->full_mask;
+    board->side = side;
+    board->move_count = (uint8_t)(__builtin_popcountll(board->cells[0]) +
+                                  __builtin_popcountll(board->cells[1]));
+
+    for (uint8_t player = 0; player < 2; player++) {
+        MNK_Mask_t pending = board->cells[player];
+        while (pending) {
+            uint8_t cell = (uint8_t)__builtin_ctzll(pending);
+            pending &= pending - 1u;
+            board->hash ^= zobrist[player][cell];
+        }
+    }
+}
+
+/**
+ * @brief  Vacía la tabla de transposición
+ */
+void MNK_ClearTT(void)
+{
+    memset(tt, 0, sizeof(tt));
+}
+
+/**
+ * @brief  Arranca una iteración de profundidad s->iter_depth desde la raíz
+ * @note   La mejor jugada de la iteración anterior se explora primero
+ */
+static void StartIteration(MNK_Search_t* s)
+{
+    MNK_Frame_t* root = &s->stack[0];
+
+    s->sp = 0;
+    root->count = OrderMoves(s->rules, MNK_Empty(s->rules, &s->board), s->result.best_move, root->moves);
+    root->index = 0;
+    root->depth = s->iter_depth;
+    root->alpha = -MNK_SCORE_INF;
+    root->alpha_orig = -MNK_SCORE_INF;
+    root->beta = MNK_SCORE_INF;
+    root->best = -MNK_SCORE_INF;
+    root->best_move = root->moves[0];
+}
+
+/**
+ * @brief  Entra a un nodo recién alcanzado (el rival acaba de mover sin ganar)
+ * @param  s: Estado de la búsqueda
+ * @param  depth: Profundidad restante
+ * @param  alpha: Cota inferior de la ventana
+ * @param  beta: Cota superior de la ventana
+ * @param  value: Puntaje del nodo si se resolvió sin expandir
+ * @retval true si el nodo se resolvió (hoja, victoria, corte por tabla);
+ *         false si se apiló un nuevo marco para explorar sus jugadas
+ */
+static bool EnterNode(MNK_Search_t* s, uint8_t depth, int32_t alpha, int32_t beta, int32_t* value)
+{
+    const MNK_Rules_t* rules = s->rules;
+    MNK_Board_t* board = &s->board;
+    uint8_t ply = (uint8_t)(s->sp + 1u);
+
+    s->nodes++;
+
+    MNK_Mask_t own = board->cells[board->side];
+    MNK_Mask_t empty = MNK_Empty(rules, board);
+
+    // Ganar en esta jugada es el mejor resultado posible
+    MNK_Mask_t pending = empty;
+    while (pending) {
+        uint8_t cell = (uint8_t)__builtin_ctzll(pending);
+        pending &= pending - 1u;
+        if (MNK_IsWinningMove(rules, own | (1ULL << cell), cell)) {
+            *value = MNK_SCORE_WIN - (ply + 1);
+            return true;
+        }
+    }
+
+    // Última celda libre sin victoria: empate
+    if ((empty & (empty - 1u)) == 0) {
+        *value = 0;
+        return true;
+    }
+
+    if (depth == 0) {
+        *value = leaf_evaluator(rules, board);
+        return true;
+    }
+
+    // Consultar la tabla de transposición
+    TTEntry_t* entry = &tt[board->hash & (TT_SIZE - 1u)];
+    uint16_t lock = (uint16_t)(board->hash >> 48);
+    uint8_t tt_move = MNK_NO_MOVE;
+
+    // depth == 0 marca una entrada vacía (nunca se guardan hojas)
+    if (entry->lock == lock && entry->depth != 0) {
+        uint8_t flag = (uint8_t)(entry->info >> TT_FLAG_SHIFT);
+        tt_move = (uint8_t)(entry->info & TT_MOVE_MASK);
+        if (entry->depth >= depth) {
+            int32_t score = entry->score;
+            // Los puntajes de victoria se guardan relativos a este nodo
+            if (score >= MNK_SCORE_MATE) score -= ply;
+            else if (score <= -MNK_SCORE_MATE) score += ply;
+
+            if (flag == TT_EXACT ||
+                (flag == TT_LOWER && score >= beta) ||
+                (flag == TT_UPPER && score <= alpha)) {
+                *value = score;
+                return true;
+            }
+        }
+    }
+
+    // Expandir: apilar un marco nuevo
+    MNK_Frame_t* f = &s->stack[ply];
+    s->sp = ply;
+    f->count = OrderMoves(rules, empty, tt_move, f->moves);
+    f->index = 0;
+    f->depth = depth;
+    f->alpha = alpha;
+    f->alpha_orig = alpha;
+    f->beta = beta;
+    f->best = -MNK_SCORE_INF;
+    f->best_move = f->moves[0];
+    return false;
+}
+
+/**
+ * @brief  Incorpora el puntaje de una jugada al marco que la exploró
+ */
+static void ApplyScore(MNK_Frame_t* f, int32_t score, uint8_t cell)
+{
+    if (score > f->best) {
+        f->best = score;
+        f->best_move = cell;
+        if (score > f->alpha) {
+            f->alpha = score;
+            if (f->alpha >= f->beta) {
+                f->index = f->count;  // Poda: no explorar el resto
+            }
+        }
+    }
+}
+
+/**
+ * @brief  Guarda el resultado de un nodo terminado (reemplazo por profundidad)
+ */
+static void StoreTT(MNK_Search_t* s, const MNK_Frame_t* f)
+{
+    TTEntry_t* entry = &tt[s->board.hash & (TT_SIZE - 1u)];
+    uint16_t lock = (uint16_t)(s->board.hash >> 48);
+
+    if (entry->lock != lock && f->depth < entry->depth) {
+        return;
+    }
+
+    int32_t stored = f->best;
+    if (stored >= MNK_SCORE_MATE) stored += s->sp;
+    else if (stored <= -MNK_SCORE_MATE) stored -= s->sp;
+
+    uint8_t flag = (f->best <= f->alpha_orig) ? TT_UPPER : (f->best >= f->beta) ? TT_LOWER : TT_EXACT;
+
+    entry->lock = lock;
+    entry->score = stored;
+    entry->depth = f->depth;
+    entry->info = (uint8_t)((f->best_move & TT_MOVE_MASK) | (flag << TT_FLAG_SHIFT));
+}
+
+/**
+ * @brief  Arma la lista de jugadas: primero 'first', luego de centro a borde
+ * @retval Cantidad de jugadas
+ */
+static uint8_t OrderMoves(const MNK_Rules_t* rules, MNK_Mask_t empty, uint8_t first, uint8_t moves[])
+{
+    uint8_t count = 0;
+
+    if (first != MNK_NO_MOVE && (empty & (1ULL << first))) {
+        moves[count++] = first;
+    }
+    for (uint8_t i = 0; i < rules->num_cells; i++) {
+        uint8_t cell = rules->move_order[i];
+        if (cell != first && (empty & (1ULL << cell))) {
+            moves[count++] = cell;
+        }
+    }
+    return count;
+}
+
+/**
+ * @brief  Agrega la línea de k celdas que empieza en (row, col) si entra
+ */
+static void AddLine(MNK_Rules_t* rules, uint8_t row, uint8_t col, int8_t d_row, int8_t d_col)
+{
+    int8_t end_row = (int8_t)(row + d_row * (rules->k - 1));
+    int8_t end_col = (int8_t)(col + d_col * (rules->k - 1));
+
+    if (end_row < 0 || end_row >= rules->height || end_col < 0 || end_col >= rules->width) {
+        return;
+    }
+    if (rules->num_lines >= MNK_MAX_LINES) {
+        return;
+    }
+
+    uint8_t index = rules->num_lines++;
+    MNK_Mask_t line = 0;
+    for (uint8_t i = 0; i < rules->k; i++) {
+        uint8_t cell = (uint8_t)((row + d_row * i) * rules->width + (col + d_col * i));
+        line |= (1ULL << cell);
+        rules->cell_lines[cell][rules->cell_line_count[cell]++] = index;
+    }
+    rules->lines[index] = line;
+}
+
+/**
+ * @brief  Genera las claves Zobrist (xorshift64 con semilla fija)
+ */
+static void InitZobrist(void)
+{
+    if (zobrist_ready) {
+        return;
+    }
+
+    uint64_t state = 0x9E3779B97F4A7C15ULL;
+    for (uint8_t side = 0; side < 2; side++) {
+        for (uint8_t cell = 0; cell < MNK_MAX_CELLS; cell++) {
+            state ^= state << 13;
+            state ^= state >> 7;
+            state ^= state << 17;
+            zobrist[side][cell] = state;
+        }
+    }
+    zobrist_ready = true;
+}
@@ -0,0 +1,241 @@
+/**
+ ******************************************************************************
+ * @file    nn_bench.c
+ * @brief   Implementación del benchmark de la red de evaluación
+ ******************************************************************************
+ */
+
+#include "nn_bench.h"
+#include "nn_eval.h"
+#include "stm32f4xx_hal.h"
+#include <stdio.h>
+#include <stdlib.h>
+
+/* Variables privadas */
+static MNK_Board_t bench_positions[NN_BENCH_MAX_POSITIONS];
+static uint32_t samples[NN_BENCH_MAX_POSITIONS];     // Latencias en ns
+static volatile int32_t sink;                        // Evita que se descarte la evaluación
+
+static const char* const eval_names[NN_BENCH_NUM_EVALS] = {
+    "lines", "nn_scalar", "nn_simd"
+};
+
+/* Prototipos funciones privadas */
+static uint32_t NextRandom(uint32_t* rng);
+static int CompareSamples(const void* a, const void* b);
+static uint32_t TargetClock(void);
+
+/**
+ * @brief  Genera posiciones jugando al azar desde el tablero vacío
+ * @note   Cada posición corta la partida en una jugada al azar; se descartan
+ *         las que ya tienen ganador o no tienen celdas libres
+ * @param  rules: Variante
+ * @param  positions: Arreglo de salida
+ * @param  count: Cantidad a generar (hasta NN_BENCH_MAX_POSITIONS)
+ * @param  seed: Semilla (0 = NN_BENCH_SEED)
+ * @retval Cantidad de posiciones
+ */
+uint16_t NNBench_CollectPositions(const MNK_Rules_t* rules, MNK_Board_t positions[],
+                                  uint16_t count, uint32_t seed)
+{
+    uint32_t rng = (seed != 0) ? seed : NN_BENCH_SEED;
+    uint16_t n = 0;
+
+    if (count > NN_BENCH_MAX_POSITIONS) {
+        count = NN_BENCH_MAX_POSITIONS;
+    }
+    while (n < count) {
+        MNK_Board_t board;
+        uint8_t plies = (uint8_t)(NextRandom(&rng) % rules->num_cells);
+        bool over = false;
+
+        MNK_Reset(rules, &board);
+        for (uint8_t p = 0; p < plies && !over; p++) {
+            MNK_Mask_t empty = MNK_Empty(rules, &board);
+            uint8_t skip = (uint8_t)(NextRandom(&rng) % (uint32_t)__builtin_popcountll(empty));
+            while (skip--) {
+                empty &= empty - 1u;
+            }
+            uint8_t cell = (uint8_t)__builtin_ctzll(empty);
+            over = MNK_IsWinningMove(rules, board.cells[board.side] | ((MNK_Mask_t)1u << cell), cell);
+            MNK_MakeMove(rules, &board, cell);
+        }
+        if (!over && MNK_Empty(rules, &board) != 0) {
+            positions[n++] = board;
+        }
+    }
+    return n;
+}
+
+/**
+ * @brief  Compara los núcleos escalar y SIMD
+ * @param  rules: Variante de las posiciones (si no es la del modelo, solo se
+ *         prueban los productos internos)
+ * @param  positions: Posiciones para la red completa
+ * @param  count: Cantidad de posiciones
+ * @param  seed: Semilla de los vectores al azar (0 = NN_BENCH_SEED)
+ * @retval Casos en que difieren (tiene que dar 0)
+ */
+uint32_t NNBench_CheckKernels(const MNK_Rules_t* rules, const MNK_Board_t positions[],
+                              uint16_t count, uint32_t seed)
+{
+    uint32_t rng = (seed != 0) ? seed : NN_BENCH_SEED;
+    uint32_t mismatches = 0;
+    int8_t a[NN_MAX_INPUTS + 1];
+    int8_t b[NN_MAX_INPUTS + 1];
+
+    for (uint32_t v = 0; v < NN_BENCH_DOT_VECTORS; v++) {
+        uint16_t n = (uint16_t)((NextRandom(&rng) % (NN_MAX_INPUTS / 4u + 1u)) * 4u);
+        uint8_t offset = (uint8_t)(v & 1u);     // También direcciones no alineadas
+
+        for (uint16_t i = 0; i < n; i++) {
+            // Uno de cada cuatro vectores solo con extremos
+            uint32_t r = NextRandom(&rng);
+            a[offset + i] = (v % 4u == 3u) ? ((r & 1u) ? 127 : -128) : (int8_t)r;
+            b[offset + i] = (v % 4u == 3u) ? ((r & 2u) ? 127 : -128) : (int8_t)(r >> 8);
+        }
+        if (NN_DotScalar(&a[offset], &b[offset], n) != NN_DotSimd(&a[offset], &b[offset], n)) {
+            mismatches++;
+        }
+    }
+
+    if (NN_Matches(&NN_Model, rules)) {
+        for (uint16_t i = 0; i < count; i++) {
+            int8_t input[NN_MAX_INPUTS];
+            NN_Encode(&NN_Model, rules, &positions[i], input);
+            if (NN_Forward(&NN_Model, input, NN_KERNEL_SCALAR) !=
+                NN_Forward(&NN_Model, input, NN_KERNEL_SIMD)) {
+                mismatches++;
+            }
+        }
+    }
+    return mismatches;
+}
+
+/**
+ * @brief  Mide una evaluación de hoja sobre una lista de posiciones
+ * @param  eval: Evaluación a medir
+ * @param  rules: Variante de las posiciones
+ * @param  positions: Posiciones
+ * @param  count: Cantidad de posiciones (hasta NN_BENCH_MAX_POSITIONS)
+ * @param  clock: Reloj libre
+ * @param  ticks_per_us: Ticks del reloj por microsegundo
+ * @param  result: Estadísticas resultantes
+ */
+void NNBench_RunEval(NNBench_Eval_t eval, const MNK_Rules_t* rules, const MNK_Board_t positions[],
+                     uint16_t count, NNBench_Clock_t clock, uint32_t ticks_per_us,
+                     NNBench_Result_t* result)
+{
+    if (count > NN_BENCH_MAX_POSITIONS) {
+        count = NN_BENCH_MAX_POSITIONS;
+    }
+
+    for (uint16_t i = 0; i < count; i++) {
+        int8_t input[NN_MAX_INPUTS];
+        uint32_t start = clock();
+
+        if (eval == NN_BENCH_LINES) {
+            sink = MNK_Evaluate(rules, &positions[i]);
+        } else {
+            NN_Encode(&NN_Model, rules, &positions[i], input);
+            sink = NN_Forward(&NN_Model, input,
+                              (eval == NN_BENCH_NN_SIMD) ? NN_KERNEL_SIMD : NN_KERNEL_SCALAR);
+        }
+        uint32_t ticks = clock() - start;
+
+        samples[i] = (uint32_t)(((uint64_t)ticks * 1000u) / ticks_per_us);
+    }
+
+    qsort(samples, count, sizeof(samples[0]), CompareSamples);
+
+    result->eval = eval;
+    result->positions = count;
+    if (count == 0) {
+        result->min_ns = result->median_ns = result->p99_ns = result->max_ns = 0;
+    } else {
+        result->min_ns = samples[0];
+        result->median_ns = samples[count / 2u];
+        result->p99_ns = samples[((uint32_t)count * 99u + 99u) / 100u - 1u];
+        result->max_ns = samples[count - 1u];
+    }
+}
+
+/**
+ * @brief  Nombre de una evaluación (columna "eval" del CSV)
+ */
+const char* NNBench_EvalName(NNBench_Eval_t eval)
+{
+    return (eval < NN_BENCH_NUM_EVALS) ? eval_names[eval] : "?";
+}
+
+/**
+ * @brief  Imprime el encabezado del CSV
+ */
+void NNBench_PrintHeader(void)
+{
+    printf("eval,positions,min_ns,median_ns,p99_ns,max_ns\n");
+}
+
+/**
+ * @brief  Imprime una fila del CSV
+ */
+void NNBench_PrintResult(const NNBench_Result_t* result)
+{
+    printf("%s,%lu,%lu,%lu,%lu,%lu\n", NNBench_EvalName(result->eval),
+           (unsigned long)result->positions, (unsigned long)result->min_ns,
+           (unsigned long)result->median_ns, (unsigned long)result->p99_ns,
+           (unsigned long)result->max_ns);
+}
+
+/**
+ * @brief  Corre el benchmark en la placa con el contador de ciclos DWT
+ * @note   La salida va por printf (USART3), sobre la variante del modelo
+ */
+void NNBench_RunTarget(void)
+{
+    static MNK_Rules_t rules;
+    NNBench_Result_t result;
+
+    MNK_Init(&rules, NN_Model.width, NN_Model.height, NN_Model.k);
+    uint16_t count = NNBench_CollectPositions(&rules, bench_positions, NN_BENCH_MAX_POSITIONS, 0);
+
+    CoreDebug->DEMCR |= CoreDebug_DEMCR_TRCENA_Msk;
+    DWT->CTRL |= DWT_CTRL_CYCCNTENA_Msk;
+
+    printf("kernel_mismatches,%lu\n",
+           (unsigned long)NNBench_CheckKernels(&rules, bench_positions, count, 0));
+    NNBench_PrintHeader();
+    for (uint8_t e = 0; e < NN_BENCH_NUM_EVALS; e++) {
+        NNBench_RunEval((NNBench_Eval_t)e, &rules, bench_positions, count, TargetClock,
+                        SystemCoreClock / 1000000u, &result);
+        NNBench_PrintResult(&result);
+    }
+}
+
+/**
+ * @brief  Generador xorshift32
+ */
+static uint32_t NextRandom(uint32_t* rng)
+{
+    uint32_t x = *rng;
+    x ^= x << 13;
+    x ^= x >> 17;
+    x ^= x << 5;
+    *rng = x;
+    return x;
+}
+
+static int CompareSamples(const void* a, const void* b)
+{
+    uint32_t x = *(const uint32_t*)a;
+    uint32_t y = *(const uint32_t*)b;
+    return (x > y) - (x < y);
+}
+
+/**
+ * @brief  Reloj de la placa: contador de ciclos DWT
+ */
+static uint32_t TargetClock(void)
+{
+    return DWT->CYCCNT;
+}
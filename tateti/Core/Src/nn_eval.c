@@ -0,0 +1,153 @@
+/**
+ ******************************************************************************
+ * @file    nn_eval.c
+ * @brief   Inferencia int8 de la red de evaluación (núcleos escalar y SIMD)
+ ******************************************************************************
+ */
+
+#include "nn_eval.h"
+#include <string.h>
+
+#if defined(__ARM_FEATURE_DSP) && (__ARM_FEATURE_DSP == 1)
+#include "cmsis_compiler.h"
+#define NN_SXTB16(x)        __SXTB16(x)
+#define NN_SMLAD(x, y, acc) ((int32_t)__SMLAD((x), (y), (uint32_t)(acc)))
+#define NN_ROR(x, n)        __ROR((x), (n))
+#else
+/* Emulación portable de las instrucciones DSP (mismo resultado bit a bit) */
+static inline uint32_t NN_SXTB16(uint32_t x)
+{
+    uint16_t lo = (uint16_t)(int16_t)(int8_t)(x & 0xFFu);
+    uint16_t hi = (uint16_t)(int16_t)(int8_t)((x >> 16) & 0xFFu);
+    return ((uint32_t)hi << 16) | lo;
+}
+
+static inline uint32_t NN_ROR(uint32_t x, uint32_t n)
+{
+    return (x >> n) | (x << (32u - n));
+}
+
+static inline int32_t NN_SMLAD(uint32_t x, uint32_t y, int32_t acc)
+{
+    int32_t lo = (int32_t)(int16_t)(x & 0xFFFFu) * (int32_t)(int16_t)(y & 0xFFFFu);
+    int32_t hi = (int32_t)(int16_t)(x >> 16) * (int32_t)(int16_t)(y >> 16);
+    return (int32_t)((uint32_t)acc + (uint32_t)lo + (uint32_t)hi);
+}
+#endif
+
+/**
+ * @brief  Producto interno int8 (núcleo escalar de referencia)
+ * @param  a, b: Vectores de n bytes con signo
+ * @param  n: Longitud
+ * @retval Suma de los productos
+ */
+int32_t NN_DotScalar(const int8_t* a, const int8_t* b, uint16_t n)
+{
+    int32_t acc = 0;
+
+    for (uint16_t i = 0; i < n; i++) {
+        acc += (int32_t)a[i] * (int32_t)b[i];
+    }
+    return acc;
+}
+
+/**
+ * @brief  Producto interno int8 con SXTB16 + SMLAD (4 productos por palabra)
+ * @param  a, b: Vectores de n bytes con signo (sin requisito de alineación)
+ * @param  n: Longitud, múltiplo de 4
+ * @retval Suma de los productos (idéntica a NN_DotScalar)
+ */
+int32_t NN_DotSimd(const int8_t* a, const int8_t* b, uint16_t n)
+{
+    int32_t acc = 0;
+
+    for (uint16_t i = 0; i < n; i += 4u) {
+        uint32_t wa;
+        uint32_t wb;
+        memcpy(&wa, &a[i], sizeof(wa));     // LDR: el M4 admite accesos no alineados
+        memcpy(&wb, &b[i], sizeof(wb));
+
+        // Bytes 0 y 2, después 1 y 3 (rotando 8 bits)
+        acc = NN_SMLAD(NN_SXTB16(wa), NN_SXTB16(wb), acc);
+        acc = NN_SMLAD(NN_SXTB16(NN_ROR(wa, 8u)), NN_SXTB16(NN_ROR(wb, 8u)), acc);
+    }
+    return acc;
+}
+
+/**
+ * @brief  Indica si el modelo se entrenó para la variante en juego
+ */
+bool NN_Matches(const NN_Model_t* model, const MNK_Rules_t* rules)
+{
+    return model->width == rules->width && model->height == rules->height &&
+           model->k == rules->k;
+}
+
+/**
+ * @brief  Arma la entrada de la red desde el punto de vista del que mueve
+ * @param  model: Modelo (define el largo con relleno)
+ * @param  rules: Variante en juego
+ * @param  board: Posición
+ * @param  input: Salida, input_stride bytes
+ */
+void NN_Encode(const NN_Model_t* model, const MNK_Rules_t* rules, const MNK_Board_t* board,
+               int8_t input[NN_MAX_INPUTS])
+{
+    MNK_Mask_t own = board->cells[board->side];
+    MNK_Mask_t opp = board->cells[board->side ^ 1u];
+
+    memset(input, 0, model->input_stride);
+    while (own) {
+        input[__builtin_ctzll(own)] = 1;
+        own &= own - 1u;
+    }
+    while (opp) {
+        input[rules->num_cells + __builtin_ctzll(opp)] = 1;
+        opp &= opp - 1u;
+    }
+}
+
+/**
+ * @brief  Propaga una entrada por la red
+ * @param  model: Modelo cuantizado
+ * @param  input: Entrada de NN_Encode
+ * @param  kernel: Núcleo de los productos internos
+ * @retval Puntaje para el jugador que mueve (±NN_SCORE_ONE = ganada/perdida)
+ */
+int32_t NN_Forward(const NN_Model_t* model, const int8_t* input, NN_Kernel_t kernel)
+{
+    int32_t (*dot)(const int8_t*, const int8_t*, uint16_t) =
+        (kernel == NN_KERNEL_SIMD) ? NN_DotSimd : NN_DotScalar;
+    int8_t hidden[NN_MAX_HIDDEN];
+
+    for (uint8_t j = 0; j < model->hidden; j++) {
+        int32_t acc = model->b1[j] + dot(&model->w1[j * model->input_stride], input,
+                                         model->input_stride);
+        acc = (acc > 0) ? (acc >> model->hidden_shift) : 0;
+        hidden[j] = (int8_t)((acc > 127) ? 127 : acc);
+    }
+
+    int32_t out = model->b2 + dot(model->w2, hidden, model->hidden);
+    int64_t score = ((int64_t)out * model->out_mul) >> 16;
+
+    // La red puede pasarse un poco de ±1: que nunca se confunda con una victoria
+    if (score > 2 * NN_SCORE_ONE) score = 2 * NN_SCORE_ONE;
+    if (score < -2 * NN_SCORE_ONE) score = -2 * NN_SCORE_ONE;
+    return (int32_t)score;
+}
+
+/**
+ * @brief  Evaluación de hojas para MNK_SetEvaluator
+ * @note   Usa el núcleo de NN_USE_SIMD; con una variante distinta de la del
+ *         modelo devuelve MNK_Evaluate
+ */
+int32_t NN_Evaluate(const MNK_Rules_t* rules, const MNK_Board_t* board)
+{
+    int8_t input[NN_MAX_INPUTS];
+
+    if (!NN_Matches(&NN_Model, rules)) {
+        return MNK_Evaluate(rules, board);
+    }
+    NN_Encode(&NN_Model, rules, board, input);
+    return NN_Forward(&NN_Model, input, NN_USE_SIMD ? NN_KERNEL_SIMD : NN_KERNEL_SCALAR);
+}
@@ -0,0 +1,173 @@
+/**
+ ******************************************************************************
+ * @file    nn_model_data.c
+ * @brief   Red de evaluación int8 (GENERADO por Tools/nn_train.c)
+ ******************************************************************************
+ * @attention
+ *
+ * Variante 5x5 (k = 4), 100000 posiciones con 64 simulaciones, 32 ocultas,
+ * 30 épocas. Error cuadrático de prueba (int8): 0.0599.
+ *
+ ******************************************************************************
+ */
+
+#include "nn_eval.h"
+
+static const int8_t nn_w1[1664] = {
+      33,    9,  -65,   42,   17,   38,  -78,  -32,  -27,  -21,   31,    7,  -55,
+     -20,   -6,   12,  -20,   41,   28,   29,  -57,   39,  -19,   39,   37,  -12,
+      80,   19,  -79,   26,  -38,  -37,   83,   68,  -35,   44,   35,  -29,  -44,
+     -45,   57,   50,   53,   80,   55,  -56,  -64,  -67,  -67,  -63,    0,    0,
+     -74,   -1,    2,  -77,  -45,  -37,  -54,   44,  -55,  -72,   55,   12,   28,
+      -9,   29,  -23,  -59,  -16,   30,  -47,  -41,   17,   28,   -1,   53,   19,
+     -64,   55,    7,  -12,   -3,  -39,   74,  -24,   -3,   15,   51,   34,   64,
+     -25,   21,  -22,   41,  -10,   26,   37,  -49,   60,   56,   70,    0,    0,
+     -58,  -68,   18,  -63,  -53,   33,   22,  -40,   11,   44,  -34,  -44,   67,
+      41,  -72,  -49,   20,  -21,   50,   42,   19,   30,  -50,   71,   39,   16,
+      -3,  -35,   20,   53,  -73,   16,  -62,    7,   36,   63,  -12,   43,  -32,
+       8,  -65,   18,   13,  -66,   36,    1,  -72,    2,  -36,    8,    0,    0,
+     -61,  -18,  -26,   78,  -21,  -70,  -22,   45,  -49,  -59,  -21,  -31,  -57,
+       1,  -45,    3,  -72,  -38,   38,   40,    7,   63,  -76,   21,  -48,   20,
+     -69,   26,  -14,   42,   71,  -16,    8,  -38,   -8,   53,   44,  -64,  -79,
+     -62,  -16,  -21,   26,   23,  -14,  -20,   19,   81,  -76,  -38,    0,    0,
+       5,   47,  -58,   53,   21,   36,  -27,    2,   -9,  -19,  -77,   58,  -72,
+     -21,  -36,   32,  -67,    8,  -67,  -14,  -36,   39,   22,   -1,  -73,  -28,
+      56,  -49,   27,  -26,  -65,  -51,  -29,   71,  -65,   -6,  -74,   96,  -13,
+      51,  -22,  -32,   -1,  -52,    0,   54,  -34,  -36,  -31,   30,    0,    0,
+     -18,  -69,  -90,    6,  -59,   75,  -20,  -10,  -26,   69,   40,  -13,   24,
+       9,  -30,  -24,   36,  -74,   22,  -41,    1,  -31,    8,   11,   32,   -1,
+      68,   69,  -83,   -9,   30,   52,   11,   -2,  -12,   -5,  -73,  -63,  -22,
+     -81,  -52,   18,  -74,   51,  -42,   38,   42,  -53,   19,  -20,    0,    0,
+       4,   24,  -13,  -69,  -50,  -68,  -15,   13,  -64,  -54,  -21,  -48,  -49,
+      43,  -67,   -1,  -13,  -57,  -55,  -11,  -27,    2,    3,  -20,  -16,   46,
+     -14,   30,   19,   19,   36,   29,   -7,   95,   52,   67,   29,   83,   -7,
+      17,   75,    8,   66,   60,  -46,   29,   47,   10,   11,   20,    0,    0,
+     -19,  -78,  -42,  -49,    9,    0,  -73,  -32,  -12,  -31,  -72,  -68,  -65,
+     -51,  -83,  -43,  -55,  -53,  -56,  -55,  -12,  -44,  -53,  -18,    6,   18,
+      66,   43,   41,    0,   77,   24,   35,   35,   94,   53,   49,   94,   11,
+      74,   74,   45,   38,   10,  101,   46,   40,   36,   18,   17,    0,    0,
+      18,   43,   80,   70,   12,   13,  -26,  -27,   77,   35,  -34,  -22,   78,
+     -10,  -40,   26,   14,    7,   44,  -93,   13,  -13,  -28,  -27,   20,  -38,
+     -16,    5,  -57,  -47,    8,  -31,  -45,  -61,  -26,   16,    3,  -11,  -71,
+      46,  -20,  -23,   19,  -74,   61,   -2,  -37,   14,  -29,   35,    0,    0,
+      34,  -38,   50,   57,  -35,  -64,   11,    4,  -33,  -69,   53,  -61,  -22,
+     -65,   41,  -44,   34,   35,   14,    7,   28,   56,   28,  -16,  -35,  -73,
+      53,   50,  -11,  -39,  -23,   58,  -79,  -51,   34,  -56,   26,   -7,    0,
+     -65,    9,   54,   -2,  -48,   49,   -9,  -18,   68,  -64,   36,    0,    0,
+     -87,   40,   35,   14,  -93,   10,  -27,  -27,    2,  -59,   -2,  -70,   32,
+      22,  -64,  -26,  -46,   19,  -59,   16,   43,   -5,  -64,   -3,    4,   -2,
+      55,    0,  -80,   41,   51,   34,  -19,   -3,    1,   18,   41,    4,    7,
+      21,  -15,   30,   27,   38,   63,  -12,   22,   -6,  -11,   -2,    0,    0,
+     -28,   35,  -31,    2,  -12,   -9,  -39,  -32,  -40,    4,  -17,  -33,  -48,
+     -58,  -28,   48,  -55,   54,  -58,   -8,   50,   21,   22,  -47,   50,  -74,
+     -46,   30,   38,   12,   13,  -69,  -48,   34,  -10,  -37,   45,  -71,   52,
+       4,  -11,  -67,   17,  106,   28,   16,   18,   63,  -64,   33,    0,    0,
+      55,   72,   41,   49,   65,  117,   61,   91,   99,  104,   66,   72,  114,
+      97,   90,  117,   99,  115,   83,  127,   68,   67,   44,   60,   87,  -58,
+     -55,  -10,  -52,  -54,  -85,  -76, -102,  -76,  -88,  -80,  -61,  -95,  -98,
+     -72,  -85,  -74,  -63,  -64,  -96,  -40,  -52,  -13,  -65,  -39,    0,    0,
+     -34,  -54,  -40,  -50,   -9,  -39,  -47,  -47,  -45,   54,  -37,  -45,  -51,
+     -78,   64,  -39,  -45,  -47,  -46,   64,  -30,  -53,  -43,  -52,   17,   36,
+      62,   51,   46,    0,   60,   57,   58,   50,  -56,   42,   51,   75,   77,
+     -50,   43,   56,   64,   50,  -56,   32,   57,   44,   53,    6,    0,    0,
+     -86,   56,  -58,  -29,   11,   14,   26,  -18,  -63,  -19,  -82,   41,  -74,
+      40,   65,   -5,    2,   48,   -5,  -36,   42,   17,  -26,    4,  -10,   10,
+      61,   12,   15,    2,    9,  -36,  -75,    8,  -17,   16,   31,  -64,    9,
+     -49,   27,  -13,   42,  -51,   43,   36,  -59,    9,   47,   23,    0,    0,
+     -55,  -66,  -37,  -17,   29,  -51,    1,  -25,  -43,  -70,   16,   -2,  -51,
+      43,  -41,  -15,  -74,    9,  -41,    4,   23,   16,  -49,    7,   36,   -2,
+      34,    9,   36,  -39,   17,  -41,   97,  -79,  -12,   62,   45,  -54,   53,
+     -35,   65,  -69,  -47,   38,   24,  -20,   26,  -62,   66,   33,    0,    0,
+       4,   42,   50,  -23,  -50,   27,  -24,   12,   10,   30,    1,   -9,  -21,
+       2,  -28,   36,  -83,  -50,  -47,   -2,  -53,   30,   60,  -52,    2,  -80,
+      22,  -73,   12,  -75,   70,  -51,   62,   64,   32,  -18,   -2,   62,  -38,
+       5,  -40,  -16,   63,  -13,   13,  -67,  -47,   66,   14,  -73,    0,    0,
+     -13,  -24,  -29,   10,  -11,  -23,  -54,  -39,   35,  -32,   28,  -51,   24,
+      50,   86,    3,   23,   35,  -75,  -20,  -30,  -86,   48,  -45,  -89,  -61,
+       0,   38,  -24,   10,    0,   30,    7,  -12,   26,  -12,   76,   83,  -27,
+     -33,  -48,   18,   32,   90,  -63,  -33,  -73,  -16,  -76,  -12,    0,    0,
+      -7,   53,   16,   11,  -59,  -22,  -24,  -20,  -57,  -70,   32,  -35,   -3,
+      81,   46,  -28, -105,   74,   73,   52,  -46,  -89,  -71,   18,   -1,    0,
+     -43,  -53,   39,  -27,  -75,   64,   -6,  -28,  -60,  -51,   34,    5,    4,
+     -15,  -48,   72,  -84,  -71,   47,   24,   59,  -23,   41,   32,    0,    0,
+      21,   48,   63,    1,  -66,  -42,  -23,   39,  -37,  -77,  -81,  -17,   20,
+      40,  -14,  -70,   53,  -16,  -29,   -7,   57,  -56,  -87,  -55,  -63,   13,
+     -27,   -6,  -35,   27,  -28,   61,   50,   28,   54,  -10,   29,  -62,  -45,
+      48,   30,  -49,  -66,  -11,  -49,   44,   35,  -57,   36,   61,    0,    0,
+      23,   -2,   23,  -30,   40,    0,   32,   34,    5,   82,   29,  -17,  -10,
+       3,   92,   60,   67,   36,  -54,   78,  -44,  -53,   34,    4,   57,  -10,
+     -20,   41,  -32,  -20,   36,  -36,   35,  -51,  -94,  -66,   35,   -1,   20,
+     -28,   20,  -39,   37,  -12, -112,  -60,   -7,  -56,   14,  -22,    0,    0,
+       1,  -59,   16,   54,  -60,  -10,  -52,  -78,  -81,   26,  -70,  -54,   24,
+      81,  -10,  -29,  -48,   40,   17,  -23,   21,   -5,   -7,   -3,   70,  -18,
+     -34,   23,   30,   53,   39,   70,  -21,  -55,    8,   72,   59,  -80,  -48,
+     -76,  -50,   17,  -73,  -55,  -49,  -60,  -68,  -74,   21,   33,    0,    0,
+      34,   53,   25,  -33,   16,   37,  -66,   -2,   -7,  -38,   22,  -18,  -26,
+     -17,   35,  -79,   12,   46,   46,    4,   71,  -80,  -79,  -87,   50,  -60,
+     -15,  -45,   12,   40,   33,    1,  -68,  -64,   60,  -30,  -71,   72,   -5,
+     -64,   21,  -21,  -53,  -17,   67,   22,  -35,   -7,   -5,   18,    0,    0,
+     -62,    2,  -24,  -24,  -56,  -47,  -18,   32,  -65,  -34,  -58,  -12,  -61,
+      26,  -61,  -26,  -39,  -47,   -4,    7,   -4,  102,   64,   81,   59,    2,
+      20,    5,  -48,  -21,   45,   -2,   58,  -28,   35,    4,   -5,    2,   14,
+      17,  -20,   -9,    0,   33,   26,  -86,  -98,  -98, -102,   13,    0,    0,
+     -38,   26,  -13,   48,   31,   21,   29,  -12,  -17,  -17,  -26,   16,  -75,
+     -73,  -57,  -68,   -3,    4,   15,  -29,  -46,  -37,   29,   43,   33,   12,
+     -27,   64,  -51,  -42,   78,   44,   63,  -41,   29,  -13,   -3,    5,   59,
+      49,   17,   53,  -65,   -6,   23,  -80,  -70,  -31,   -3,  -54,    0,    0,
+      41,  -19,  -58,   32,  -81,  -18,  -64,   -8,   43,   23,  -54,  -52,  -50,
+      18,  -45,   11,  -62,  -61,   20,  -56,    0,  -76,   56,   14,   59,   64,
+     -48,  -62,  -12,    7,   65,   67,  -36,   -7,   24,  -23,   -9,  -84,   11,
+     -33,   39,   60,   74,   -4,  -52,    2,  -52,   31,   68,   49,    0,    0,
+       9,  -19,  -12,   -8,   44,   18,  -50,  -71,   60,  -18,  -32,  -64,  -12,
+     -69,   13,   -1,   45,  -62,  -85,  -45,   -6,   18,   24,    3,   -7,  -31,
+     -26,   32,  -16,   61,    7,   86,   48,   15,   -2,  -29,   70,  -59,   27,
+      64,  -64,   10,   35,   40,   42,   24,   38,   61,   63,   31,    0,    0,
+      63,   35,  -61,  -72,  -65,   -2,   -4,  -34,  -49,   38,    5,  -33,  -30,
+      19,   26,   71,   42,    8,  -10,   47,   69,   51,   58,  -47,  -25,  -23,
+     -42,   21,  -69,   62,  -20,   25,  -84,  -37,  -78,   26,  -12,   45,  -55,
+      58,    3,  -40,  -21,  -18,  -79,   47,   41,   47,  -70,   -7,    0,    0,
+      14,   21,   11,   26,   31,  -60,   42,   57,   39,   45,  -52,   43,   40,
+      61,   28,  -58,   16,   18,   20,   42,  -13,   19,    6,   36,   34,   20,
+     -22,  -29,  -30,  -13,   65,  -31,  -45,  -21,  -25,   84,  -53,  -19,  -35,
+     -29,   72,  -33,  -36,  -52,  -30,   25,  -13,  -30,  -16,  -26,    0,    0,
+      -1,  -13,   19,   19,  -24,   46,  -79,  -20,  -16,    8,  -49,   68,  -76,
+     -43,   36,   17,  -40,  -40,   26,   17,   79,   69,  -65,    6,   52,  -61,
+       2,  -37,   26,   -7,  -16,  -44,  -73,   60,  -37,   54,   48,  -44,  -58,
+     -13,  -43,   -4,   59,  -67,  -26,   12,  -17,  -65,   13,   -8,    0,    0,
+      -8,  -66,   14,  -63,    1,   12,  -62,  -50,  -72,  -61,   48,  -43,   18,
+      54,    2,   11,  -43,   66,  -50,   69,  -16,  -53,   50,   49,   45,  -32,
+       5,  -76,  -14,   32,  -43,  -39,  -87,  -31,   16,   57,   48,   11,   23,
+      58,    3,  -18,   36,  -43,   47,   22,  -10,  -31,   20,  -12,    0,    0,
+     -21,  -70,  -71,   51,   65,  -74,  -25,   14,   46,   -9,   57,   29,  -31,
+      32,  -14,   53,  -28,   58,  -64,   65,  -12,  -59,   56,   56,  -77,  -79,
+     -24,  -62,    7,   44,  -18,  -12,   29,    7,  -26,  -31,  -20,  -52,  -57,
+     -13,  -32,  -83,  -68,   32,   54,  -44,   32,  -54,  -30,   37,    0,    0
+};
+
+static const int32_t nn_b1[32] = {
+       -14,    -31,    -43,    -24,    -29,    -14,     62,     62,
+       -38,    -37,    -43,    -46,    116,     92,    -38,    -17,
+       -25,    -53,    -60,    -39,    -86,    -26,    -12,    -60,
+       -11,    -11,     17,    -37,     90,    -13,    -25,    -31
+};
+
+static const int8_t nn_w2[32] = {
+     -10,   -8,   -1,   -6,   -2,   14,  -63,  -76,
+      20,   -6,  -16,  -28,  127, -112,  -19,  -20,
+      -3,  -38,  -25,   11,   39,  -11,  -18,   65,
+     -22,  -12,  -28,   -4,   90,    1,   -8,  -15
+};
+
+const NN_Model_t NN_Model = {
+    .width = 5,
+    .height = 5,
+    .k = 4,
+    .hidden = 32,
+    .input_stride = 52,
+    .hidden_shift = 3,
+    .w1 = nn_w1,
+    .b1 = nn_b1,
+    .w2 = nn_w2,
+    .b2 = 826,
+    .out_mul = 63153
+};
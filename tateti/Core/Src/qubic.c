@@ -0,0 +1,683 @@
+/**
+ ******************************************************************************
+ * @file    qubic.c
+ * @brief   Implementación del motor de Qubic: reglas, amenazas y búsqueda
+ ******************************************************************************
+ */
+
+#include "qubic.h"
+#include <stddef.h>
+
+/*============================================================================*/
+/* Tablas (celda = capa * 16 + fila * 4 + columna)                            */
+/*============================================================================*/
+
+const QB_Mask_t QB_WinMasks[QB_NUM_LINES] = {
+    /* Filas (x) de cada capa */
+    0x000000000000000Full, 0x00000000000000F0ull,
+    0x0000000000000F00ull, 0x000000000000F000ull,
+    0x00000000000F0000ull, 0x0000000000F00000ull,
+    0x000000000F000000ull, 0x00000000F0000000ull,
+    0x0000000F00000000ull, 0x000000F000000000ull,
+    0x00000F0000000000ull, 0x0000F00000000000ull,
+    0x000F000000000000ull, 0x00F0000000000000ull,
+    0x0F00000000000000ull, 0xF000000000000000ull,
+    /* Columnas (y) de cada capa */
+    0x0000000000001111ull, 0x0000000000002222ull,
+    0x0000000000004444ull, 0x0000000000008888ull,
+    0x0000000011110000ull, 0x0000000022220000ull,
+    0x0000000044440000ull, 0x0000000088880000ull,
+    0x0000111100000000ull, 0x0000222200000000ull,
+    0x0000444400000000ull, 0x0000888800000000ull,
+    0x1111000000000000ull, 0x2222000000000000ull,
+    0x4444000000000000ull, 0x8888000000000000ull,
+    /* Pilares (z) entre capas */
+    0x0001000100010001ull, 0x0002000200020002ull,
+    0x0004000400040004ull, 0x0008000800080008ull,
+    0x0010001000100010ull, 0x0020002000200020ull,
+    0x0040004000400040ull, 0x0080008000800080ull,
+    0x0100010001000100ull, 0x0200020002000200ull,
+    0x0400040004000400ull, 0x0800080008000800ull,
+    0x1000100010001000ull, 0x2000200020002000ull,
+    0x4000400040004000ull, 0x8000800080008000ull,
+    /* Diagonales de cada capa (plano xy) */
+    0x0000000000008421ull, 0x0000000000001248ull,
+    0x0000000084210000ull, 0x0000000012480000ull,
+    0x0000842100000000ull, 0x0000124800000000ull,
+    0x8421000000000000ull, 0x1248000000000000ull,
+    /* Diagonales verticales en planos xz */
+    0x0008000400020001ull, 0x0001000200040008ull,
+    0x0080004000200010ull, 0x0010002000400080ull,
+    0x0800040002000100ull, 0x0100020004000800ull,
+    0x8000400020001000ull, 0x1000200040008000ull,
+    /* Diagonales verticales en planos yz */
+    0x1000010000100001ull, 0x0001001001001000ull,
+    0x2000020000200002ull, 0x0002002002002000ull,
+    0x4000040000400004ull, 0x0004004004004000ull,
+    0x8000080000800008ull, 0x0008008008008000ull,
+    /* Diagonales del cubo */
+    0x8000040000200001ull, 0x1000020000400008ull,
+    0x0008004002001000ull, 0x0001002004008000ull,
+};
+
+const uint8_t QB_CellLineCount[QB_NUM_CELLS] = {
+    7, 4, 4, 7, 4, 4, 4, 4, 4, 4, 4, 4, 7, 4, 4, 7,
+    4, 4, 4, 4, 4, 7, 7, 4, 4, 7, 7, 4, 4, 4, 4, 4,
+    4, 4, 4, 4, 4, 7, 7, 4, 4, 7, 7, 4, 4, 4, 4, 4,
+    7, 4, 4, 7, 4, 4, 4, 4, 4, 4, 4, 4, 7, 4, 4, 7,
+};
+
+const uint8_t QB_CellLines[QB_NUM_CELLS][QB_MAX_CELL_LINES] = {
+    /* Celdas con 4 líneas: relleno con QB_NO_LINE */
+    { 0, 16, 32, 48, 56, 64, 72},  // 0
+    { 0, 17, 33, 66, QB_NO_LINE, QB_NO_LINE, QB_NO_LINE},  // 1
+    { 0, 18, 34, 68, QB_NO_LINE, QB_NO_LINE, QB_NO_LINE},  // 2
+    { 0, 19, 35, 49, 57, 70, 73},  // 3
+    { 1, 16, 36, 58, QB_NO_LINE, QB_NO_LINE, QB_NO_LINE},  // 4
+    { 1, 17, 37, 48, QB_NO_LINE, QB_NO_LINE, QB_NO_LINE},  // 5
+    { 1, 18, 38, 49, QB_NO_LINE, QB_NO_LINE, QB_NO_LINE},  // 6
+    { 1, 19, 39, 59, QB_NO_LINE, QB_NO_LINE, QB_NO_LINE},  // 7
+    { 2, 16, 40, 60, QB_NO_LINE, QB_NO_LINE, QB_NO_LINE},  // 8
+    { 2, 17, 41, 49, QB_NO_LINE, QB_NO_LINE, QB_NO_LINE},  // 9
+    { 2, 18, 42, 48, QB_NO_LINE, QB_NO_LINE, QB_NO_LINE},  // 10
+    { 2, 19, 43, 61, QB_NO_LINE, QB_NO_LINE, QB_NO_LINE},  // 11
+    { 3, 16, 44, 49, 62, 65, 74},  // 12
+    { 3, 17, 45, 67, QB_NO_LINE, QB_NO_LINE, QB_NO_LINE},  // 13
+    { 3, 18, 46, 69, QB_NO_LINE, QB_NO_LINE, QB_NO_LINE},  // 14
+    { 3, 19, 47, 48, 63, 71, 75},  // 15
+    { 4, 20, 32, 50, QB_NO_LINE, QB_NO_LINE, QB_NO_LINE},  // 16
+    { 4, 21, 33, 56, QB_NO_LINE, QB_NO_LINE, QB_NO_LINE},  // 17
+    { 4, 22, 34, 57, QB_NO_LINE, QB_NO_LINE, QB_NO_LINE},  // 18
+    { 4, 23, 35, 51, QB_NO_LINE, QB_NO_LINE, QB_NO_LINE},  // 19
+    { 5, 20, 36, 64, QB_NO_LINE, QB_NO_LINE, QB_NO_LINE},  // 20
+    { 5, 21, 37, 50, 58, 66, 72},  // 21
+    { 5, 22, 38, 51, 59, 68, 73},  // 22
+    { 5, 23, 39, 70, QB_NO_LINE, QB_NO_LINE, QB_NO_LINE},  // 23
+    { 6, 20, 40, 65, QB_NO_LINE, QB_NO_LINE, QB_NO_LINE},  // 24
+    { 6, 21, 41, 51, 60, 67, 74},  // 25
+    { 6, 22, 42, 50, 61, 69, 75},  // 26
+    { 6, 23, 43, 71, QB_NO_LINE, QB_NO_LINE, QB_NO_LINE},  // 27
+    { 7, 20, 44, 51, QB_NO_LINE, QB_NO_LINE, QB_NO_LINE},  // 28
+    { 7, 21, 45, 62, QB_NO_LINE, QB_NO_LINE, QB_NO_LINE},  // 29
+    { 7, 22, 46, 63, QB_NO_LINE, QB_NO_LINE, QB_NO_LINE},  // 30
+    { 7, 23, 47, 50, QB_NO_LINE, QB_NO_LINE, QB_NO_LINE},  // 31
+    { 8, 24, 32, 52, QB_NO_LINE, QB_NO_LINE, QB_NO_LINE},  // 32
+    { 8, 25, 33, 57, QB_NO_LINE, QB_NO_LINE, QB_NO_LINE},  // 33
+    { 8, 26, 34, 56, QB_NO_LINE, QB_NO_LINE, QB_NO_LINE},  // 34
+    { 8, 27, 35, 53, QB_NO_LINE, QB_NO_LINE, QB_NO_LINE},  // 35
+    { 9, 24, 36, 65, QB_NO_LINE, QB_NO_LINE, QB_NO_LINE},  // 36
+    { 9, 25, 37, 52, 59, 67, 75},  // 37
+    { 9, 26, 38, 53, 58, 69, 74},  // 38
+    { 9, 27, 39, 71, QB_NO_LINE, QB_NO_LINE, QB_NO_LINE},  // 39
+    {10, 24, 40, 64, QB_NO_LINE, QB_NO_LINE, QB_NO_LINE},  // 40
+    {10, 25, 41, 53, 61, 66, 73},  // 41
+    {10, 26, 42, 52, 60, 68, 72},  // 42
+    {10, 27, 43, 70, QB_NO_LINE, QB_NO_LINE, QB_NO_LINE},  // 43
+    {11, 24, 44, 53, QB_NO_LINE, QB_NO_LINE, QB_NO_LINE},  // 44
+    {11, 25, 45, 63, QB_NO_LINE, QB_NO_LINE, QB_NO_LINE},  // 45
+    {11, 26, 46, 62, QB_NO_LINE, QB_NO_LINE, QB_NO_LINE},  // 46
+    {11, 27, 47, 52, QB_NO_LINE, QB_NO_LINE, QB_NO_LINE},  // 47
+    {12, 28, 32, 54, 57, 65, 75},  // 48
+    {12, 29, 33, 67, QB_NO_LINE, QB_NO_LINE, QB_NO_LINE},  // 49
+    {12, 30, 34, 69, QB_NO_LINE, QB_NO_LINE, QB_NO_LINE},  // 50
+    {12, 31, 35, 55, 56, 71, 74},  // 51
+    {13, 28, 36, 59, QB_NO_LINE, QB_NO_LINE, QB_NO_LINE},  // 52
+    {13, 29, 37, 54, QB_NO_LINE, QB_NO_LINE, QB_NO_LINE},  // 53
+    {13, 30, 38, 55, QB_NO_LINE, QB_NO_LINE, QB_NO_LINE},  // 54
+    {13, 31, 39, 58, QB_NO_LINE, QB_NO_LINE, QB_NO_LINE},  // 55
+    {14, 28, 40, 61, QB_NO_LINE, QB_NO_LINE, QB_NO_LINE},  // 56
+    {14, 29, 41, 55, QB_NO_LINE, QB_NO_LINE, QB_NO_LINE},  // 57
+    {14, 30, 42, 54, QB_NO_LINE, QB_NO_LINE, QB_NO_LINE},  // 58
+    {14, 31, 43, 60, QB_NO_LINE, QB_NO_LINE, QB_NO_LINE},  // 59
+    {15, 28, 44, 55, 63, 64, 73},  // 60
+    {15, 29, 45, 66, QB_NO_LINE, QB_NO_LINE, QB_NO_LINE},  // 61
+    {15, 30, 46, 68, QB_NO_LINE, QB_NO_LINE, QB_NO_LINE},  // 62
+    {15, 31, 47, 54, 62, 70, 72},  // 63
+};
+
+/*============================================================================*/
+/* Búsqueda                                                                   */
+/*============================================================================*/
+
+/* Valor de una línea sin fichas del rival según las fichas propias (0-3) */
+static const int16_t line_value[4] = {0, 1, 8, 64};
+
+/* Puntajes de orden de jugadas */
+#define ORDER_PV        10000
+#define ORDER_KILLER    1000
+#define ORDER_THREAT    500     // Deja 3 en línea: el rival tiene que bloquear
+
+/* Puntajes a partir de los cuales se considera victoria forzada */
+#define QB_SCORE_MATE   (QB_SCORE_WIN - QB_NUM_CELLS)
+
+/* Estado de la búsqueda de amenazas */
+typedef struct {
+    uint32_t nodes;
+    uint32_t limit;
+} ThreatState_t;
+
+/* Estado del alfa-beta (en la pila del llamador: reentrante) */
+typedef struct {
+    QB_Board_t board;
+    QB_Clock_t clock;
+    uint32_t start;
+    uint32_t budget;
+    uint32_t nodes;
+    bool aborted;
+    bool can_abort;         // false durante la profundidad 1
+    uint8_t pv_move;        // Mejor jugada de la iteración anterior (solo raíz)
+    uint8_t killers[QB_NUM_CELLS + 1u];
+} SearchState_t;
+
+/* Prototipos funciones privadas */
+static bool IsSingleBit(QB_Mask_t mask);
+static uint8_t LineCount(QB_Mask_t mask);
+static QB_Mask_t NewThreats(QB_Mask_t own, QB_Mask_t opp, uint8_t cell);
+static bool ThreatSpace(ThreatState_t* t, QB_Mask_t own, QB_Mask_t opp, uint8_t depth,
+                        uint8_t* move_out);
+static int32_t Negamax(SearchState_t* s, uint8_t depth, uint8_t ply, int32_t alpha, int32_t beta,
+                       uint8_t* best_move_out);
+static uint8_t OrderMoves(const SearchState_t* s, uint8_t ply, uint8_t pv_move, QB_Mask_t candidates,
+                          uint8_t moves[]);
+static int32_t EvaluateSide(QB_Mask_t own, QB_Mask_t opp);
+
+/**
+ * @brief  Vacía el tablero (mueve P1)
+ * @param  board: Tablero a inicializar
+ * @retval None
+ */
+void QB_Reset(QB_Board_t* board)
+{
+    board->cells[0] = 0;
+    board->cells[1] = 0;
+    board->side = 0;
+    board->move_count = 0;
+    board->result = QB_RESULT_NONE;
+}
+
+/**
+ * @brief  Verifica si una jugada es legal
+ * @param  cell: Celda (0-63)
+ * @retval true si la partida sigue y la celda está vacía
+ */
+bool QB_IsLegal(const QB_Board_t* board, uint8_t cell)
+{
+    return cell < QB_NUM_CELLS && board->result == QB_RESULT_NONE &&
+           (QB_Empty(board) & ((QB_Mask_t)1u << cell)) != 0;
+}
+
+/**
+ * @brief  Aplica una jugada legal y actualiza el resultado
+ * @param  cell: Celda (debe ser legal)
+ * @retval None
+ */
+void QB_MakeMove(QB_Board_t* board, uint8_t cell)
+{
+    uint8_t side = board->side;
+    QB_Mask_t own = board->cells[side] | ((QB_Mask_t)1u << cell);
+
+    board->cells[side] = own;
+    board->move_count++;
+
+    // Solo la jugada recién hecha puede cerrar la partida
+    if (QB_IsWinningMove(own, cell)) {
+        board->result = (side == 0) ? QB_RESULT_P1 : QB_RESULT_P2;
+    } else if (board->move_count == QB_NUM_CELLS) {
+        board->result = QB_RESULT_DRAW;
+    }
+    board->side = side ^ 1u;
+}
+
+/**
+ * @brief  Deshace la última jugada aplicada con QB_MakeMove
+ * @note   Antes de cualquier jugada la partida seguía: no hace falta guardar nada
+ * @param  cell: Celda de la última jugada
+ * @retval None
+ */
+void QB_UnmakeMove(QB_Board_t* board, uint8_t cell)
+{
+    uint8_t side = board->side ^ 1u;
+
+    board->cells[side] &= ~((QB_Mask_t)1u << cell);
+    board->result = QB_RESULT_NONE;
+    board->side = side;
+    board->move_count--;
+}
+
+/**
+ * @brief  Indica si la celda recién ocupada completa una línea
+ * @param  own: Celdas del jugador, incluida la nueva
+ * @param  cell: Celda recién ocupada
+ */
+bool QB_IsWinningMove(QB_Mask_t own, uint8_t cell)
+{
+    for (uint8_t i = 0; i < QB_CellLineCount[cell]; i++) {
+        QB_Mask_t line = QB_WinMasks[QB_CellLines[cell][i]];
+        if ((own & line) == line) {
+            return true;
+        }
+    }
+    return false;
+}
+
+/**
+ * @brief  Celdas vacías que completan una línea del jugador (3 propias y 1 vacía)
+ * @param  own: Celdas del jugador
+ * @param  opp: Celdas del rival
+ * @retval Máscara de celdas ganadoras
+ */
+QB_Mask_t QB_ThreatCells(QB_Mask_t own, QB_Mask_t opp)
+{
+    QB_Mask_t threats = 0;
+
+    for (uint8_t i = 0; i < QB_NUM_LINES; i++) {
+        QB_Mask_t line = QB_WinMasks[i];
+        if ((line & opp) == 0 && IsSingleBit(line & ~own)) {
+            threats |= line & ~own;
+        }
+    }
+    return threats;
+}
+
+/**
+ * @brief  Evaluación estática desde el punto de vista del jugador que mueve
+ */
+int32_t QB_Evaluate(const QB_Board_t* board)
+{
+    QB_Mask_t own = board->cells[board->side];
+    QB_Mask_t opp = board->cells[board->side ^ 1u];
+
+    return EvaluateSide(own, opp) - EvaluateSide(opp, own);
+}
+
+/**
+ * @brief  Busca una victoria forzada con amenazas sucesivas
+ * @note   Cada jugada del atacante deja 3 en línea y el defensor solo puede
+ *         bloquear; gana si arma dos amenazas a la vez. Si un bloqueo le da
+ *         una amenaza al defensor esa rama se descarta, así que una victoria
+ *         encontrada es segura, pero no se encuentran todas.
+ * @param  own: Celdas del atacante (el que mueve)
+ * @param  opp: Celdas del defensor
+ * @param  max_depth: Jugadas del atacante como máximo
+ * @param  node_limit: Nodos como máximo (acota la latencia)
+ * @param  move_out: Primera jugada de la secuencia ganadora
+ * @param  nodes_out: Nodos visitados (puede ser NULL)
+ * @retval true si encontró una victoria forzada
+ */
+bool QB_ThreatSearch(QB_Mask_t own, QB_Mask_t opp, uint8_t max_depth, uint32_t node_limit,
+                     uint8_t* move_out, uint32_t* nodes_out)
+{
+    ThreatState_t t = {0, node_limit};
+    QB_Mask_t wins = QB_ThreatCells(own, opp);
+    bool found = false;
+
+    if (wins) {
+        *move_out = QB_PopLowest(&wins);
+        found = true;
+    } else if (QB_ThreatCells(opp, own) == 0 && max_depth > 0) {
+        // Con una amenaza del rival pendiente la jugada es obligada
+        found = ThreatSpace(&t, own, opp, max_depth, move_out);
+    }
+    if (nodes_out != NULL) {
+        *nodes_out = t.nodes;
+    }
+    return found;
+}
+
+/**
+ * @brief  Elige una jugada con latencia acotada
+ * @note   Orden: ganar ya, bloquear una amenaza, victoria por amenazas y
+ *         alfa-beta con profundización iterativa
+ * @param  board: Posición a analizar (no se modifica)
+ * @param  max_depth: Profundidad máxima del alfa-beta (hasta QB_MAX_DEPTH)
+ * @param  clock: Reloj para el plazo (NULL = sin plazo)
+ * @param  budget: Plazo en ticks de clock desde la llamada
+ * @param  result: Resultado
+ * @retval None
+ */
+void QB_Search(const QB_Board_t* board, uint8_t max_depth, QB_Clock_t clock, uint32_t budget,
+               QB_SearchResult_t* result)
+{
+    SearchState_t s;
+    QB_Mask_t own = board->cells[board->side];
+    QB_Mask_t opp = board->cells[board->side ^ 1u];
+    uint32_t tss_nodes = 0;
+
+    result->best_move = QB_NO_MOVE;
+    result->score = 0;
+    result->depth = 0;
+    result->nodes = 0;
+    result->forced_win = false;
+    result->timed_out = false;
+
+    if (board->result != QB_RESULT_NONE || QB_Empty(board) == 0) {
+        return;
+    }
+
+    // Jugadas que no necesitan búsqueda
+    QB_Mask_t wins = QB_ThreatCells(own, opp);
+    if (wins) {
+        result->best_move = QB_PopLowest(&wins);
+        result->score = QB_SCORE_WIN - 1;
+        result->forced_win = true;
+        return;
+    }
+    QB_Mask_t blocks = QB_ThreatCells(opp, own);
+    if (blocks) {
+        result->best_move = QB_PopLowest(&blocks);
+        result->score = (blocks != 0) ? -(QB_SCORE_WIN - 2) : 0;  // Amenaza doble: perdida
+        return;
+    }
+    if (QB_ThreatSearch(own, opp, QB_TSS_MAX_DEPTH, QB_TSS_NODE_LIMIT, &result->best_move,
+                        &tss_nodes)) {
+        result->score = QB_SCORE_MATE;
+        result->nodes = tss_nodes;
+        result->forced_win = true;
+        return;
+    }
+
+    s.board = *board;
+    s.clock = clock;
+    s.start = (clock != NULL) ? clock() : 0;
+    s.budget = budget;
+    s.nodes = 0;
+    s.aborted = false;
+    s.pv_move = QB_NO_MOVE;
+    for (uint8_t i = 0; i <= QB_NUM_CELLS; i++) {
+        s.killers[i] = QB_NO_MOVE;
+    }
+    if (max_depth > QB_MAX_DEPTH) {
+        max_depth = QB_MAX_DEPTH;
+    }
+    if (max_depth == 0) {
+        max_depth = 1;
+    }
+
+    for (uint8_t depth = 1; depth <= max_depth; depth++) {
+        uint8_t best_move = QB_NO_MOVE;
+
+        s.can_abort = (depth > 1);
+        int32_t score = Negamax(&s, depth, 0, -QB_SCORE_INF, QB_SCORE_INF, &best_move);
+        if (s.aborted) {
+            result->timed_out = true;
+            break;
+        }
+
+        result->best_move = best_move;
+        result->score = score;
+        result->depth = depth;
+        s.pv_move = best_move;
+
+        // Resultado forzado: más profundidad no cambia nada
+        if (score >= QB_SCORE_MATE || score <= -QB_SCORE_MATE ||
+            depth >= QB_NUM_CELLS - board->move_count) {
+            break;
+        }
+    }
+    result->nodes = tss_nodes + s.nodes;
+}
+
+/**
+ * @brief  Indica si la máscara tiene exactamente un bit en 1
+ */
+static bool IsSingleBit(QB_Mask_t mask)
+{
+    return mask != 0 && (mask & (mask - 1u)) == 0;
+}
+
+/**
+ * @brief  Cantidad de bits en 1 de una línea enmascarada (0-4)
+ * @note   El M4 no tiene popcount: pocas iteraciones porque hay como mucho 4 bits
+ */
+static uint8_t LineCount(QB_Mask_t mask)
+{
+    uint8_t count = 0;
+
+    while (mask) {
+        mask &= mask - 1u;
+        count++;
+    }
+    return count;
+}
+
+/**
+ * @brief  Amenazas del jugador en las líneas que pasan por una celda
+ * @param  own: Celdas del jugador, incluida la celda
+ * @param  opp: Celdas del rival
+ * @param  cell: Celda recién ocupada
+ * @retval Máscara de celdas ganadoras creadas por la jugada
+ */
+static QB_Mask_t NewThreats(QB_Mask_t own, QB_Mask_t opp, uint8_t cell)
+{
+    QB_Mask_t threats = 0;
+
+    for (uint8_t i = 0; i < QB_CellLineCount[cell]; i++) {
+        QB_Mask_t line = QB_WinMasks[QB_CellLines[cell][i]];
+        if ((line & opp) == 0 && IsSingleBit(line & ~own)) {
+            threats |= line & ~own;
+        }
+    }
+    return threats;
+}
+
+/**
+ * @brief  Paso recursivo de QB_ThreatSearch
+ * @note   Invariante: ninguno de los dos tiene una amenaza pendiente
+ * @retval true si hay victoria forzada desde esta posición
+ */
+static bool ThreatSpace(ThreatState_t* t, QB_Mask_t own, QB_Mask_t opp, uint8_t depth,
+                        uint8_t* move_out)
+{
+    uint8_t singles[QB_NUM_CELLS];  // Sin guardar las amenazas: la pila crece por nivel
+    uint8_t count = 0;
+    QB_Mask_t candidates = 0;
+
+    if (++t->nodes > t->limit) {
+        return false;
+    }
+
+    // Celdas que completan 3 en una línea con 2 propias y sin fichas del rival
+    for (uint8_t i = 0; i < QB_NUM_LINES; i++) {
+        QB_Mask_t line = QB_WinMasks[i];
+        QB_Mask_t rest = line & ~own;
+        if ((line & opp) == 0 && LineCount(rest) == 2u) {
+            candidates |= rest;
+        }
+    }
+
+    // Primero las amenazas dobles (victoria inmediata), después las simples
+    while (candidates) {
+        uint8_t cell = QB_PopLowest(&candidates);
+        QB_Mask_t threats = NewThreats(own | ((QB_Mask_t)1u << cell), opp, cell);
+
+        if (!IsSingleBit(threats)) {
+            *move_out = cell;
+            return true;
+        }
+        singles[count++] = cell;
+    }
+    if (depth <= 1) {
+        return false;
+    }
+
+    for (uint8_t i = 0; i < count; i++) {
+        QB_Mask_t attacker = own | ((QB_Mask_t)1u << singles[i]);
+        QB_Mask_t block = NewThreats(attacker, opp, singles[i]);
+        QB_Mask_t defender = opp | block;
+        uint8_t reply = QB_PopLowest(&block);
+        uint8_t next;
+
+        // Si el bloqueo le da una amenaza al defensor, el atacante pierde la iniciativa
+        if (NewThreats(defender, attacker, reply) != 0) {
+            continue;
+        }
+        if (ThreatSpace(t, attacker, defender, (uint8_t)(depth - 1u), &next)) {
+            *move_out = singles[i];
+            return true;
+        }
+        if (t->nodes > t->limit) {
+            break;
+        }
+    }
+    return false;
+}
+
+/**
+ * @brief  Negamax con poda alfa-beta sobre s->board
+ * @note   Con una amenaza del rival pendiente solo se explora el bloqueo y
+ *         no se descuenta profundidad (jugada obligada)
+ * @param  ply: Jugadas desde la raíz
+ * @param  best_move_out: Mejor jugada encontrada (solo se usa en la raíz)
+ * @retval Puntaje desde el punto de vista del jugador que mueve
+ */
+static int32_t Negamax(SearchState_t* s, uint8_t depth, uint8_t ply, int32_t alpha, int32_t beta,
+                       uint8_t* best_move_out)
+{
+    QB_Board_t* board = &s->board;
+    uint8_t moves[QB_NUM_CELLS];
+
+    s->nodes++;
+    if (s->can_abort && s->clock != NULL && (s->nodes % QB_CHECK_NODES) == 0 &&
+        (s->clock() - s->start) >= s->budget) {
+        s->aborted = true;
+    }
+    if (s->aborted) {
+        return 0;
+    }
+
+    // Solo puede haber ganado el que acaba de mover
+    if (board->result == QB_RESULT_DRAW) {
+        return 0;
+    }
+    if (board->result != QB_RESULT_NONE) {
+        return -(QB_SCORE_WIN - ply);
+    }
+
+    QB_Mask_t own = board->cells[board->side];
+    QB_Mask_t opp = board->cells[board->side ^ 1u];
+    QB_Mask_t wins = QB_ThreatCells(own, opp);
+    if (wins) {
+        if (best_move_out != NULL) {
+            *best_move_out = QB_PopLowest(&wins);
+        }
+        return QB_SCORE_WIN - (ply + 1);
+    }
+
+    QB_Mask_t candidates = QB_ThreatCells(opp, own);
+    if (candidates) {
+        if (!IsSingleBit(candidates)) {
+            // Dos amenazas: se bloquea una y se pierde en la jugada siguiente
+            if (best_move_out != NULL) {
+                *best_move_out = QB_PopLowest(&candidates);
+            }
+            return -(QB_SCORE_WIN - (ply + 2));
+        }
+    } else {
+        if (depth == 0) {
+            return QB_Evaluate(board);
+        }
+        candidates = QB_Empty(board);
+        depth--;
+    }
+
+    uint8_t count = OrderMoves(s, ply, (ply == 0) ? s->pv_move : QB_NO_MOVE, candidates, moves);
+    int32_t best = -QB_SCORE_INF;
+    uint8_t best_move = QB_NO_MOVE;
+
+    for (uint8_t i = 0; i < count; i++) {
+        QB_MakeMove(board, moves[i]);
+        int32_t score = -Negamax(s, depth, (uint8_t)(ply + 1u), -beta, -alpha, NULL);
+        QB_UnmakeMove(board, moves[i]);
+
+        if (s->aborted) {
+            return 0;
+        }
+        if (score > best) {
+            best = score;
+            best_move = moves[i];
+            if (score > alpha) {
+                alpha = score;
+                if (alpha >= beta) {
+                    s->killers[ply] = moves[i];
+                    break;  // Poda
+                }
+            }
+        }
+    }
+
+    if (best_move_out != NULL) {
+        *best_move_out = best_move;
+    }
+    return best;
+}
+
+/**
+ * @brief  Ordena las jugadas candidatas de la más a la menos prometedora
+ * @param  pv_move: Jugada a explorar primero (QB_NO_MOVE si no hay)
+ * @param  candidates: Celdas a ordenar
+ * @retval Cantidad de jugadas
+ */
+static uint8_t OrderMoves(const SearchState_t* s, uint8_t ply, uint8_t pv_move, QB_Mask_t candidates,
+                          uint8_t moves[])
+{
+    const QB_Board_t* board = &s->board;
+    QB_Mask_t own = board->cells[board->side];
+    QB_Mask_t opp = board->cells[board->side ^ 1u];
+    int16_t keys[QB_NUM_CELLS];
+    uint8_t count = 0;
+
+    while (candidates) {
+        uint8_t move = QB_PopLowest(&candidates);
+        int16_t key = 0;
+
+        // Líneas que la jugada refuerza o le corta al rival
+        for (uint8_t i = 0; i < QB_CellLineCount[move]; i++) {
+            QB_Mask_t line = QB_WinMasks[QB_CellLines[move][i]];
+            if ((line & opp) == 0) {
+                uint8_t n = LineCount(line & own);
+                key += line_value[n + 1u > 3u ? 3u : n + 1u];
+                if (n == 2u) {
+                    key += ORDER_THREAT;
+                }
+            } else if ((line & own) == 0) {
+                key += line_value[LineCount(line & opp)];
+            }
+        }
+        if (move == pv_move) {
+            key += ORDER_PV;
+        }
+        if (move == s->killers[ply]) {
+            key += ORDER_KILLER;
+        }
+
+        // Inserción: a lo sumo 64 jugadas
+        uint8_t j = count;
+        while (j > 0 && keys[j - 1] < key) {
+            keys[j] = keys[j - 1];
+            moves[j] = moves[j - 1];
+            j--;
+        }
+        keys[j] = key;
+        moves[j] = move;
+        count++;
+    }
+    return count;
+}
+
+/**
+ * @brief  Puntaje de las líneas abiertas de un jugador
+ * @param  own: Celdas del jugador
+ * @param  opp: Celdas del rival
+ */
+static int32_t EvaluateSide(QB_Mask_t own, QB_Mask_t opp)
+{
+    int32_t score = 0;
+
+    for (uint8_t i = 0; i < QB_NUM_LINES; i++) {
+        QB_Mask_t line = QB_WinMasks[i];
+        if ((line & opp) == 0) {
+            score += line_value[LineCount(line & own)];
+        }
+    }
+    return score;
+}
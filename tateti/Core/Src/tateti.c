@@ -552,7 +552,25 @@ static sc_integer main_region_Playing_react(Tateti* handle, const sc_integer tra
 					exseq_main_region_Playing(handle);
 					enseq_main_region_Idle_default(handle);
 					transitioned_after = 0;
-				} 
+				}  else
+				{
+					if (((handle->iface.key_pressed_raised) == bool_true) && (((tateti_is_undo_key(handle,handle->iface.key_pressed_value) == bool_true) && (tateti_can_undo(handle) == bool_true)) == bool_true))
+					{ 
+						exseq_main_region_Playing(handle);
+						tateti_set_current_player(handle, tateti_undo_move(handle));
+						enseq_main_region_Playing_default(handle);
+						transitioned_after = 0;
+					}  else
+					{
+						if (((handle->iface.key_pressed_raised) == bool_true) && (((tateti_is_redo_key(handle,handle->iface.key_pressed_value) == bool_true) && (tateti_can_redo(handle) == bool_true)) == bool_true))
+						{ 
+							exseq_main_region_Playing(handle);
+							tateti_set_current_player(handle, tateti_redo_move(handle));
+							enseq_main_region_Check_win_default(handle);
+							transitioned_after = 0;
+						} 
+					}
+				}
 			}
 		} 
 		/* If no transition was taken */
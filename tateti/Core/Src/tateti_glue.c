@@ -8,44 +8,68 @@
 
 #include "tateti_required.h"
 #include "game_logic.h"
+#include "ultimate.h"
 #include "display.h"
 #include "game_input.h"
 #include "color_manager.h"
 
-/* Operaciones de tablero/juego */
+/* Operaciones de tablero/juego
+ * En ultimate tateti la posición es la celda dentro del sub-tablero activo
+ * (main.c lo elige antes de enviar la tecla si la jugada es libre) y la
+ * victoria es la línea de sub-tableros ganados. */
 void tateti_init_board(Tateti* handle)
 {
     (void)handle;
     Game_Init();
+    Ultimate_Reset();
 }
 
 void tateti_reset_board(Tateti* handle)
 {
-    (void)handle;
+    // El statechart fija el turno después de esta operación: abre P1 si la
+    // suma de puntajes es par y P2 si es impar (ver Match_end)
+    sc_integer scores = tateti_get_p1_score(handle) + tateti_get_p2_score(handle);
+
     Game_Reset();
+    Ultimate_Reset();
+    Ultimate_SetSide((scores % 2 == 0) ? CELL_PLAYER1 : CELL_PLAYER2);
 }
 
 sc_boolean tateti_is_valid_move(Tateti* handle, const sc_integer position)
 {
-    (void)handle;
+    if (GetGameVariant() == 1) {
+        // El tablero del ultimate lleva su propio turno: fuera de turno no vale
+        return (sc_boolean)Ultimate_IsValidMove((uint8_t)position,
+                                                (CellState_t)tateti_get_current_player(handle));
+    }
     return (sc_boolean)Game_IsValidMove((uint8_t)position);
 }
 
 void tateti_make_move(Tateti* handle, const sc_integer position, const sc_integer player)
 {
     (void)handle;
+    if (GetGameVariant() == 1) {
+        Ultimate_MakeMove((uint8_t)position, (CellState_t)player);
+        return;
+    }
     Game_MakeMove((uint8_t)position, (uint8_t)player);
 }
 
 sc_integer tateti_check_win(Tateti* handle)
 {
     (void)handle;
+    if (GetGameVariant() == 1) {
+        return (sc_integer)Ultimate_CheckWin();
+    }
     return (sc_integer)Game_CheckWin();
 }
 
 sc_boolean tateti_check_draw(Tateti* handle)
 {
     (void)handle;
+    if (GetGameVariant() == 1) {
+        return (sc_boolean)Ultimate_CheckDraw();
+    }
     return (sc_boolean)Game_CheckDraw();
 }
 
@@ -59,6 +83,10 @@ void tateti_update_display(Tateti* handle, const sc_integer p1, const sc_integer
 void tateti_show_match_win(Tateti* handle, const sc_integer win_type, const sc_integer winner)
 {
     (void)handle;
+    if (GetGameVariant() == 1) {
+        // La línea ganadora es de sub-tableros: mostrar el tablero grande
+        Display_ShowUltimateOverview(UT_ANY_BOARD);
+    }
     Display_MatchWinAnimation((WinType_t)win_type, (CellState_t)winner);
 }
 
@@ -118,3 +146,69 @@ sc_integer tateti_key_to_position(Tateti* handle, const sc_integer key)
     (void)handle;
     return (sc_integer)GameInput_KeyToPosition((uint8_t)key);
 }
+
+/* Operaciones de historial
+ * Contra la IA se deshace hasta la última jugada de P1 (y se rehace hasta
+ * la respuesta de la IA) para que siempre le vuelva a tocar al humano; si
+ * el historial no tiene ninguna jugada de P1 (abrió la IA) no se deshace
+ * nada. Ultimate todavía no guarda historial. */
+sc_boolean tateti_is_undo_key(Tateti* handle, const sc_integer key)
+{
+    (void)handle;
+    return (sc_boolean)GameInput_IsUndoAction((uint8_t)key);
+}
+
+sc_boolean tateti_is_redo_key(Tateti* handle, const sc_integer key)
+{
+    (void)handle;
+    return (sc_boolean)GameInput_IsRedoAction((uint8_t)key);
+}
+
+sc_boolean tateti_can_undo(Tateti* handle)
+{
+    (void)handle;
+    return (sc_boolean)(GetGameVariant() == 0 && Game_CanUndo());
+}
+
+sc_boolean tateti_can_redo(Tateti* handle)
+{
+    (void)handle;
+    return (sc_boolean)(GetGameVariant() == 0 && Game_CanRedo());
+}
+
+sc_integer tateti_undo_move(Tateti* handle)
+{
+    GameMove_t move;
+    sc_integer player = tateti_get_current_player(handle);
+    uint8_t undone = 0;
+
+    // Devuelve el jugador de la última jugada deshecha: es a quien le toca
+    while (Game_UndoMove(&move)) {
+        undone++;
+        if (GetGameMode() == 0 || move.player == CELL_PLAYER1) {
+            return (sc_integer)move.player;
+        }
+    }
+
+    // Solo había jugadas de la IA: se rehacen y el turno no cambia
+    while (undone-- > 0) {
+        (void)Game_RedoMove(&move);
+    }
+    return player;
+}
+
+sc_integer tateti_redo_move(Tateti* handle)
+{
+    GameMove_t move;
+    sc_integer player = tateti_get_current_player(handle);
+
+    // Devuelve el jugador de la última jugada rehecha: Check_win cambia el turno
+    while (Game_RedoMove(&move)) {
+        player = (sc_integer)move.player;
+        if (GetGameMode() == 0 || move.player == CELL_PLAYER2 ||
+            Game_CheckWin() != WIN_NONE || Game_CheckDraw()) {
+            break;
+        }
+    }
+    return player;
+}
@@ -0,0 +1,298 @@
+/**
+ ******************************************************************************
+ * @file    ultimate.c
+ * @brief   Implementación de las reglas del ultimate tateti
+ ******************************************************************************
+ */
+
+#include "ultimate.h"
+
+/* Partida por defecto (statechart) */
+static UT_Board_t default_board;
+static uint8_t selected_board = UT_ANY_BOARD;  // Elección del jugador si la jugada es libre
+
+/* Prototipos funciones privadas */
+static bool CompletesLine(uint16_t mask, uint8_t cell);
+
+/*============================================================================*/
+/* Funciones sobre un tablero explícito                                       */
+/*============================================================================*/
+
+/**
+ * @brief  Vacía el tablero (mueve P1, sub-tablero libre)
+ * @param  board: Tablero a inicializar
+ * @retval None
+ */
+void UT_Reset(UT_Board_t* board)
+{
+    for (uint8_t i = 0; i < UT_NUM_BOARDS; i++) {
+        board->cells[0][i] = 0;
+        board->cells[1][i] = 0;
+    }
+    board->won[0] = 0;
+    board->won[1] = 0;
+    board->closed = 0;
+    board->next_board = UT_ANY_BOARD;
+    board->side = 0;
+    board->move_count = 0;
+    board->result = UT_RESULT_NONE;
+}
+
+/**
+ * @brief  Verifica si una jugada es legal
+ * @param  move: Sub-tablero * 9 + celda
+ * @retval true si el sub-tablero está habilitado y la celda vacía
+ */
+bool UT_IsLegal(const UT_Board_t* board, uint8_t move)
+{
+    if (move >= UT_NUM_CELLS) {
+        return false;
+    }
+
+    uint8_t sub = move / BB_NUM_CELLS;
+    uint8_t cell = move % BB_NUM_CELLS;
+    return (UT_PlayableBoards(board) & (1u << sub)) != 0 &&
+           (UT_EmptyCells(board, sub) & (1u << cell)) != 0;
+}
+
+/**
+ * @brief  Lista las jugadas legales
+ * @param  moves: Arreglo de salida (sub-tablero * 9 + celda)
+ * @retval Cantidad de jugadas
+ */
+uint8_t UT_GenerateMoves(const UT_Board_t* board, uint8_t moves[UT_NUM_CELLS])
+{
+    uint16_t boards = UT_PlayableBoards(board);
+    uint8_t count = 0;
+
+    while (boards) {
+        uint8_t sub = Bitboard_PopLowest(&boards);
+        uint16_t empty = UT_EmptyCells(board, sub);
+        while (empty) {
+            moves[count++] = (uint8_t)(sub * BB_NUM_CELLS + Bitboard_PopLowest(&empty));
+        }
+    }
+    return count;
+}
+
+/**
+ * @brief  Aplica una jugada legal y actualiza sub-tableros y resultado
+ * @param  move: Sub-tablero * 9 + celda (debe ser legal)
+ * @param  undo: Datos para UT_UnmakeMove
+ * @retval None
+ */
+void UT_MakeMove(UT_Board_t* board, uint8_t move, UT_Undo_t* undo)
+{
+    uint8_t side = board->side;
+    uint8_t sub = move / BB_NUM_CELLS;
+    uint8_t cell = move % BB_NUM_CELLS;
+    uint16_t sub_bit = (uint16_t)(1u << sub);
+
+    undo->move = move;
+    undo->next_board = board->next_board;
+    undo->result = board->result;
+    undo->closed = board->closed;
+    undo->won = board->won[side];
+
+    uint16_t own = (uint16_t)(board->cells[side][sub] | (1u << cell));
+    board->cells[side][sub] = own;
+
+    // Solo la jugada recién hecha puede cerrar el sub-tablero o la partida
+    if (CompletesLine(own, cell)) {
+        board->won[side] |= sub_bit;
+        board->closed |= sub_bit;
+        if (CompletesLine(board->won[side], sub)) {
+            board->result = (side == 0) ? UT_RESULT_P1 : UT_RESULT_P2;
+        }
+    } else if ((own | board->cells[side ^ 1u][sub]) == BB_FULL_MASK) {
+        board->closed |= sub_bit;
+    }
+    if (board->result == UT_RESULT_NONE && board->closed == BB_FULL_MASK) {
+        board->result = UT_RESULT_DRAW;
+    }
+
+    board->next_board = (board->closed & (1u << cell)) ? UT_ANY_BOARD : cell;
+    board->side = side ^ 1u;
+    board->move_count++;
+}
+
+/**
+ * @brief  Deshace la última jugada aplicada con UT_MakeMove
+ * @param  undo: Datos devueltos por UT_MakeMove
+ * @retval None
+ */
+void UT_UnmakeMove(UT_Board_t* board, const UT_Undo_t* undo)
+{
+    uint8_t side = board->side ^ 1u;
+    uint8_t sub = undo->move / BB_NUM_CELLS;
+    uint8_t cell = undo->move % BB_NUM_CELLS;
+
+    board->cells[side][sub] &= (uint16_t)~(1u << cell);
+    board->won[side] = undo->won;
+    board->closed = undo->closed;
+    board->result = undo->result;
+    board->next_board = undo->next_board;
+    board->side = side;
+    board->move_count--;
+}
+
+/**
+ * @brief  Cuenta las hojas del árbol de jugadas a una profundidad fija
+ * @note   Sirve para verificar y medir UT_MakeMove/UT_UnmakeMove
+ * @param  board: Posición de partida (se restaura al terminar)
+ * @param  depth: Jugadas a recorrer
+ * @retval Cantidad de posiciones alcanzadas
+ */
+uint64_t UT_Perft(UT_Board_t* board, uint8_t depth)
+{
+    uint8_t moves[UT_NUM_CELLS];
+    uint8_t count;
+    uint64_t total = 0;
+
+    if (depth == 0) {
+        return 1;
+    }
+
+    count = UT_GenerateMoves(board, moves);
+    if (depth == 1) {
+        return count;
+    }
+    for (uint8_t i = 0; i < count; i++) {
+        UT_Undo_t undo;
+        UT_MakeMove(board, moves[i], &undo);
+        total += UT_Perft(board, (uint8_t)(depth - 1u));
+        UT_UnmakeMove(board, &undo);
+    }
+    return total;
+}
+
+/*============================================================================*/
+/* Funciones sobre la partida por defecto                                     */
+/*============================================================================*/
+
+/**
+ * @brief  Empieza una partida nueva
+ */
+void Ultimate_Reset(void)
+{
+    UT_Reset(&default_board);
+    selected_board = UT_ANY_BOARD;
+}
+
+/**
+ * @brief  Elige quién abre la partida
+ * @note   Solo tiene efecto antes de la primera jugada (el statechart alterna
+ *         quién empieza cada partida del match)
+ * @param  player: Jugador que mueve primero (CELL_PLAYER1 o CELL_PLAYER2)
+ */
+void Ultimate_SetSide(CellState_t player)
+{
+    if (default_board.move_count == 0 && (player == CELL_PLAYER1 || player == CELL_PLAYER2)) {
+        default_board.side = (uint8_t)(player - 1);
+    }
+}
+
+/**
+ * @brief  Tablero de la partida por defecto (solo lectura)
+ */
+const UT_Board_t* Ultimate_GetBoard(void)
+{
+    return &default_board;
+}
+
+/**
+ * @brief  Elige el sub-tablero cuando la jugada es libre
+ * @param  sub_board: Sub-tablero (0-8)
+ * @retval true si se puede jugar en él
+ */
+bool Ultimate_SelectBoard(uint8_t sub_board)
+{
+    if (sub_board >= UT_NUM_BOARDS || default_board.next_board != UT_ANY_BOARD ||
+        (UT_PlayableBoards(&default_board) & (1u << sub_board)) == 0) {
+        return false;
+    }
+    selected_board = sub_board;
+    return true;
+}
+
+/**
+ * @brief  Sub-tablero donde se juega la próxima jugada
+ * @retval El obligado, el elegido con Ultimate_SelectBoard o UT_ANY_BOARD
+ */
+uint8_t Ultimate_GetActiveBoard(void)
+{
+    if (default_board.next_board != UT_ANY_BOARD) {
+        return default_board.next_board;
+    }
+    return selected_board;
+}
+
+/**
+ * @brief  Verifica una jugada dentro del sub-tablero activo
+ * @param  position: Celda del sub-tablero (0-8)
+ * @param  player: Jugador que mueve (false si no es su turno)
+ */
+bool Ultimate_IsValidMove(uint8_t position, CellState_t player)
+{
+    uint8_t sub = Ultimate_GetActiveBoard();
+
+    if (sub == UT_ANY_BOARD || position >= BB_NUM_CELLS || (uint8_t)(player - 1) != default_board.side) {
+        return false;
+    }
+    return UT_IsLegal(&default_board, (uint8_t)(sub * BB_NUM_CELLS + position));
+}
+
+/**
+ * @brief  Juega en el sub-tablero activo
+ * @param  position: Celda del sub-tablero (0-8)
+ * @param  player: Jugador que mueve (debe coincidir con el turno)
+ */
+void Ultimate_MakeMove(uint8_t position, CellState_t player)
+{
+    UT_Undo_t undo;
+
+    if (!Ultimate_IsValidMove(position, player)) {
+        return;
+    }
+    UT_MakeMove(&default_board, (uint8_t)(Ultimate_GetActiveBoard() * BB_NUM_CELLS + position), &undo);
+    selected_board = UT_ANY_BOARD;
+}
+
+/**
+ * @brief  Línea de sub-tableros ganada
+ * @retval WIN_NONE o la línea del tablero grande (mismo orden que WinType_t)
+ */
+WinType_t Ultimate_CheckWin(void)
+{
+    if (default_board.result == UT_RESULT_P1) {
+        return (WinType_t)Bitboard_WinLine(default_board.won[0]);
+    }
+    if (default_board.result == UT_RESULT_P2) {
+        return (WinType_t)Bitboard_WinLine(default_board.won[1]);
+    }
+    return WIN_NONE;
+}
+
+/**
+ * @brief  Verifica si la partida terminó empatada
+ */
+bool Ultimate_CheckDraw(void)
+{
+    return default_board.result == UT_RESULT_DRAW;
+}
+
+/**
+ * @brief  Indica si la celda recién ocupada completa una línea
+ * @param  mask: Celdas del jugador, incluida la nueva
+ * @param  cell: Celda recién ocupada
+ */
+static bool CompletesLine(uint16_t mask, uint8_t cell)
+{
+    for (uint8_t i = 0; i < BB_NUM_LINES; i++) {
+        uint16_t line = BB_WinMasks[i];
+        if ((line & (1u << cell)) && (mask & line) == line) {
+            return true;
+        }
+    }
+    return false;
+}
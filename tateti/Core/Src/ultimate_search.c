@@ -0,0 +1,359 @@
+/**
+ ******************************************************************************
+ * @file    ultimate_search.c
+ * @brief   Implementación de la búsqueda alfa-beta del ultimate tateti
+ ******************************************************************************
+ */
+
+#include "ultimate_search.h"
+#include <stddef.h>
+
+/* Peso de cada posición (centro > esquinas > lados), para celdas y sub-tableros */
+static const int8_t position_weight[BB_NUM_CELLS] = {3, 2, 3, 2, 4, 2, 3, 2, 3};
+
+/* Valor de una línea abierta según cuántas marcas propias tiene (0-2) */
+static const int16_t macro_line_value[3] = {0, 40, 300};
+static const int8_t sub_line_value[3] = {0, 1, 6};
+
+/* Puntajes de orden de jugadas */
+#define ORDER_PV        10000
+#define ORDER_WIN       5000
+#define ORDER_BLOCK     2000
+#define ORDER_KILLER    1000
+#define ORDER_FREE      (-500)  // Le da al rival la elección de sub-tablero
+
+/* Búsqueda de UTSearch_BestMove (pesa unos 4 KB: no va en la pila) */
+static UTSearch_t blocking_search;
+
+/* Prototipos funciones privadas */
+static void StartIteration(UTSearch_t* s);
+static bool EnterNode(UTSearch_t* s, uint8_t ply, uint8_t depth, int32_t alpha, int32_t beta,
+                      int32_t* value_out);
+static void ApplyScore(UTSearch_t* s, int32_t score, uint8_t move);
+static uint8_t OrderMoves(const UTSearch_t* s, uint8_t ply, uint8_t pv_move, uint8_t moves[]);
+static uint16_t ThreatCells(uint16_t own, uint16_t empty);
+static int32_t EvaluateSide(const UT_Board_t* board, uint8_t p);
+
+/**
+ * @brief  Prepara una búsqueda incremental
+ * @note   s->result.best_move contiene siempre una jugada legal (la primera
+ *         según el orden estático hasta que se completa la profundidad 1).
+ *         Sin jugadas legales la búsqueda queda terminada con UT_NO_MOVE.
+ * @param  s: Estado de la búsqueda (provisto por el llamador)
+ * @param  board: Posición a analizar (se copia)
+ * @param  max_depth: Profundidad máxima (hasta UT_SEARCH_MAX_DEPTH; 0 = 1)
+ */
+void UTSearch_Begin(UTSearch_t* s, const UT_Board_t* board, uint8_t max_depth)
+{
+    uint8_t moves[UT_NUM_CELLS];
+
+    s->board = *board;
+    s->nodes = 0;
+    s->done = false;
+    s->pv_move = UT_NO_MOVE;
+    for (uint8_t i = 0; i <= UT_SEARCH_MAX_DEPTH; i++) {
+        s->killers[i] = UT_NO_MOVE;
+    }
+    s->result.best_move = UT_NO_MOVE;
+    s->result.score = 0;
+    s->result.depth = 0;
+    s->result.nodes = 0;
+    s->result.timed_out = false;
+
+    if (board->result != UT_RESULT_NONE || UT_GenerateMoves(board, moves) == 0) {
+        s->done = true;
+        return;
+    }
+    if (max_depth > UT_SEARCH_MAX_DEPTH) {
+        max_depth = UT_SEARCH_MAX_DEPTH;
+    }
+    s->max_depth = (max_depth == 0) ? 1u : max_depth;
+
+    // Mejor jugada provisoria: la primera según el orden estático
+    OrderMoves(s, 0, UT_NO_MOVE, moves);
+    s->result.best_move = moves[0];
+
+    s->iter_depth = 1;
+    StartIteration(s);
+}
+
+/**
+ * @brief  Avanza la búsqueda incremental
+ * @param  s: Estado de la búsqueda
+ * @param  max_nodes: Nodos a visitar como máximo en esta llamada
+ * @retval true si la búsqueda terminó (s->result es definitivo)
+ */
+bool UTSearch_Step(UTSearch_t* s, uint32_t max_nodes)
+{
+    uint32_t stop = s->nodes + max_nodes;
+
+    while (!s->done && s->nodes < stop) {
+        UTSearch_Frame_t* f = &s->stack[s->sp];
+
+        if (f->index < f->count) {
+            // Bajar por la próxima jugada del nodo actual
+            uint8_t move = f->moves[f->index++];
+            int32_t value;
+
+            UT_MakeMove(&s->board, move, &f->undo);
+            if (EnterNode(s, (uint8_t)(s->sp + 1u), (uint8_t)(f->depth - 1u), -f->beta, -f->alpha,
+                          &value)) {
+                UT_UnmakeMove(&s->board, &f->undo);
+                ApplyScore(s, -value, move);
+            }
+            continue;
+        }
+
+        if (s->sp == 0) {
+            // Iteración completa en la raíz
+            s->result.best_move = f->best_move;
+            s->result.score = f->best;
+            s->result.depth = s->iter_depth;
+            s->pv_move = f->best_move;
+
+            // Resultado forzado o sin más jugadas: profundizar no cambia nada
+            if (s->iter_depth >= s->max_depth ||
+                f->best >= UT_SEARCH_SCORE_WIN - UT_SEARCH_MAX_DEPTH ||
+                f->best <= -(UT_SEARCH_SCORE_WIN - UT_SEARCH_MAX_DEPTH) ||
+                s->iter_depth >= UT_NUM_CELLS - s->board.move_count) {
+                s->done = true;
+            } else {
+                s->iter_depth++;
+                StartIteration(s);
+            }
+            continue;
+        }
+
+        // Nodo interno terminado: devolver el puntaje al padre
+        int32_t value = f->best;
+        s->sp--;
+        UTSearch_Frame_t* parent = &s->stack[s->sp];
+        UT_UnmakeMove(&s->board, &parent->undo);
+        ApplyScore(s, -value, parent->moves[parent->index - 1u]);
+    }
+
+    s->result.nodes = s->nodes;
+    return s->done;
+}
+
+/**
+ * @brief  Busca la mejor jugada con profundización iterativa y plazo
+ * @note   Bloqueante: para la placa usar UTSearch_Begin/UTSearch_Step
+ * @param  board: Posición a analizar (no se modifica)
+ * @param  max_depth: Profundidad máxima (hasta UT_SEARCH_MAX_DEPTH)
+ * @param  clock: Reloj para el plazo (NULL = sin plazo)
+ * @param  budget: Plazo en ticks de clock desde la llamada
+ * @param  result: Resultado de la última profundidad completa
+ * @retval None
+ */
+void UTSearch_BestMove(const UT_Board_t* board, uint8_t max_depth, UTSearch_Clock_t clock,
+                       uint32_t budget, UTSearch_Result_t* result)
+{
+    uint32_t start = (clock != NULL) ? clock() : 0;
+
+    UTSearch_Begin(&blocking_search, board, max_depth);
+    while (!UTSearch_Step(&blocking_search, UT_SEARCH_CHECK_NODES)) {
+        if (clock != NULL && blocking_search.result.depth > 0 && (clock() - start) >= budget) {
+            blocking_search.result.timed_out = true;
+            break;
+        }
+    }
+    *result = blocking_search.result;
+}
+
+/**
+ * @brief  Evaluación estática desde el punto de vista del jugador que mueve
+ */
+int32_t UTSearch_Evaluate(const UT_Board_t* board)
+{
+    return EvaluateSide(board, board->side) - EvaluateSide(board, (uint8_t)(board->side ^ 1u));
+}
+
+/**
+ * @brief  Empieza una iteración de profundidad s->iter_depth desde la raíz
+ */
+static void StartIteration(UTSearch_t* s)
+{
+    int32_t value;
+
+    (void)EnterNode(s, 0, s->iter_depth, -UT_SEARCH_SCORE_INF, UT_SEARCH_SCORE_INF, &value);
+}
+
+/**
+ * @brief  Entra a un nodo: lo resuelve si es hoja o apila su marco
+ * @param  ply: Jugadas desde la raíz (posición del marco en la pila)
+ * @param  value_out: Puntaje de la hoja para el jugador que mueve
+ * @retval true si el nodo es una hoja (value_out válido), false si se apiló
+ */
+static bool EnterNode(UTSearch_t* s, uint8_t ply, uint8_t depth, int32_t alpha, int32_t beta,
+                      int32_t* value_out)
+{
+    const UT_Board_t* board = &s->board;
+
+    s->nodes++;
+
+    // Solo puede haber ganado el que acaba de mover
+    if (board->result == UT_RESULT_DRAW) {
+        *value_out = 0;
+        return true;
+    }
+    if (board->result != UT_RESULT_NONE) {
+        *value_out = -(UT_SEARCH_SCORE_WIN - ply);
+        return true;
+    }
+    if (depth == 0) {
+        *value_out = UTSearch_Evaluate(board);
+        return true;
+    }
+
+    UTSearch_Frame_t* f = &s->stack[ply];
+    f->count = OrderMoves(s, ply, (ply == 0) ? s->pv_move : UT_NO_MOVE, f->moves);
+    f->index = 0;
+    f->depth = depth;
+    f->best_move = f->moves[0];
+    f->alpha = alpha;
+    f->beta = beta;
+    f->best = -UT_SEARCH_SCORE_INF;
+    s->sp = ply;
+    return false;
+}
+
+/**
+ * @brief  Incorpora el puntaje de una jugada al nodo actual (s->stack[s->sp])
+ */
+static void ApplyScore(UTSearch_t* s, int32_t score, uint8_t move)
+{
+    UTSearch_Frame_t* f = &s->stack[s->sp];
+
+    if (score > f->best) {
+        f->best = score;
+        f->best_move = move;
+        if (score > f->alpha) {
+            f->alpha = score;
+            if (f->alpha >= f->beta) {
+                s->killers[s->sp] = move;
+                f->index = f->count;    // Poda
+            }
+        }
+    }
+}
+
+/**
+ * @brief  Genera las jugadas legales ordenadas de la más a la menos prometedora
+ * @param  pv_move: Jugada a explorar primero (UT_NO_MOVE si no hay)
+ * @retval Cantidad de jugadas
+ */
+static uint8_t OrderMoves(const UTSearch_t* s, uint8_t ply, uint8_t pv_move, uint8_t moves[])
+{
+    const UT_Board_t* board = &s->board;
+    uint8_t side = board->side;
+    int16_t keys[UT_NUM_CELLS];
+    uint8_t count = UT_GenerateMoves(board, moves);
+    uint16_t boards = UT_PlayableBoards(board);
+
+    // Celdas que ganan o bloquean cada sub-tablero habilitado
+    uint16_t wins[UT_NUM_BOARDS] = {0};
+    uint16_t blocks[UT_NUM_BOARDS] = {0};
+    while (boards) {
+        uint8_t sub = Bitboard_PopLowest(&boards);
+        uint16_t empty = UT_EmptyCells(board, sub);
+        wins[sub] = ThreatCells(board->cells[side][sub], empty);
+        blocks[sub] = ThreatCells(board->cells[side ^ 1u][sub], empty);
+    }
+
+    for (uint8_t i = 0; i < count; i++) {
+        uint8_t sub = moves[i] / BB_NUM_CELLS;
+        uint8_t cell = moves[i] % BB_NUM_CELLS;
+        uint16_t bit = (uint16_t)(1u << cell);
+        int16_t key = (int16_t)(position_weight[cell] + position_weight[sub]);
+
+        if (moves[i] == pv_move) {
+            key += ORDER_PV;
+        }
+        if (wins[sub] & bit) {
+            key += ORDER_WIN;
+        } else if (blocks[sub] & bit) {
+            key += ORDER_BLOCK;
+        }
+        if (moves[i] == s->killers[ply]) {
+            key += ORDER_KILLER;
+        }
+        // Mandar al rival a un sub-tablero cerrado le da jugada libre
+        if ((board->closed & (1u << cell)) || (cell == sub && (wins[sub] & bit))) {
+            key += ORDER_FREE;
+        }
+
+        // Inserción: pocas jugadas y casi ordenadas por la generación
+        uint8_t move = moves[i];
+        uint8_t j = i;
+        while (j > 0 && keys[j - 1] < key) {
+            keys[j] = keys[j - 1];
+            moves[j] = moves[j - 1];
+            j--;
+        }
+        keys[j] = key;
+        moves[j] = move;
+    }
+    return count;
+}
+
+/**
+ * @brief  Calcula las celdas vacías que completan una línea del jugador
+ * @param  own: Celdas del jugador
+ * @param  empty: Celdas vacías
+ * @retval Máscara de celdas ganadoras
+ */
+static uint16_t ThreatCells(uint16_t own, uint16_t empty)
+{
+    uint16_t threats = 0;
+
+    for (uint8_t i = 0; i < BB_NUM_LINES; i++) {
+        uint16_t line = BB_WinMasks[i];
+        if (Bitboard_Count((uint16_t)(own & line)) == 2) {
+            threats |= (uint16_t)(line & empty);
+        }
+    }
+    return threats;
+}
+
+/**
+ * @brief  Puntaje de las líneas abiertas de un jugador
+ * @param  p: Jugador (0 = P1, 1 = P2)
+ */
+static int32_t EvaluateSide(const UT_Board_t* board, uint8_t p)
+{
+    uint8_t q = (uint8_t)(p ^ 1u);
+    uint16_t drawn = (uint16_t)(board->closed & ~(board->won[0] | board->won[1]));
+    uint16_t macro_blocked = (uint16_t)(board->won[q] | drawn);
+    int32_t score = 0;
+
+    // Tablero grande: líneas de sub-tableros que todavía puede completar
+    for (uint8_t i = 0; i < BB_NUM_LINES; i++) {
+        uint16_t line = BB_WinMasks[i];
+        if ((line & macro_blocked) == 0) {
+            score += macro_line_value[Bitboard_Count((uint16_t)(board->won[p] & line))];
+        }
+    }
+
+    // Sub-tableros ganados y líneas abiertas dentro de los que siguen en juego
+    uint16_t open = (uint16_t)(~board->closed & BB_FULL_MASK);
+    uint16_t won = board->won[p];
+    while (won) {
+        score += 8 * position_weight[Bitboard_PopLowest(&won)];
+    }
+    while (open) {
+        uint8_t sub = Bitboard_PopLowest(&open);
+        uint16_t own = board->cells[p][sub];
+        uint16_t opp = board->cells[q][sub];
+        int32_t local = 0;
+
+        for (uint8_t i = 0; i < BB_NUM_LINES; i++) {
+            uint16_t line = BB_WinMasks[i];
+            if ((line & opp) == 0) {
+                local += sub_line_value[Bitboard_Count((uint16_t)(own & line))];
+            }
+        }
+        score += local * position_weight[sub];
+    }
+    return score;
+}
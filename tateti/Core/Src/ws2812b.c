@@ -8,18 +8,74 @@
 
 /* Includes ------------------------------------------------------------------*/
 #include "ws2812b.h"
+#include "ws2812b_color.h"
 #include <string.h>
 
 /* Private variables ---------------------------------------------------------*/
-// Matriz para almacenar datos RGB de cada LED [LED][G, R, B]
+// Colores pedidos (perceptuales) y los que van al PWM tras el pipeline [LED][G, R, B]
+static uint8_t LED_Input[WS2812B_NUM_LEDS][3];
 static uint8_t LED_RGB_Color[WS2812B_NUM_LEDS][3];
 
-// Tamaño del buffer PWM: 1 inicial + (24 bits × 16 LEDs) + 41 final para reset >50us
-#define PWM_BUFFER_SIZE (1 + (24 * WS2812B_NUM_LEDS) + 41)
-static uint16_t PWM_Buffer[PWM_BUFFER_SIZE];
+// Pipeline de color (ws2812b_color.h): la escala se calcula al primer uso
+static WS2812B_ColorScale_t color_scale;
+static bool color_scale_ready = false;
+static uint8_t brightness = WS2812B_DEFAULT_BRIGHTNESS;
+static uint8_t white_balance[3] = {255, 255, 255};   // R, G, B
+#if WS2812B_DITHER
+static uint8_t LED_Residual[WS2812B_NUM_LEDS][3];    // Resto 8.8 de la trama anterior
+#endif
+
+// Períodos en cero al final de la trama para el reset (>50us); par para que
+// cada buffer y cada LED queden alineados a 4 bytes
+#define WS2812B_RESET_SLOTS 42
+
+#if WS2812B_STREAMING
+// Anillo circular: dos mitades de WS2812B_RING_HALF_LEDS LEDs cada una
+#define RING_HALF_SIZE      (24 * WS2812B_RING_HALF_LEDS)
+#define RING_SIZE           (2 * RING_HALF_SIZE)
+#define RING_RESET_HALVES   ((WS2812B_RESET_SLOTS + RING_HALF_SIZE - 1) / RING_HALF_SIZE)
+
+static uint16_t PWM_Ring[RING_SIZE] __ALIGNED(4);
+static volatile uint16_t ring_next = 0;      // Próximo LED a codificar
+static volatile uint16_t ring_len = 0;       // LEDs de la trama que está saliendo
+static volatile uint8_t ring_tail = 0;       // 0 = quedan LEDs; luego cuenta recargas hasta el reset
+static uint32_t isr_cycles_total = 0;        // Suma de ciclos por LED de las recargas
+static uint32_t isr_refills = 0;
+#else
+// Tamaño del buffer PWM: 2 iniciales + (24 bits × 16 LEDs) + 42 final para reset >50us
+#define PWM_LEAD_SLOTS  2
+#define PWM_BUFFER_SIZE (PWM_LEAD_SLOTS + (24 * WS2812B_NUM_LEDS) + WS2812B_RESET_SLOTS)
+
+// Doble buffer: el DMA envía PWM_Buffer[front] mientras se codifica el otro
+static uint16_t PWM_Buffer[2][PWM_BUFFER_SIZE] __ALIGNED(4);
+static volatile uint8_t front = 0;
+
+// LEDs que cambiaron desde la última codificación de cada buffer
+static uint32_t LED_Dirty[2][WS2812B_DIRTY_WORDS(WS2812B_NUM_LEDS)];
+static bool buffer_valid[2] = {false, false};
+#endif
+static volatile bool dma_busy = false;       // Hay una trama saliendo por DMA
+static volatile bool frame_pending = false;  // Hay una trama más nueva esperando al DMA
+static volatile WS2812B_Stats_t stats;
+
+// Las tramas llegan hasta el último LED que cambió: los LEDs de la cadena
+// que siguen conservan su color sin recibir la cola
+static uint16_t dirty_end = WS2812B_NUM_LEDS;    // Cambiaron LEDs en [0, dirty_end) desde la última trama
+static volatile uint16_t pending_len = 0;        // LEDs de la trama pendiente
+static volatile uint16_t lost_len = 0;           // LEDs de una trama que el HAL no pudo arrancar
 
 /* Private function prototypes -----------------------------------------------*/
-static void WS2812B_PrepareBuffer(void);
+#if WS2812B_STREAMING
+static void WS2812B_StartRing(uint16_t len);
+static bool WS2812B_RingRefill(uint16_t* half);
+static void WS2812B_RingEvent(uint8_t half);
+#else
+static void WS2812B_PrepareBuffer(uint8_t index, uint16_t len);
+static void WS2812B_StartBack(uint16_t len);
+#endif
+static uint16_t WS2812B_TakeLength(void);
+static void WS2812B_Output(uint16_t led);
+static void WS2812B_OutputAll(void);
 
 /* Function implementations --------------------------------------------------*/
 
@@ -30,22 +86,31 @@ static void WS2812B_PrepareBuffer(void);
  * @param g: Componente verde (0-255)
  * @param b: Componente azul (0-255)
  */
-void WS2812B_SetPixel(uint8_t led, uint8_t r, uint8_t g, uint8_t b)
+void WS2812B_SetPixel(uint16_t led, uint8_t r, uint8_t g, uint8_t b)
 {
     if (led >= WS2812B_NUM_LEDS) {
         return;
     }
     
+    if (LED_Input[led][0] == g && LED_Input[led][1] == r && LED_Input[led][2] == b) {
+        return;
+    }
+
     // WS2812B usa orden GRB
-    LED_RGB_Color[led][0] = g;  // Verde
-    LED_RGB_Color[led][1] = r;  // Rojo
-    LED_RGB_Color[led][2] = b;  // Azul
+    LED_Input[led][0] = g;  // Verde
+    LED_Input[led][1] = r;  // Rojo
+    LED_Input[led][2] = b;  // Azul
+
+#if !WS2812B_DITHER
+    // Con dithering WS2812B_Update recalcula todos los LEDs en cada trama
+    WS2812B_Output(led);
+#endif
 }
 
 /**
  * @brief Establece el color usando estructura
  */
-void WS2812B_SetPixelColor(uint8_t led, WS2812B_Color_t color)
+void WS2812B_SetPixelColor(uint16_t led, WS2812B_Color_t color)
 {
     WS2812B_SetPixel(led, color.r, color.g, color.b);
 }
@@ -55,51 +120,444 @@ void WS2812B_SetPixelColor(uint8_t led, WS2812B_Color_t color)
  */
 void WS2812B_Clear(void)
 {
-    memset(LED_RGB_Color, 0, sizeof(LED_RGB_Color));
+    for (uint16_t led = 0; led < WS2812B_NUM_LEDS; led++) {
+        WS2812B_SetPixel(led, 0, 0, 0);
+    }
 }
 
 /**
- * @brief Prepara el buffer PWM a partir de los colores RGB
+ * @brief Establece el brillo global
+ * @param value: Brillo perceptual (0-255, 255 = colores sin atenuar)
+ * @note  Se ve en el próximo WS2812B_Update
  */
-static void WS2812B_PrepareBuffer(void)
+void WS2812B_SetBrightness(uint8_t value)
 {
-    uint32_t buffer_idx = 1;  // Empezamos en 1, el [0] será 0
-    
-    // Para cada LED
-    for (uint16_t led = 0; led < WS2812B_NUM_LEDS; led++)
-    {
-        // Combinar GRB en un uint32_t
-        uint32_t color = ((uint32_t)LED_RGB_Color[led][0] << 16) |  // Verde
-                        ((uint32_t)LED_RGB_Color[led][1] << 8) |    // Rojo
-                        LED_RGB_Color[led][2];                       // Azul
-
-        // Para cada bit (del más significativo al menos)
-        for (int8_t bit = 23; bit >= 0; bit--)
-        {
-            if (color & ((uint32_t)1 << bit)) {
-                PWM_Buffer[buffer_idx] = WS2812B_PWM_BIT1;  // Bit '1'
-            } else {
-                PWM_Buffer[buffer_idx] = WS2812B_PWM_BIT0;  // Bit '0'
-            }
-            buffer_idx++;
+    brightness = value;
+    color_scale_ready = false;
+    WS2812B_OutputAll();
+}
+
+/**
+ * @brief Devuelve el brillo global
+ */
+uint8_t WS2812B_GetBrightness(void)
+{
+    return brightness;
+}
+
+/**
+ * @brief Establece el balance de blancos (ganancia lineal de cada canal)
+ * @param r: Ganancia del rojo (255 = sin corregir)
+ * @param g: Ganancia del verde
+ * @param b: Ganancia del azul
+ * @note  Se ve en el próximo WS2812B_Update
+ */
+void WS2812B_SetWhiteBalance(uint8_t r, uint8_t g, uint8_t b)
+{
+    white_balance[0] = r;
+    white_balance[1] = g;
+    white_balance[2] = b;
+    color_scale_ready = false;
+    WS2812B_OutputAll();
+}
+
+/**
+ * @brief Copia los contadores de tramas
+ */
+void WS2812B_GetStats(WS2812B_Stats_t* out)
+{
+    uint32_t primask = __get_PRIMASK();
+
+    __disable_irq();
+    out->completed = stats.completed;
+    out->coalesced = stats.coalesced;
+    out->dropped = stats.dropped;
+    out->skipped = stats.skipped;
+    out->leds_sent = stats.leds_sent;
+    out->underruns = stats.underruns;
+    out->isr_cycles_max = stats.isr_cycles_max;
+#if WS2812B_STREAMING
+    out->isr_cycles_avg = (isr_refills != 0) ? (isr_cycles_total / isr_refills) : 0;
+#else
+    out->isr_cycles_avg = 0;
+#endif
+    __set_PRIMASK(primask);
+}
+
+/**
+ * @brief Pone a cero los contadores de tramas
+ */
+void WS2812B_ResetStats(void)
+{
+    uint32_t primask = __get_PRIMASK();
+
+    __disable_irq();
+    stats.completed = 0;
+    stats.coalesced = 0;
+    stats.dropped = 0;
+    stats.skipped = 0;
+    stats.leds_sent = 0;
+    stats.underruns = 0;
+    stats.isr_cycles_max = 0;
+#if WS2812B_STREAMING
+    isr_cycles_total = 0;
+    isr_refills = 0;
+#endif
+    __set_PRIMASK(primask);
+}
+
+/**
+ * @brief Indica si hay una trama saliendo o esperando al DMA
+ */
+bool WS2812B_IsBusy(void)
+{
+    return dma_busy || frame_pending;
+}
+
+#if WS2812B_STREAMING
+
+/**
+ * @brief Actualiza la matriz de LEDs enviando la trama por DMA
+ * @note  No bloquea y no codifica nada: la trama se codifica LED por LED en
+ *        las interrupciones del DMA. Si hay una trama saliendo, la nueva
+ *        queda pendiente y arranca tras su reset (gana la última). Los LEDs
+ *        de la trama en curso que todavía no se codificaron ya salen con los
+ *        colores nuevos. Sin cambios no se envía nada.
+ */
+void WS2812B_Update(void)
+{
+    uint32_t primask = __get_PRIMASK();
+
+#if WS2812B_DITHER
+    // Nuevo paso del dithering: solo se envían los LEDs cuya salida cambió
+    WS2812B_OutputAll();
+#endif
+
+    __disable_irq();
+    uint16_t len = WS2812B_TakeLength();
+    if (len == 0) {
+        // Nada cambió (o la trama pendiente ya lo lleva)
+        stats.skipped += frame_pending ? 0u : 1u;
+    } else if (dma_busy) {
+        if (frame_pending) {
+            stats.coalesced++;
+            len = (pending_len > len) ? pending_len : len;
         }
+        pending_len = len;
+        frame_pending = true;
+    } else {
+        WS2812B_StartRing(len);
+    }
+    __set_PRIMASK(primask);
+}
+
+/**
+ * @brief Primera mitad del anillo enviada: recargarla
+ * @note  Llamar desde HAL_TIM_PWM_PulseFinishedHalfCpltCallback (contexto de interrupción)
+ */
+void WS2812B_HalfTransfer(void)
+{
+    if (dma_busy) {
+        WS2812B_RingEvent(0);
     }
+}
 
-    // Añadir 41 ceros al final para reset (>50us)
-    for (uint8_t i = 0; i < 41; i++) {
-        PWM_Buffer[buffer_idx++] = 0;
+/**
+ * @brief Segunda mitad del anillo enviada: recargarla
+ * @note  Llamar desde HAL_TIM_PWM_PulseFinishedCallback (contexto de interrupción)
+ */
+void WS2812B_TransferComplete(void)
+{
+    if (dma_busy) {
+        WS2812B_RingEvent(1);
+    }
+}
+
+/**
+ * @brief Arranca el DMA circular con la primera mitad en cero y los primeros LEDs
+ * @param len: LEDs de la trama
+ * @note  Llamar con las interrupciones deshabilitadas
+ */
+static void WS2812B_StartRing(uint16_t len)
+{
+    DMA_HandleTypeDef* hdma = WS2812B_TIMER.hdma[WS2812B_DMA_ID];
+
+    // CubeMX deja el stream en modo normal (el del doble buffer)
+    if (hdma->Init.Mode != DMA_CIRCULAR) {
+        hdma->Init.Mode = DMA_CIRCULAR;
+        if (HAL_DMA_Init(hdma) != HAL_OK) {
+            stats.dropped++;
+            lost_len = (len > lost_len) ? len : lost_len;
+            return;
+        }
+    }
+
+    // Contador de ciclos para medir las recargas
+    CoreDebug->DEMCR |= CoreDebug_DEMCR_TRCENA_Msk;
+    DWT->CTRL |= DWT_CTRL_CYCCNTENA_Msk;
+
+    // La mitad en cero hace de nivel bajo inicial (el [0] del doble buffer)
+    ring_next = 0;
+    ring_len = len;
+    ring_tail = 0;
+    memset(&PWM_Ring[0], 0, RING_HALF_SIZE * sizeof(uint16_t));
+    WS2812B_RingRefill(&PWM_Ring[RING_HALF_SIZE]);
+
+    if (HAL_TIM_PWM_Start_DMA(&WS2812B_TIMER, WS2812B_CHANNEL,
+                              (uint32_t*)PWM_Ring, RING_SIZE) == HAL_OK) {
+        dma_busy = true;
+        stats.leds_sent += len;
+    } else {
+        stats.dropped++;
+        lost_len = (len > lost_len) ? len : lost_len;
+    }
+}
+
+/**
+ * @brief Recarga una mitad del anillo que el DMA terminó de enviar
+ * @param half: Primera media palabra de esa mitad
+ * @retval true si se codificaron LEDs
+ * @note  Tras la mitad con los últimos LEDs hacen falta dos eventos para que
+ *        termine de salir y RING_RESET_HALVES mitades en cero para el reset;
+ *        después arranca la trama pendiente sin parar el DMA, o se para.
+ */
+static bool WS2812B_RingRefill(uint16_t* half)
+{
+    if (ring_tail == 0) {
+        uint16_t count = ring_len - ring_next;
+
+        if (count > WS2812B_RING_HALF_LEDS) {
+            count = WS2812B_RING_HALF_LEDS;
+        }
+        WS2812B_EncodeLut(half, &LED_RGB_Color[ring_next], count);
+        memset(&half[count * 24u], 0, (RING_HALF_SIZE - count * 24u) * sizeof(uint16_t));
+        ring_next += count;
+        if (ring_next >= ring_len) {
+            ring_tail = 1;
+        }
+        return true;
+    }
+
+    ring_tail++;
+    if (ring_tail <= 3u) {
+        // La mitad anterior a la última con datos y luego esa misma
+        memset(half, 0, RING_HALF_SIZE * sizeof(uint16_t));
+    } else if (ring_tail >= RING_RESET_HALVES + 3u) {
+        stats.completed++;
+        if (frame_pending) {
+            frame_pending = false;
+            ring_next = 0;
+            ring_len = pending_len;
+            ring_tail = 0;
+            stats.leds_sent += ring_len;
+            return WS2812B_RingRefill(half);
+        }
+        HAL_TIM_PWM_Stop_DMA(&WS2812B_TIMER, WS2812B_CHANNEL);
+        dma_busy = false;
+    }
+    return false;
+}
+
+/**
+ * @brief Recarga la mitad enviada, mide su costo y detecta si el DMA la alcanzó
+ * @param half: 0 = primera mitad (medio buffer), 1 = segunda (fin del buffer)
+ */
+static void WS2812B_RingEvent(uint8_t half)
+{
+    uint32_t start = DWT->CYCCNT;
+
+    if (!WS2812B_RingRefill(&PWM_Ring[half * RING_HALF_SIZE])) {
+        return;
+    }
+
+    uint32_t per_led = (DWT->CYCCNT - start) / WS2812B_RING_HALF_LEDS;
+    if (per_led > stats.isr_cycles_max) {
+        stats.isr_cycles_max = per_led;
+    }
+    isr_cycles_total += per_led;
+    isr_refills++;
+
+    // El DMA tiene que seguir en la otra mitad; si ya entró en esta, salieron bits viejos
+    uint32_t sent = RING_SIZE - __HAL_DMA_GET_COUNTER(WS2812B_TIMER.hdma[WS2812B_DMA_ID]);
+    if ((sent >= RING_HALF_SIZE) == (half != 0)) {
+        stats.underruns++;
+    }
+}
+
+#else /* !WS2812B_STREAMING */
+
+/**
+ * @brief Prepara un buffer PWM a partir de los colores RGB
+ * @param index: Buffer de PWM_Buffer a preparar
+ * @param len: LEDs de la trama
+ * @note  La primera vez lo codifica entero; después solo los LEDs que
+ *        cambiaron desde su última codificación. Una trama corta pisa con el
+ *        reset los LEDs que siguen, que quedan marcados para la próxima.
+ */
+static void WS2812B_PrepareBuffer(uint8_t index, uint16_t len)
+{
+    uint16_t* buffer = PWM_Buffer[index];
+
+    if (buffer_valid[index]) {
+        WS2812B_EncodeLutDirty(&buffer[PWM_LEAD_SLOTS], LED_RGB_Color, WS2812B_NUM_LEDS,
+                               LED_Dirty[index]);
+    } else {
+        // Ceros al inicio y al final para reset (>50us)
+        memset(buffer, 0, sizeof(PWM_Buffer[0]));
+        WS2812B_EncodeLut(&buffer[PWM_LEAD_SLOTS], LED_RGB_Color, WS2812B_NUM_LEDS);
+        memset(LED_Dirty[index], 0, sizeof(LED_Dirty[0]));
+        buffer_valid[index] = true;
+    }
+
+    if (len < WS2812B_NUM_LEDS) {
+        memset(&buffer[PWM_LEAD_SLOTS + 24 * len], 0, WS2812B_RESET_SLOTS * sizeof(uint16_t));
+        for (uint16_t led = len; led < WS2812B_NUM_LEDS && led * 24u < len * 24u + WS2812B_RESET_SLOTS; led++) {
+            LED_Dirty[index][led / 32u] |= 1u << (led % 32u);
+        }
     }
-    
-    // Colocar 0 al inicio
-    PWM_Buffer[0] = 0;
 }
 
 /**
  * @brief Actualiza la matriz de LEDs enviando la trama por DMA
+ * @note  No bloquea. Codifica en el buffer de atrás; si el DMA está libre lo
+ *        envía enseguida y si no queda pendiente hasta el fin de la trama en
+ *        curso. Una trama pendiente que se reemplaza antes de salir cuenta
+ *        como combinada: siempre se muestra la última. La trama llega hasta
+ *        el último LED que cambió y sin cambios no se envía nada.
  */
 void WS2812B_Update(void)
 {
-    WS2812B_PrepareBuffer();
-    HAL_TIM_PWM_Start_DMA(&WS2812B_TIMER, WS2812B_CHANNEL,
-                         (uint32_t*)PWM_Buffer, PWM_BUFFER_SIZE);
+    uint32_t primask = __get_PRIMASK();
+
+#if WS2812B_DITHER
+    // Nuevo paso del dithering: solo se envían los LEDs cuya salida cambió
+    WS2812B_OutputAll();
+#endif
+
+    // Que la interrupción no arranque el buffer de atrás mientras se escribe
+    __disable_irq();
+    uint16_t len = WS2812B_TakeLength();
+    if (len == 0) {
+        // Nada cambió (o la trama pendiente ya lo lleva)
+        stats.skipped += frame_pending ? 0u : 1u;
+        __set_PRIMASK(primask);
+        return;
+    }
+    if (frame_pending) {
+        frame_pending = false;
+        stats.coalesced++;
+        len = (pending_len > len) ? pending_len : len;
+    }
+    __set_PRIMASK(primask);
+
+    WS2812B_PrepareBuffer(front ^ 1u, len);
+
+    __disable_irq();
+    if (dma_busy) {
+        pending_len = len;
+        frame_pending = true;
+    } else {
+        WS2812B_StartBack(len);
+    }
+    __set_PRIMASK(primask);
+}
+
+/**
+ * @brief Medio buffer enviado: en el modo de doble buffer no hay nada que hacer
+ */
+void WS2812B_HalfTransfer(void)
+{
+}
+
+/**
+ * @brief Fin de la trama por DMA: arranca la pendiente, si hay
+ * @note  Llamar desde HAL_TIM_PWM_PulseFinishedCallback (contexto de interrupción)
+ */
+void WS2812B_TransferComplete(void)
+{
+    dma_busy = false;
+    stats.completed++;
+
+    if (frame_pending) {
+        frame_pending = false;
+        WS2812B_StartBack(pending_len);
+    }
+}
+
+/**
+ * @brief Envía el buffer de atrás y lo pasa adelante
+ * @param len: LEDs de la trama (el reset va enseguida del último)
+ * @note  Llamar con las interrupciones deshabilitadas o desde la interrupción
+ */
+static void WS2812B_StartBack(uint16_t len)
+{
+    uint8_t back = front ^ 1u;
+
+    if (HAL_TIM_PWM_Start_DMA(&WS2812B_TIMER, WS2812B_CHANNEL, (uint32_t*)PWM_Buffer[back],
+                              PWM_LEAD_SLOTS + 24 * len + WS2812B_RESET_SLOTS) == HAL_OK) {
+        front = back;
+        dma_busy = true;
+        stats.leds_sent += len;
+    } else {
+        stats.dropped++;
+        lost_len = (len > lost_len) ? len : lost_len;
+    }
+}
+
+#endif /* WS2812B_STREAMING */
+
+/**
+ * @brief LEDs que tiene que llevar la próxima trama: hasta el último que
+ *        cambió o el último de una trama perdida (0 = ninguno)
+ * @note  Llamar con las interrupciones deshabilitadas
+ */
+static uint16_t WS2812B_TakeLength(void)
+{
+    uint16_t len = (dirty_end > lost_len) ? dirty_end : lost_len;
+
+    dirty_end = 0;
+    lost_len = 0;
+    return len;
+}
+
+/**
+ * @brief Pasa el color pedido de un LED por el pipeline y lo marca si su salida cambió
+ */
+static void WS2812B_Output(uint16_t led)
+{
+    uint8_t out[1][3];
+
+    if (!color_scale_ready) {
+        WS2812B_ColorScaleInit(&color_scale, brightness,
+                               white_balance[0], white_balance[1], white_balance[2]);
+        color_scale_ready = true;
+    }
+#if WS2812B_DITHER
+    WS2812B_ColorApply(&color_scale, &LED_Input[led], out, &LED_Residual[led], 1);
+#else
+    WS2812B_ColorApply(&color_scale, &LED_Input[led], out, NULL, 1);
+#endif
+
+    if (memcmp(out[0], LED_RGB_Color[led], 3) == 0) {
+        return;
+    }
+    memcpy(LED_RGB_Color[led], out[0], 3);
+    if (led >= dirty_end) {
+        dirty_end = led + 1u;
+    }
+#if !WS2812B_STREAMING
+    // Solo se recodifican los LEDs que cambiaron (en los dos buffers)
+    LED_Dirty[0][led / 32u] |= 1u << (led % 32u);
+    LED_Dirty[1][led / 32u] |= 1u << (led % 32u);
+#endif
+}
+
+/**
+ * @brief Pasa todos los LEDs por el pipeline
+ */
+static void WS2812B_OutputAll(void)
+{
+    for (uint16_t led = 0; led < WS2812B_NUM_LEDS; led++) {
+        WS2812B_Output(led);
+    }
 }
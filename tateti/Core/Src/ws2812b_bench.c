@@ -0,0 +1,443 @@
+/**
+ ******************************************************************************
+ * @file    ws2812b_bench.c
+ * @brief   Implementación del benchmark de los codificadores WS2812B
+ ******************************************************************************
+ */
+
+#include "ws2812b_bench.h"
+#include "ws2812b_encode.h"
+#include "ws2812b_color.h"
+#include "stm32f4xx_hal.h"
+#include <math.h>
+#include <stdio.h>
+#include <string.h>
+
+#define BENCH_CHUNK_LEDS    64u     // LEDs de referencia por pasada de la prueba de exactitud
+#define BENCH_BRIGHTNESS    151u    // WS2812B_DEFAULT_BRIGHTNESS
+#define BENCH_GAMMA         2.2     // La de Gamma_correccion() y de la tabla por defecto
+
+/* Variables públicas */
+const uint16_t WS2812BBench_Sizes[WS2812B_BENCH_NUM_SIZES] = { 16u, 256u, 1024u };
+
+/* Variables privadas */
+static uint8_t colors[WS2812B_BENCH_MAX_LEDS][3];
+static uint16_t frame[WS2812B_BENCH_MAX_LEDS * WS2812B_SLOTS_PER_LED] __attribute__((aligned(4)));
+static uint16_t reference[BENCH_CHUNK_LEDS * WS2812B_SLOTS_PER_LED];
+static uint32_t dirty[WS2812B_DIRTY_WORDS(WS2812B_BENCH_MAX_LEDS)];
+static uint8_t pipeline_out[WS2812B_BENCH_MAX_LEDS][3];
+static uint8_t residual[WS2812B_BENCH_MAX_LEDS][3];
+static volatile uint8_t sink;                       // Evita que se descarte la salida del float
+
+static const char* const encoder_names[WS2812B_BENCH_NUM_ENCODERS] = {
+    "branchy", "lut", "lut_dirty"
+};
+
+static const char* const pipeline_names[WS2812B_BENCH_NUM_PIPELINES] = {
+    "float_pow", "int_lut", "int_dither"
+};
+
+/* Prototipos funciones privadas */
+static uint32_t NextRandom(uint32_t* rng);
+static void RandomColor(uint8_t color[3], uint32_t* rng);
+static void ChangeLeds(uint16_t leds, uint16_t changes, uint32_t* rng);
+static uint32_t CompareFrame(uint16_t leds);
+static uint8_t FloatGammaCorrection(uint8_t color, float brillo_);
+static uint32_t TargetClock(void);
+
+/**
+ * @brief  Compara los codificadores con tabla contra el de saltos
+ * @param  leds: Largo de la tira (hasta WS2812B_BENCH_MAX_LEDS)
+ * @param  seed: Semilla de los colores (0 = WS2812B_BENCH_SEED)
+ * @retval LEDs o pasadas que difieren (tiene que dar 0)
+ */
+uint32_t WS2812BBench_Check(uint16_t leds, uint32_t seed)
+{
+    uint32_t rng = (seed != 0) ? seed : WS2812B_BENCH_SEED;
+    uint32_t mismatches = 0;
+
+    if (leds > WS2812B_BENCH_MAX_LEDS) {
+        leds = WS2812B_BENCH_MAX_LEDS;
+    }
+
+    // Trama entera
+    for (uint16_t i = 0; i < leds; i++) {
+        RandomColor(colors[i], &rng);
+    }
+    WS2812B_EncodeLut(frame, (const uint8_t (*)[3])colors, leds);
+    mismatches += CompareFrame(leds);
+
+    // Solo los que cambian: el resto tiene que quedar como estaba
+    for (uint8_t pass = 0; pass < 8u; pass++) {
+        memset(dirty, 0, sizeof(dirty));
+        ChangeLeds(leds, (uint16_t)(leds / 4u + 1u), &rng);
+        WS2812B_EncodeLutDirty(frame, (const uint8_t (*)[3])colors, leds, dirty);
+        mismatches += CompareFrame(leds);
+        for (uint16_t w = 0; w < WS2812B_DIRTY_WORDS(leds); w++) {
+            mismatches += (dirty[w] != 0);
+        }
+    }
+    return mismatches;
+}
+
+/**
+ * @brief  Mide un codificador sobre un largo de tira
+ * @param  encoder: Codificador a medir
+ * @param  leds: Largo de la tira (hasta WS2812B_BENCH_MAX_LEDS)
+ * @param  frames: Tramas medidas (se queda el mínimo)
+ * @param  clock: Reloj libre
+ * @param  seed: Semilla de los colores (0 = WS2812B_BENCH_SEED)
+ * @param  result: Resultado
+ */
+void WS2812BBench_Run(WS2812BBench_Encoder_t encoder, uint16_t leds, uint16_t frames,
+                      WS2812BBench_Clock_t clock, uint32_t seed, WS2812BBench_Result_t* result)
+{
+    uint32_t rng = (seed != 0) ? seed : WS2812B_BENCH_SEED;
+    uint16_t changes = (uint16_t)((leds + WS2812B_BENCH_DIRTY_DIVISOR - 1u) / WS2812B_BENCH_DIRTY_DIVISOR);
+    uint32_t best = UINT32_MAX;
+
+    if (leds > WS2812B_BENCH_MAX_LEDS) {
+        leds = WS2812B_BENCH_MAX_LEDS;
+    }
+    for (uint16_t i = 0; i < leds; i++) {
+        RandomColor(colors[i], &rng);
+    }
+    WS2812B_EncodeLut(frame, (const uint8_t (*)[3])colors, leds);
+
+    for (uint16_t f = 0; f < frames; f++) {
+        // Cambiar los colores fuera de la medición
+        memset(dirty, 0, sizeof(dirty));
+        ChangeLeds(leds, changes, &rng);
+
+        uint32_t start = clock();
+        switch (encoder) {
+            case WS2812B_BENCH_BRANCHY:
+                WS2812B_EncodeBranchy(frame, (const uint8_t (*)[3])colors, leds);
+                break;
+            case WS2812B_BENCH_LUT:
+                WS2812B_EncodeLut(frame, (const uint8_t (*)[3])colors, leds);
+                break;
+            default:
+                WS2812B_EncodeLutDirty(frame, (const uint8_t (*)[3])colors, leds, dirty);
+                break;
+        }
+        uint32_t ticks = clock() - start;
+
+        best = (ticks < best) ? ticks : best;
+    }
+
+    result->encoder = encoder;
+    result->leds = leds;
+    result->encoded = (encoder == WS2812B_BENCH_LUT_DIRTY) ? changes : leds;
+    result->ticks_per_frame = (frames != 0) ? best : 0;
+}
+
+/**
+ * @brief  Nombre de un codificador (columna "encoder" del CSV)
+ */
+const char* WS2812BBench_EncoderName(WS2812BBench_Encoder_t encoder)
+{
+    return (encoder < WS2812B_BENCH_NUM_ENCODERS) ? encoder_names[encoder] : "?";
+}
+
+/**
+ * @brief  Imprime el encabezado del CSV
+ */
+void WS2812BBench_PrintHeader(void)
+{
+    printf("encoder,leds,encoded,ticks_per_frame,ticks_per_led,speedup\n");
+}
+
+/**
+ * @brief  Imprime una fila del CSV (sin float: printf de newlib-nano)
+ * @param  result: Resultado
+ * @param  baseline_ticks: ticks_per_frame de branchy con el mismo largo
+ */
+void WS2812BBench_PrintResult(const WS2812BBench_Result_t* result, uint32_t baseline_ticks)
+{
+    uint32_t per_led = (uint32_t)(((uint64_t)result->ticks_per_frame * 100u) / result->leds);
+    uint32_t speedup = (result->ticks_per_frame != 0) ?
+                       (uint32_t)(((uint64_t)baseline_ticks * 100u) / result->ticks_per_frame) : 0;
+
+    printf("%s,%u,%u,%lu,%lu.%02lu,%lu.%02lu\n", WS2812BBench_EncoderName(result->encoder),
+           result->leds, result->encoded, (unsigned long)result->ticks_per_frame,
+           (unsigned long)(per_led / 100u), (unsigned long)(per_led % 100u),
+           (unsigned long)(speedup / 100u), (unsigned long)(speedup % 100u));
+}
+
+/**
+ * @brief  Mide el error del pipeline de color contra la curva exacta
+ * @param  error: Máximos de |entero - exacto| en 1/256 de paso, para los
+ *         brillos 255, 151, 64 y 16 y los 256 colores de cada canal
+ */
+void WS2812BBench_CheckColor(WS2812BBench_ColorError_t* error)
+{
+    static const uint8_t levels[4] = { 255u, 151u, 64u, 16u };
+
+    error->round_max = 0;
+    error->dither_max = 0;
+
+    for (uint8_t l = 0; l < 4u; l++) {
+        WS2812B_ColorScale_t scale;
+        WS2812B_ColorScaleInit(&scale, levels[l], 255u, 255u, 255u);
+
+        for (uint16_t c = 0; c < 256u; c++) {
+            uint8_t in[1][3] = { { (uint8_t)c, (uint8_t)c, (uint8_t)c } };
+            uint8_t out[1][3];
+            uint8_t rest[1][3] = { { 0, 0, 0 } };
+            uint32_t sum[3] = { 0, 0, 0 };
+            double exact = 255.0 * pow((c / 255.0) * (levels[l] / 255.0), BENCH_GAMMA) * 256.0;
+
+            WS2812B_ColorApply(&scale, (const uint8_t (*)[3])in, out, NULL, 1);
+            for (uint16_t f = 0; f < 256u; f++) {
+                uint8_t frame_out[1][3];
+                WS2812B_ColorApply(&scale, (const uint8_t (*)[3])in, frame_out, rest, 1);
+                for (uint8_t ch = 0; ch < 3u; ch++) {
+                    sum[ch] += frame_out[0][ch];
+                }
+            }
+
+            for (uint8_t ch = 0; ch < 3u; ch++) {
+                uint32_t round_err = (uint32_t)lround(fabs(out[0][ch] * 256.0 - exact));
+                uint32_t dither_err = (uint32_t)lround(fabs((double)sum[ch] - exact));
+                error->round_max = (round_err > error->round_max) ? round_err : error->round_max;
+                error->dither_max = (dither_err > error->dither_max) ? dither_err : error->dither_max;
+            }
+        }
+    }
+}
+
+/**
+ * @brief  Mide un pipeline de color sobre un largo de tira
+ * @param  pipeline: Pipeline a medir
+ * @param  leds: Largo de la tira (hasta WS2812B_BENCH_MAX_LEDS)
+ * @param  frames: Tramas medidas (se queda el mínimo)
+ * @param  clock: Reloj libre
+ * @param  seed: Semilla de los colores (0 = WS2812B_BENCH_SEED)
+ * @param  result: Resultado
+ */
+void WS2812BBench_RunColor(WS2812BBench_Pipeline_t pipeline, uint16_t leds, uint16_t frames,
+                           WS2812BBench_Clock_t clock, uint32_t seed, WS2812BBench_ColorResult_t* result)
+{
+    uint32_t rng = (seed != 0) ? seed : WS2812B_BENCH_SEED;
+    const float brillo = (float)BENCH_BRIGHTNESS * 100.0f / 255.0f;
+    uint32_t best = UINT32_MAX;
+    WS2812B_ColorScale_t scale;
+
+    if (leds > WS2812B_BENCH_MAX_LEDS) {
+        leds = WS2812B_BENCH_MAX_LEDS;
+    }
+    for (uint16_t i = 0; i < leds; i++) {
+        RandomColor(colors[i], &rng);
+    }
+    memset(residual, 0, sizeof(residual));
+    WS2812B_ColorScaleInit(&scale, BENCH_BRIGHTNESS, 255u, 255u, 255u);
+
+    for (uint16_t f = 0; f < frames; f++) {
+        uint32_t start = clock();
+        switch (pipeline) {
+            case WS2812B_BENCH_FLOAT_POW:
+                for (uint16_t i = 0; i < leds; i++) {
+                    for (uint8_t c = 0; c < 3u; c++) {
+                        pipeline_out[i][c] = FloatGammaCorrection(colors[i][c], brillo);
+                    }
+                }
+                break;
+            case WS2812B_BENCH_INT_LUT:
+                WS2812B_ColorApply(&scale, (const uint8_t (*)[3])colors, pipeline_out, NULL, leds);
+                break;
+            default:
+                WS2812B_ColorApply(&scale, (const uint8_t (*)[3])colors, pipeline_out, residual, leds);
+                break;
+        }
+        uint32_t ticks = clock() - start;
+
+        sink = pipeline_out[f % leds][0];
+        best = (ticks < best) ? ticks : best;
+    }
+
+    result->pipeline = pipeline;
+    result->leds = leds;
+    result->ticks_per_frame = (frames != 0) ? best : 0;
+}
+
+/**
+ * @brief  Nombre de un pipeline de color (columna "pipeline" del CSV)
+ */
+const char* WS2812BBench_PipelineName(WS2812BBench_Pipeline_t pipeline)
+{
+    return (pipeline < WS2812B_BENCH_NUM_PIPELINES) ? pipeline_names[pipeline] : "?";
+}
+
+/**
+ * @brief  Imprime el encabezado del CSV del pipeline de color
+ */
+void WS2812BBench_PrintColorHeader(void)
+{
+    printf("pipeline,leds,ticks_per_frame,ticks_per_led,speedup\n");
+}
+
+/**
+ * @brief  Imprime una fila del CSV del pipeline de color
+ * @param  result: Resultado
+ * @param  baseline_ticks: ticks_per_frame de float_pow con el mismo largo
+ */
+void WS2812BBench_PrintColorResult(const WS2812BBench_ColorResult_t* result, uint32_t baseline_ticks)
+{
+    uint32_t per_led = (uint32_t)(((uint64_t)result->ticks_per_frame * 100u) / result->leds);
+    uint32_t speedup = (result->ticks_per_frame != 0) ?
+                       (uint32_t)(((uint64_t)baseline_ticks * 100u) / result->ticks_per_frame) : 0;
+
+    printf("%s,%u,%lu,%lu.%02lu,%lu.%02lu\n", WS2812BBench_PipelineName(result->pipeline),
+           result->leds, (unsigned long)result->ticks_per_frame,
+           (unsigned long)(per_led / 100u), (unsigned long)(per_led % 100u),
+           (unsigned long)(speedup / 100u), (unsigned long)(speedup % 100u));
+}
+
+/**
+ * @brief  Corre el benchmark en la placa con el contador de ciclos DWT
+ * @note   La salida va por printf (USART3)
+ */
+void WS2812BBench_RunTarget(void)
+{
+    WS2812BBench_Result_t result;
+    uint32_t mismatches = 0;
+
+    CoreDebug->DEMCR |= CoreDebug_DEMCR_TRCENA_Msk;
+    DWT->CTRL |= DWT_CTRL_CYCCNTENA_Msk;
+
+    for (uint8_t s = 0; s < WS2812B_BENCH_NUM_SIZES; s++) {
+        mismatches += WS2812BBench_Check(WS2812BBench_Sizes[s], 0);
+    }
+    printf("encoder_mismatches,%lu\n", (unsigned long)mismatches);
+
+    WS2812BBench_PrintHeader();
+    for (uint8_t s = 0; s < WS2812B_BENCH_NUM_SIZES; s++) {
+        uint32_t baseline = 0;
+        for (uint8_t e = 0; e < WS2812B_BENCH_NUM_ENCODERS; e++) {
+            WS2812BBench_Run((WS2812BBench_Encoder_t)e, WS2812BBench_Sizes[s], 32u, TargetClock, 0,
+                             &result);
+            if (e == WS2812B_BENCH_BRANCHY) {
+                baseline = result.ticks_per_frame;
+            }
+            WS2812BBench_PrintResult(&result, baseline);
+        }
+    }
+
+    WS2812BBench_ColorError_t error;
+    WS2812BBench_ColorResult_t color_result;
+    WS2812BBench_CheckColor(&error);
+    printf("color_error_256ths,round,%lu,dither,%lu\n",
+           (unsigned long)error.round_max, (unsigned long)error.dither_max);
+    WS2812BBench_PrintColorHeader();
+    for (uint8_t s = 0; s < WS2812B_BENCH_NUM_SIZES; s++) {
+        uint32_t baseline = 0;
+        for (uint8_t p = 0; p < WS2812B_BENCH_NUM_PIPELINES; p++) {
+            WS2812BBench_RunColor((WS2812BBench_Pipeline_t)p, WS2812BBench_Sizes[s], 8u, TargetClock, 0,
+                                  &color_result);
+            if (p == WS2812B_BENCH_FLOAT_POW) {
+                baseline = color_result.ticks_per_frame;
+            }
+            WS2812BBench_PrintColorResult(&color_result, baseline);
+        }
+    }
+}
+
+/**
+ * @brief  Generador xorshift32
+ */
+static uint32_t NextRandom(uint32_t* rng)
+{
+    uint32_t x = *rng;
+    x ^= x << 13;
+    x ^= x >> 17;
+    x ^= x << 5;
+    *rng = x;
+    return x;
+}
+
+/**
+ * @brief  Color al azar; uno de cada cuatro con componentes 0x00 o 0xFF
+ */
+static void RandomColor(uint8_t color[3], uint32_t* rng)
+{
+    uint32_t r = NextRandom(rng);
+
+    for (uint8_t c = 0; c < 3u; c++) {
+        color[c] = ((r & 3u) == 3u) ? (((r >> (8u + c)) & 1u) ? 0xFFu : 0x00u) : (uint8_t)(r >> (8u * c + 2u));
+    }
+}
+
+/**
+ * @brief  Cambia el color de LEDs al azar y los marca en dirty
+ */
+static void ChangeLeds(uint16_t leds, uint16_t changes, uint32_t* rng)
+{
+    for (uint16_t i = 0; i < changes; i++) {
+        uint16_t led = (uint16_t)(NextRandom(rng) % leds);
+        RandomColor(colors[led], rng);
+        dirty[led / 32u] |= 1u << (led % 32u);
+    }
+}
+
+/**
+ * @brief  Compara frame con WS2812B_EncodeBranchy de los colores actuales, por tramos
+ * @retval LEDs que difieren
+ */
+static uint32_t CompareFrame(uint16_t leds)
+{
+    uint32_t mismatches = 0;
+
+    for (uint16_t first = 0; first < leds; first += BENCH_CHUNK_LEDS) {
+        uint16_t count = (uint16_t)(leds - first);
+
+        if (count > BENCH_CHUNK_LEDS) {
+            count = BENCH_CHUNK_LEDS;
+        }
+
+        WS2812B_EncodeBranchy(reference, (const uint8_t (*)[3])&colors[first], count);
+        for (uint16_t i = 0; i < count; i++) {
+            if (memcmp(&reference[i * WS2812B_SLOTS_PER_LED],
+                       &frame[(first + i) * WS2812B_SLOTS_PER_LED],
+                       WS2812B_SLOTS_PER_LED * sizeof(uint16_t)) != 0) {
+                mismatches++;
+            }
+        }
+    }
+    return mismatches;
+}
+
+/**
+ * @brief  Gamma_correccion() de test_matriz_leds/Core/Src/ws2812b.c, sin cambios
+ * @note   Referencia del benchmark: brillo en float y pow() en cada canal
+ */
+static uint8_t FloatGammaCorrection(uint8_t color, float brillo_)
+{
+    // Limitar el valor de brillo a un rango de 0 a 100
+    if (brillo_ > 100.0f) brillo_ = 100.0f;
+    if (brillo_ < 0.0f) brillo_ = 0.0f;
+
+    // Normalizo el brillo al rango de 0.0 a 1.0
+    float brillo_Factor = brillo_ / 100.0f;
+
+    // aplica el facot
+    float adjustedColor = color * brillo_Factor;
+
+    // formula de escalamiento gamma
+    float gammaCorrectedColor = pow((adjustedColor / 255.0f), 2.2f) * 255.0f;
+
+    //analiza que este dentro los limites
+    if (gammaCorrectedColor > 255.0f) gammaCorrectedColor = 255.0f;
+    if (gammaCorrectedColor < 0.0f) gammaCorrectedColor = 0.0f;
+
+    // lo regresa como 8 bit escalado
+    return (uint8_t)gammaCorrectedColor;
+}
+
+/**
+ * @brief  Reloj de la placa: contador de ciclos DWT
+ */
+static uint32_t TargetClock(void)
+{
+    return DWT->CYCCNT;
+}
@@ -0,0 +1,55 @@
+/**
+ ******************************************************************************
+ * @file    ws2812b_color.c
+ * @brief   Implementación del pipeline de color en enteros de los WS2812B
+ ******************************************************************************
+ */
+
+#include "ws2812b_color.h"
+#include <stddef.h>
+
+/**
+ * @brief  Calcula la escala de cada canal
+ * @param  scale: Destino
+ * @param  brightness: Brillo global perceptual (0-255, 255 = sin atenuar)
+ * @param  white_r: Balance de blancos del rojo (255 = sin corregir)
+ * @param  white_g: Balance de blancos del verde
+ * @param  white_b: Balance de blancos del azul
+ */
+void WS2812B_ColorScaleInit(WS2812B_ColorScale_t* scale, uint8_t brightness,
+                            uint8_t white_r, uint8_t white_g, uint8_t white_b)
+{
+    const uint8_t white[3] = { white_g, white_r, white_b };
+
+    // gamma(b) * balance / 256: el máximo (65280) deja 255 x 256 - 1 en 8.8
+    for (uint8_t c = 0; c < 3u; c++) {
+        scale->scale[c] = (uint16_t)(((uint32_t)WS2812B_Gamma[c][brightness] * white[c] + 128u) >> 8);
+    }
+}
+
+/**
+ * @brief  Pasa colores perceptuales a valores de PWM
+ * @param  scale: Escala de WS2812B_ColorScaleInit
+ * @param  in: Colores GRB perceptuales
+ * @param  out: Colores GRB para el PWM (puede ser el mismo arreglo que in)
+ * @param  residual: Resto 8.8 por canal de la trama anterior (dithering
+ *         temporal, se actualiza) o NULL para redondear
+ * @param  count: Cantidad de LEDs
+ */
+void WS2812B_ColorApply(const WS2812B_ColorScale_t* scale, const uint8_t in[][3], uint8_t out[][3],
+                        uint8_t residual[][3], uint16_t count)
+{
+    for (uint16_t led = 0; led < count; led++) {
+        for (uint8_t c = 0; c < 3u; c++) {
+            uint32_t value = ((uint32_t)WS2812B_Gamma[c][in[led][c]] * scale->scale[c]) >> 16;
+
+            if (residual == NULL) {
+                out[led][c] = (uint8_t)((value + 128u) >> 8);
+            } else {
+                value += residual[led][c];
+                out[led][c] = (uint8_t)(value >> 8);
+                residual[led][c] = (uint8_t)value;
+            }
+        }
+    }
+}
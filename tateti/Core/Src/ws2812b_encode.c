@@ -0,0 +1,108 @@
+/**
+ ******************************************************************************
+ * @file    ws2812b_encode.c
+ * @brief   Implementación de los codificadores GRB -> CCR de los WS2812B
+ ******************************************************************************
+ */
+
+#include "ws2812b_encode.h"
+#include <string.h>
+
+/* Tabla de nibbles ----------------------------------------------------------*/
+/* CCR del bit b de n */
+#define NIBBLE_BIT(n, b)    ((((n) >> (b)) & 1u) ? WS2812B_PWM_BIT1 : WS2812B_PWM_BIT0)
+/* Dos períodos por palabra: el primero en la media palabra baja (little endian) */
+#define NIBBLE_PAIR(n, hi, lo) ((uint32_t)NIBBLE_BIT(n, hi) | ((uint32_t)NIBBLE_BIT(n, lo) << 16))
+#define NIBBLE_ENTRY(n)     { NIBBLE_PAIR(n, 3u, 2u), NIBBLE_PAIR(n, 1u, 0u) }
+
+static const uint32_t NibbleLut[16][2] = {
+    NIBBLE_ENTRY(0u),  NIBBLE_ENTRY(1u),  NIBBLE_ENTRY(2u),  NIBBLE_ENTRY(3u),
+    NIBBLE_ENTRY(4u),  NIBBLE_ENTRY(5u),  NIBBLE_ENTRY(6u),  NIBBLE_ENTRY(7u),
+    NIBBLE_ENTRY(8u),  NIBBLE_ENTRY(9u),  NIBBLE_ENTRY(10u), NIBBLE_ENTRY(11u),
+    NIBBLE_ENTRY(12u), NIBBLE_ENTRY(13u), NIBBLE_ENTRY(14u), NIBBLE_ENTRY(15u)
+};
+
+/* Prototipos funciones privadas */
+static void EncodeLedLut(uint16_t* out, const uint8_t grb[3]);
+
+/**
+ * @brief  Codifica LEDs de a un bit, con un salto por bit
+ * @param  out: Destino, WS2812B_SLOTS_PER_LED medias palabras por LED
+ * @param  grb: Colores en orden GRB
+ * @param  count: Cantidad de LEDs
+ */
+void WS2812B_EncodeBranchy(uint16_t* out, const uint8_t grb[][3], uint16_t count)
+{
+    for (uint16_t led = 0; led < count; led++)
+    {
+        // Combinar GRB en un uint32_t
+        uint32_t color = ((uint32_t)grb[led][0] << 16) |  // Verde
+                        ((uint32_t)grb[led][1] << 8) |    // Rojo
+                        grb[led][2];                       // Azul
+
+        // Para cada bit (del más significativo al menos)
+        for (int8_t bit = 23; bit >= 0; bit--)
+        {
+            if (color & ((uint32_t)1 << bit)) {
+                *out++ = WS2812B_PWM_BIT1;  // Bit '1'
+            } else {
+                *out++ = WS2812B_PWM_BIT0;  // Bit '0'
+            }
+        }
+    }
+}
+
+/**
+ * @brief  Codifica LEDs con la tabla de nibbles y escrituras de palabra
+ * @param  out: Destino alineado a 4 bytes, WS2812B_SLOTS_PER_LED medias palabras por LED
+ * @param  grb: Colores en orden GRB
+ * @param  count: Cantidad de LEDs
+ */
+void WS2812B_EncodeLut(uint16_t* out, const uint8_t grb[][3], uint16_t count)
+{
+    for (uint16_t led = 0; led < count; led++) {
+        EncodeLedLut(&out[led * WS2812B_SLOTS_PER_LED], grb[led]);
+    }
+}
+
+/**
+ * @brief  Codifica con la tabla solo los LEDs marcados y limpia las marcas
+ * @param  out: Destino alineado a 4 bytes (el LED i empieza en i * WS2812B_SLOTS_PER_LED)
+ * @param  grb: Colores en orden GRB
+ * @param  count: Cantidad de LEDs
+ * @param  dirty: Mapa de WS2812B_DIRTY_WORDS(count) palabras; queda en cero
+ */
+void WS2812B_EncodeLutDirty(uint16_t* out, const uint8_t grb[][3], uint16_t count,
+                            uint32_t dirty[])
+{
+    for (uint16_t w = 0; w < WS2812B_DIRTY_WORDS(count); w++) {
+        uint32_t bits = dirty[w];
+
+        while (bits != 0) {
+            uint16_t led = (uint16_t)(w * 32u + (uint32_t)__builtin_ctz(bits));
+            bits &= bits - 1u;
+            if (led < count) {
+                EncodeLedLut(&out[led * WS2812B_SLOTS_PER_LED], grb[led]);
+            }
+        }
+        dirty[w] = 0;
+    }
+}
+
+/**
+ * @brief  Un LED: 6 nibbles, cada uno 4 medias palabras copiadas como dos palabras
+ * @note   memcpy de 4 bytes compila a un LDR y un STR (sin problemas de aliasing)
+ */
+static void EncodeLedLut(uint16_t* out, const uint8_t grb[3])
+{
+    for (uint8_t c = 0; c < 3u; c++) {
+        const uint32_t* hi = NibbleLut[grb[c] >> 4];
+        const uint32_t* lo = NibbleLut[grb[c] & 0x0Fu];
+
+        memcpy(&out[0], &hi[0], sizeof(uint32_t));
+        memcpy(&out[2], &hi[1], sizeof(uint32_t));
+        memcpy(&out[4], &lo[0], sizeof(uint32_t));
+        memcpy(&out[6], &lo[1], sizeof(uint32_t));
+        out += 8;
+    }
+}
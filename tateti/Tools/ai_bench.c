@@ -0,0 +1,225 @@
+/**
+ ******************************************************************************
+ * @file    ai_bench.c
+ * @brief   Benchmark (PC) de la IA con control de regresiones
+ ******************************************************************************
+ * @attention
+ *
+ * Mide cada motor de la IA sobre las 4520 posiciones con turno de P2
+ * (Core/Src/ai_bench.c) usando clock_gettime e imprime el CSV por stdout.
+ * Con --baseline compara contra una corrida anterior y retorna 1 si algún
+ * motor empeoró:
+ *   - nodos: cualquier aumento (son deterministas)
+ *   - mediana y p99: más de --tolerance (relativo) + AI_BENCH_SLACK_NS
+ *
+ * Compilar y ejecutar desde la carpeta tateti/:
+ *   gcc -O2 -ITools/host -ICore/Inc -o ai_bench Tools/ai_bench.c \
+ *       Core/Src/ai_bench.c Core/Src/ai.c Core/Src/ai_search.c \
+ *       Core/Src/ai_table.c Core/Src/ai_table_data.c Core/Src/ai_policy.c \
+ *       Core/Src/ai_policy_data.c Core/Src/bitboard.c \
+ *       Core/Src/game_logic.c Core/Src/mnk.c Core/Src/mcts.c Core/Src/ultimate.c \
+ *       Core/Src/ultimate_search.c Core/Src/nn_eval.c Core/Src/nn_model_data.c -lm
+ *   ./ai_bench --baseline Tools/ai_bench_baseline.csv
+ *   ./ai_bench --write-baseline Tools/ai_bench_baseline.csv
+ *
+ * Opciones:
+ *   --engines easy,medium,hard,mcts,search,overlay,learned
+ *                                            Motores a medir (todos por defecto)
+ *   --baseline ARCHIVO                       Comparar contra una referencia
+ *   --write-baseline ARCHIVO                 Guardar esta corrida como referencia
+ *   --tolerance X                            Margen de latencia (0.5 = +50%)
+ *
+ * Las latencias de referencia dependen de la máquina: regenerar el archivo
+ * al cambiar de PC. Los nodos no.
+ *
+ ******************************************************************************
+ */
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <time.h>
+#include "stm32f4xx_hal.h"
+#include "ai_bench.h"
+
+#define AI_BENCH_SLACK_NS   1000u   // Ruido absoluto tolerado en latencias chicas
+
+/* Reemplazos del HAL (Tools/host/stm32f4xx_hal.h) */
+HostHAL_DWT_t HostHAL_DWT;
+HostHAL_CoreDebug_t HostHAL_CoreDebug;
+uint32_t SystemCoreClock = 168000000u;
+
+static Bitboard_t positions[AI_BENCH_MAX_POSITIONS];
+static AIBench_Result_t results[AI_BENCH_NUM_ENGINES];
+
+static uint32_t HostClock(void);
+static uint32_t ParseEngines(const char* list);
+static int WriteBaseline(const char* path, uint32_t mask);
+static int CheckBaseline(const char* path, uint32_t mask, double tolerance);
+
+uint32_t HAL_GetTick(void)
+{
+    struct timespec ts;
+    clock_gettime(CLOCK_MONOTONIC, &ts);
+    return (uint32_t)(ts.tv_sec * 1000u + ts.tv_nsec / 1000000u);
+}
+
+int main(int argc, char** argv)
+{
+    const char* baseline = NULL;
+    const char* write_path = NULL;
+    uint32_t mask = AI_BENCH_ALL_ENGINES;
+    double tolerance = 0.5;
+
+    for (int i = 1; i < argc; i++) {
+        if (strcmp(argv[i], "--engines") == 0 && i + 1 < argc) {
+            mask = ParseEngines(argv[++i]);
+        } else if (strcmp(argv[i], "--baseline") == 0 && i + 1 < argc) {
+            baseline = argv[++i];
+        } else if (strcmp(argv[i], "--write-baseline") == 0 && i + 1 < argc) {
+            write_path = argv[++i];
+        } else if (strcmp(argv[i], "--tolerance") == 0 && i + 1 < argc) {
+            tolerance = atof(argv[++i]);
+        } else {
+            fprintf(stderr, "Opción desconocida: %s\n", argv[i]);
+            return 2;
+        }
+    }
+    if (mask == 0) {
+        fprintf(stderr, "Ningún motor válido en --engines\n");
+        return 2;
+    }
+
+    uint16_t count = AIBench_CollectPositions(positions, AI_BENCH_MAX_POSITIONS);
+
+    AIBench_PrintHeader();
+    for (uint8_t e = 0; e < AI_BENCH_NUM_ENGINES; e++) {
+        if (mask & (1u << e)) {
+            AIBench_RunEngine((AIBench_Engine_t)e, positions, count, HostClock, 1000u, &results[e]);
+            AIBench_PrintResult(&results[e]);
+        }
+    }
+    fflush(stdout);
+
+    if (write_path != NULL && WriteBaseline(write_path, mask) != 0) {
+        return 2;
+    }
+    if (baseline != NULL) {
+        return CheckBaseline(baseline, mask, tolerance);
+    }
+    return 0;
+}
+
+/**
+ * @brief  Reloj de la PC en nanosegundos (1000 ticks por microsegundo)
+ */
+static uint32_t HostClock(void)
+{
+    struct timespec ts;
+    clock_gettime(CLOCK_MONOTONIC, &ts);
+    return (uint32_t)((uint64_t)ts.tv_sec * 1000000000u + (uint64_t)ts.tv_nsec);
+}
+
+/**
+ * @brief  Convierte "easy,hard,..." en una máscara de motores
+ */
+static uint32_t ParseEngines(const char* list)
+{
+    uint32_t mask = 0;
+    char buffer[128];
+
+    strncpy(buffer, list, sizeof(buffer) - 1u);
+    buffer[sizeof(buffer) - 1u] = '\0';
+
+    for (char* name = strtok(buffer, ","); name != NULL; name = strtok(NULL, ",")) {
+        for (uint8_t e = 0; e < AI_BENCH_NUM_ENGINES; e++) {
+            if (strcmp(name, AIBench_EngineName((AIBench_Engine_t)e)) == 0) {
+                mask |= 1u << e;
+            }
+        }
+    }
+    return mask;
+}
+
+/**
+ * @brief  Guarda los resultados en el mismo formato CSV que stdout
+ */
+static int WriteBaseline(const char* path, uint32_t mask)
+{
+    FILE* f = fopen(path, "w");
+    if (f == NULL) {
+        perror(path);
+        return 1;
+    }
+
+    fprintf(f, "engine,positions,min_ns,median_ns,p99_ns,max_ns,total_us,nodes,nodes_per_s\n");
+    for (uint8_t e = 0; e < AI_BENCH_NUM_ENGINES; e++) {
+        const AIBench_Result_t* r = &results[e];
+        if (mask & (1u << e)) {
+            fprintf(f, "%s,%u,%u,%u,%u,%u,%u,%u,%u\n", AIBench_EngineName(r->engine), r->positions,
+                    r->min_ns, r->median_ns, r->p99_ns, r->max_ns, r->total_us, r->total_nodes,
+                    r->nodes_per_s);
+        }
+    }
+    fclose(f);
+    return 0;
+}
+
+/**
+ * @brief  Compara los resultados contra un archivo de referencia
+ * @retval 0 si no hay regresiones, 1 si las hay, 2 si no se pudo leer
+ */
+static int CheckBaseline(const char* path, uint32_t mask, double tolerance)
+{
+    FILE* f = fopen(path, "r");
+    char line[256];
+    int regressions = 0;
+
+    if (f == NULL) {
+        perror(path);
+        return 2;
+    }
+
+    while (fgets(line, sizeof(line), f) != NULL) {
+        char name[32];
+        AIBench_Result_t base;
+        if (sscanf(line, "%31[^,],%u,%u,%u,%u,%u,%u,%u,%u", name, &base.positions, &base.min_ns,
+                   &base.median_ns, &base.p99_ns, &base.max_ns, &base.total_us, &base.total_nodes,
+                   &base.nodes_per_s) != 9) {
+            continue;  // Encabezado o línea inválida
+        }
+
+        uint32_t engine_mask = ParseEngines(name);
+        if ((engine_mask & mask) == 0) {
+            continue;
+        }
+        const AIBench_Result_t* r = &results[__builtin_ctz(engine_mask)];
+        double median_limit = base.median_ns * (1.0 + tolerance) + AI_BENCH_SLACK_NS;
+        double p99_limit = base.p99_ns * (1.0 + tolerance) + AI_BENCH_SLACK_NS;
+
+        if (r->positions != base.positions) {
+            fprintf(stderr, "%s: %u posiciones (referencia %u)\n", name, r->positions, base.positions);
+            regressions++;
+        }
+        if (r->total_nodes > base.total_nodes) {
+            fprintf(stderr, "%s: nodos %u > %u\n", name, r->total_nodes, base.total_nodes);
+            regressions++;
+        }
+        if (r->median_ns > median_limit) {
+            fprintf(stderr, "%s: mediana %u ns > %.0f ns\n", name, r->median_ns, median_limit);
+            regressions++;
+        }
+        if (r->p99_ns > p99_limit) {
+            fprintf(stderr, "%s: p99 %u ns > %.0f ns\n", name, r->p99_ns, p99_limit);
+            regressions++;
+        }
+    }
+    fclose(f);
+
+    if (regressions != 0) {
+        fprintf(stderr, "%d regresiones respecto de %s\n", regressions, path);
+        return 1;
+    }
+    fprintf(stderr, "Sin regresiones respecto de %s\n", path);
+    return 0;
+}
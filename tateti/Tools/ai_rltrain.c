@@ -0,0 +1,474 @@
+/**
+ ******************************************************************************
+ * @file    ai_rltrain.c
+ * @brief   Entrenador (PC) por refuerzo de la política aprendida (AI_LEARNED)
+ ******************************************************************************
+ * @attention
+ *
+ * Q-learning tabular jugando contra sí mismo sobre las reglas del bitboard
+ * (las mismas de game_logic.c). El estado es la posición vista por el
+ * jugador que mueve (sus fichas como P2), reducida a la forma canónica de
+ * ai_table.h, así que ambos lados comparten la tabla y hay exactamente una
+ * fila por entrada de la tabla. El objetivo de cada jugada es negamax:
+ *   1 si gana, 0 si empata y si no -gamma * max Q(posición del rival).
+ *
+ * - Todos los hilos escriben la misma tabla Q sin locks (estilo Hogwild):
+ *   cada valor es un float atómico que se lee y escribe con orden relajado.
+ *   Una actualización puede pisar a otra concurrente en la misma celda; con
+ *   objetivos deterministas eso solo demora la convergencia. Por eso el
+ *   resultado depende de --seed y también de la cantidad de hilos.
+ * - La exploración es epsilon-greedy, con epsilon decreciendo linealmente
+ *   de --epsilon a --epsilon-end a lo largo del entrenamiento.
+ * - Cada --report episodios informa episodios/s (total y por núcleo), el
+ *   cambio medio de Q en la ronda y cuántas posiciones juega de forma
+ *   óptima la política (comparada con AISearch_RankMoves), antes y después
+ *   de cuantizar. Una posición cuenta como óptima si todas las jugadas con
+ *   la preferencia máxima lo son.
+ * - Al terminar cuantiza Q a 8 bits por celda (1 + (Q + 1) * 127, 0 para
+ *   las ocupadas) y escribe Core/Src/ai_policy_data.c.
+ *
+ * Compilar y ejecutar desde la carpeta tateti/:
+ *   gcc -O2 -pthread -ICore/Inc -o ai_rltrain Tools/ai_rltrain.c \
+ *       Core/Src/bitboard.c Core/Src/ai_search.c Core/Src/ai_table.c \
+ *       Core/Src/ai_table_data.c -lm
+ *   ./ai_rltrain --threads 1 Core/Src/ai_policy_data.c
+ *
+ * Opciones:
+ *   --episodes N            Partidas de entrenamiento (1000000 por defecto)
+ *   --threads N             Hilos (núcleos disponibles por defecto)
+ *   --report N              Episodios por ronda de informe (100000 por defecto)
+ *   --alpha X               Tasa de aprendizaje (0.25 por defecto)
+ *   --gamma X               Descuento por jugada (0.9 por defecto)
+ *   --epsilon X             Exploración inicial (1.0 por defecto)
+ *   --epsilon-end X         Exploración final (0.1 por defecto)
+ *   --seed N                Semilla base (1 por defecto)
+ *   --stop                  Terminar apenas la política cuantizada sea óptima
+ *                           en todas las posiciones
+ *   ARCHIVO                 Salida (ai_policy_data.c por defecto)
+ *
+ ******************************************************************************
+ */
+
+#include <math.h>
+#include <pthread.h>
+#include <stdatomic.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <time.h>
+#include <unistd.h>
+#include "bitboard.h"
+#include "ai_search.h"
+#include "ai_table.h"
+#include "ai_policy.h"
+
+#define RL_MAX_THREADS  256u
+#define RL_MAX_STATES   1024u
+#define RL_NUM_KEYS     (1u << (2 * BB_NUM_CELLS))
+#define RL_NO_STATE     0xFFFFu
+
+/* Estado de cada hilo */
+typedef struct {
+    pthread_t thread;
+    uint64_t rng;
+    uint64_t first;         // Episodio global de inicio (para epsilon)
+    uint64_t episodes;      // Episodios de esta ronda
+} Worker_t;
+
+/* Configuración del entrenamiento */
+static uint64_t num_episodes = 1000000u;
+static uint64_t report_every = 100000u;
+static uint32_t num_threads;
+static float alpha = 0.25f;
+static float gamma_discount = 0.9f;
+static float epsilon_start = 1.0f;
+static float epsilon_end = 0.1f;
+static uint64_t base_seed = 1u;
+static bool stop_early = false;
+
+/* Posición vista por el que mueve (Bitboard_Key con sus fichas como P2)
+ * -> fila de la tabla y simetría a la orientación canónica */
+static uint16_t state_index[RL_NUM_KEYS];
+static uint8_t state_sym[RL_NUM_KEYS];
+static uint8_t sym_cell[BB_NUM_SYMMETRIES][BB_NUM_CELLS];  // Celda real -> canónica
+
+/* Tabla Q compartida, en la orientación canónica */
+static _Atomic float q_table[RL_MAX_STATES][BB_NUM_CELLS];
+static float q_snapshot[RL_MAX_STATES][BB_NUM_CELLS];
+
+/* Jugadas óptimas de cada fila (máscara canónica) y celdas libres */
+static uint16_t optimal_mask[RL_MAX_STATES];
+static uint16_t free_mask[RL_MAX_STATES];
+
+static void BuildStates(void);
+static void* WorkerMain(void* arg);
+static void RunEpisode(uint64_t* rng, float epsilon);
+static uint8_t GreedyCell(uint32_t key, uint16_t empty);
+static float MaxQ(uint32_t key, uint16_t empty);
+static uint16_t CountOptimal(bool quantized);
+static uint8_t Quantize(float q);
+static uint64_t SplitMix64(uint64_t* state);
+static int WritePolicy(const char* path, uint64_t episodes, uint16_t optimal);
+
+int main(int argc, char** argv)
+{
+    const char* path = "ai_policy_data.c";
+    long cores = sysconf(_SC_NPROCESSORS_ONLN);
+
+    num_threads = (cores > 0) ? (uint32_t)cores : 1u;
+    for (int i = 1; i < argc; i++) {
+        if (strcmp(argv[i], "--episodes") == 0 && i + 1 < argc) {
+            num_episodes = strtoull(argv[++i], NULL, 10);
+        } else if (strcmp(argv[i], "--threads") == 0 && i + 1 < argc) {
+            num_threads = (uint32_t)strtoul(argv[++i], NULL, 10);
+        } else if (strcmp(argv[i], "--report") == 0 && i + 1 < argc) {
+            report_every = strtoull(argv[++i], NULL, 10);
+        } else if (strcmp(argv[i], "--alpha") == 0 && i + 1 < argc) {
+            alpha = strtof(argv[++i], NULL);
+        } else if (strcmp(argv[i], "--gamma") == 0 && i + 1 < argc) {
+            gamma_discount = strtof(argv[++i], NULL);
+        } else if (strcmp(argv[i], "--epsilon") == 0 && i + 1 < argc) {
+            epsilon_start = strtof(argv[++i], NULL);
+        } else if (strcmp(argv[i], "--epsilon-end") == 0 && i + 1 < argc) {
+            epsilon_end = strtof(argv[++i], NULL);
+        } else if (strcmp(argv[i], "--seed") == 0 && i + 1 < argc) {
+            base_seed = strtoull(argv[++i], NULL, 10);
+        } else if (strcmp(argv[i], "--stop") == 0) {
+            stop_early = true;
+        } else if (argv[i][0] != '-') {
+            path = argv[i];
+        } else {
+            fprintf(stderr, "Opción desconocida: %s\n", argv[i]);
+            return 2;
+        }
+    }
+    if (num_episodes == 0 || report_every == 0 || num_threads == 0) {
+        fprintf(stderr, "--episodes, --report y --threads deben ser mayores que 0\n");
+        return 2;
+    }
+    if (num_threads > RL_MAX_THREADS) {
+        num_threads = RL_MAX_THREADS;
+    }
+    if (AI_TableSize > RL_MAX_STATES) {
+        fprintf(stderr, "RL_MAX_STATES insuficiente\n");
+        return 2;
+    }
+
+    BuildStates();
+
+    Worker_t* workers = calloc(num_threads, sizeof(Worker_t));
+    if (workers == NULL) {
+        fprintf(stderr, "Sin memoria\n");
+        return 2;
+    }
+    for (uint32_t t = 0; t < num_threads; t++) {
+        uint64_t seed = base_seed ^ ((uint64_t)t << 32);
+        workers[t].rng = SplitMix64(&seed) | 1u;
+    }
+
+    fprintf(stderr, "%llu episodios, %u hilos, alpha %.3f, gamma %.3f, epsilon %.2f -> %.2f\n",
+            (unsigned long long)num_episodes, num_threads, alpha, gamma_discount, epsilon_start,
+            epsilon_end);
+    printf("episodios,ep_por_s,ep_por_s_nucleo,delta_q,optimas,optimas_8bits\n");
+
+    uint64_t done = 0;
+    uint16_t optimal_q8 = 0;
+    double total_seconds = 0.0;
+    while (done < num_episodes) {
+        uint64_t round = (num_episodes - done < report_every) ? num_episodes - done : report_every;
+        struct timespec start;
+        struct timespec end;
+
+        memcpy(q_snapshot, (const void*)q_table, sizeof(q_snapshot));
+        clock_gettime(CLOCK_MONOTONIC, &start);
+        for (uint32_t t = 0; t < num_threads; t++) {
+            uint64_t first = round * t / num_threads;
+            uint64_t last = round * (t + 1u) / num_threads;
+
+            workers[t].first = done + first;
+            workers[t].episodes = last - first;
+            if (pthread_create(&workers[t].thread, NULL, WorkerMain, &workers[t]) != 0) {
+                fprintf(stderr, "No se pudo crear el hilo %u\n", t);
+                return 2;
+            }
+        }
+        for (uint32_t t = 0; t < num_threads; t++) {
+            pthread_join(workers[t].thread, NULL);
+        }
+        clock_gettime(CLOCK_MONOTONIC, &end);
+        done += round;
+
+        double seconds = (double)(end.tv_sec - start.tv_sec) + (end.tv_nsec - start.tv_nsec) * 1e-9;
+        double delta = 0.0;
+        total_seconds += seconds;
+        for (uint16_t s = 0; s < AI_TableSize; s++) {
+            for (uint8_t c = 0; c < BB_NUM_CELLS; c++) {
+                float q = atomic_load_explicit(&q_table[s][c], memory_order_relaxed);
+                delta += fabs((double)q - (double)q_snapshot[s][c]);
+            }
+        }
+        uint16_t optimal = CountOptimal(false);
+        optimal_q8 = CountOptimal(true);
+
+        printf("%llu,%.0f,%.0f,%.6f,%u,%u\n", (unsigned long long)done, round / seconds,
+               round / seconds / num_threads, delta / (AI_TableSize * BB_NUM_CELLS), optimal,
+               optimal_q8);
+        fflush(stdout);
+        if (stop_early && optimal_q8 == AI_TableSize) {
+            break;
+        }
+    }
+
+    fprintf(stderr, "%llu episodios en %.2f s (%.0f episodios/s por núcleo), "
+            "posiciones óptimas %u/%u\n", (unsigned long long)done, total_seconds,
+            done / total_seconds / num_threads, optimal_q8, AI_TableSize);
+
+    free(workers);
+    return WritePolicy(path, done, optimal_q8);
+}
+
+/**
+ * @brief  Arma el mapa posición -> fila y las jugadas óptimas de cada fila
+ */
+static void BuildStates(void)
+{
+    for (uint32_t k = 0; k < RL_NUM_KEYS; k++) {
+        state_index[k] = RL_NO_STATE;
+    }
+    for (uint8_t sym = 0; sym < BB_NUM_SYMMETRIES; sym++) {
+        for (uint8_t c = 0; c < BB_NUM_CELLS; c++) {
+            sym_cell[sym][c] = (uint8_t)__builtin_ctz(Bitboard_Transform((uint16_t)(1u << c), sym));
+        }
+    }
+
+    // Todos los tableros sin celdas compartidas; los que no están en la
+    // tabla (terminales o ilegales) no se alcanzan durante el entrenamiento
+    for (uint16_t p1 = 0; p1 <= BB_FULL_MASK; p1++) {
+        for (uint16_t p2 = 0; p2 <= BB_FULL_MASK; p2++) {
+            Bitboard_t board = {p1, p2};
+            uint16_t index;
+            uint8_t sym;
+
+            if ((p1 & p2) == 0 && AITable_Find(&board, &index, &sym)) {
+                state_index[Bitboard_Key(&board)] = index;
+                state_sym[Bitboard_Key(&board)] = sym;
+            }
+        }
+    }
+
+    for (uint16_t s = 0; s < AI_TableSize; s++) {
+        Bitboard_t board;
+        AITable_Position(s, &board);
+        AISearch_Move_t moves[BB_NUM_CELLS];
+        uint8_t count = AISearch_RankMoves(board, true, moves);
+
+        free_mask[s] = Bitboard_Empty(&board);
+        optimal_mask[s] = 0;
+        for (uint8_t i = 0; i < count && moves[i].score == moves[0].score; i++) {
+            optimal_mask[s] |= (uint16_t)(1u << moves[i].move);
+        }
+    }
+}
+
+static void* WorkerMain(void* arg)
+{
+    Worker_t* w = (Worker_t*)arg;
+    float span = (float)num_episodes;
+
+    for (uint64_t e = 0; e < w->episodes; e++) {
+        float progress = (float)(w->first + e) / span;
+        RunEpisode(&w->rng, epsilon_start + (epsilon_end - epsilon_start) * progress);
+    }
+    return NULL;
+}
+
+/**
+ * @brief  Juega una partida contra sí mismo y actualiza Q en cada jugada
+ */
+static void RunEpisode(uint64_t* rng, float epsilon)
+{
+    uint16_t own = 0;   // Fichas del que mueve
+    uint16_t opp = 0;
+
+    for (;;) {
+        uint32_t key = ((uint32_t)own << BB_NUM_CELLS) | opp;
+        uint16_t empty = (uint16_t)(~(own | opp) & BB_FULL_MASK);
+        uint64_t r = SplitMix64(rng);
+        uint8_t cell;
+
+        if ((float)(r >> 40) * (1.0f / 16777216.0f) < epsilon) {
+            uint16_t pick = empty;
+            uint8_t skip = (uint8_t)((r & 0xFFFFu) % (uint32_t)__builtin_popcount(empty));
+            while (skip--) {
+                Bitboard_PopLowest(&pick);
+            }
+            cell = Bitboard_PopLowest(&pick);
+        } else {
+            cell = GreedyCell(key, empty);
+        }
+
+        own |= (uint16_t)(1u << cell);
+        empty &= (uint16_t)~(1u << cell);
+
+        float target;
+        bool finished = true;
+        if (Bitboard_HasWin(own)) {
+            target = 1.0f;
+        } else if (empty == 0) {
+            target = 0.0f;
+        } else {
+            // Negamax: lo que vale la posición para el rival, con signo cambiado
+            target = -gamma_discount * MaxQ(((uint32_t)opp << BB_NUM_CELLS) | own, empty);
+            finished = false;
+        }
+
+        _Atomic float* q = &q_table[state_index[key]][sym_cell[state_sym[key]][cell]];
+        float value = atomic_load_explicit(q, memory_order_relaxed);
+        atomic_store_explicit(q, value + alpha * (target - value), memory_order_relaxed);
+
+        if (finished) {
+            return;
+        }
+        uint16_t swap = own;
+        own = opp;
+        opp = swap;
+    }
+}
+
+/**
+ * @brief  Celda libre de mayor Q (a igualdad, la de menor índice real)
+ */
+static uint8_t GreedyCell(uint32_t key, uint16_t empty)
+{
+    const _Atomic float* row = q_table[state_index[key]];
+    const uint8_t* map = sym_cell[state_sym[key]];
+    uint8_t best_cell = 0;
+    float best = -INFINITY;
+
+    while (empty) {
+        uint8_t cell = Bitboard_PopLowest(&empty);
+        float q = atomic_load_explicit(&row[map[cell]], memory_order_relaxed);
+        if (q > best) {
+            best = q;
+            best_cell = cell;
+        }
+    }
+    return best_cell;
+}
+
+/**
+ * @brief  Mayor Q entre las celdas libres de una posición
+ */
+static float MaxQ(uint32_t key, uint16_t empty)
+{
+    const _Atomic float* row = q_table[state_index[key]];
+    const uint8_t* map = sym_cell[state_sym[key]];
+    float best = -INFINITY;
+
+    while (empty) {
+        float q = atomic_load_explicit(&row[map[Bitboard_PopLowest(&empty)]], memory_order_relaxed);
+        if (q > best) {
+            best = q;
+        }
+    }
+    return best;
+}
+
+/**
+ * @brief  Cuenta las filas en las que todas las jugadas preferidas son óptimas
+ * @param  quantized: true para evaluar las preferencias de 8 bits
+ */
+static uint16_t CountOptimal(bool quantized)
+{
+    uint16_t count = 0;
+
+    for (uint16_t s = 0; s < AI_TableSize; s++) {
+        float best = -INFINITY;
+        uint16_t preferred = 0;
+        uint16_t empty = free_mask[s];
+
+        while (empty) {
+            uint8_t c = Bitboard_PopLowest(&empty);
+            float q = atomic_load_explicit(&q_table[s][c], memory_order_relaxed);
+            float value = quantized ? (float)Quantize(q) : q;
+
+            if (value > best) {
+                best = value;
+                preferred = 0;
+            }
+            if (value == best) {
+                preferred |= (uint16_t)(1u << c);
+            }
+        }
+        if ((preferred & ~optimal_mask[s]) == 0) {
+            count++;
+        }
+    }
+    return count;
+}
+
+/**
+ * @brief  Lleva Q de [-1, 1] a una preferencia de 1 a 255
+ */
+static uint8_t Quantize(float q)
+{
+    if (q < -1.0f) q = -1.0f;
+    if (q > 1.0f) q = 1.0f;
+    return (uint8_t)(1 + lroundf((q + 1.0f) * 127.0f));
+}
+
+/**
+ * @brief  Generador splitmix64 (exploración y semillas de los hilos)
+ */
+static uint64_t SplitMix64(uint64_t* state)
+{
+    uint64_t z = (*state += 0x9E3779B97F4A7C15ull);
+    z = (z ^ (z >> 30)) * 0xBF58476D1CE4E5B9ull;
+    z = (z ^ (z >> 27)) * 0x94D049BB133111EBull;
+    return z ^ (z >> 31);
+}
+
+/**
+ * @brief  Escribe las preferencias cuantizadas como fuente C para el firmware
+ */
+static int WritePolicy(const char* path, uint64_t episodes, uint16_t optimal)
+{
+    FILE* f = fopen(path, "w");
+    if (f == NULL) {
+        perror(path);
+        return 1;
+    }
+
+    fprintf(f, "/**\n");
+    fprintf(f, " ******************************************************************************\n");
+    fprintf(f, " * @file    ai_policy_data.c\n");
+    fprintf(f, " * @brief   Política aprendida (GENERADO por Tools/ai_rltrain.c)\n");
+    fprintf(f, " ******************************************************************************\n");
+    fprintf(f, " * @attention\n");
+    fprintf(f, " *\n");
+    fprintf(f, " * %llu episodios, alpha %.3f, gamma %.3f, epsilon %.2f -> %.2f.\n",
+            (unsigned long long)episodes, alpha, gamma_discount, epsilon_start, epsilon_end);
+    fprintf(f, " * Posiciones con juego óptimo: %u de %u.\n", optimal, AI_TableSize);
+    fprintf(f, " *\n");
+    fprintf(f, " ******************************************************************************\n");
+    fprintf(f, " */\n\n");
+    fprintf(f, "#include \"ai_policy.h\"\n\n");
+    fprintf(f, "const uint16_t AI_PolicySize = %u;\n\n", AI_TableSize);
+
+    fprintf(f, "const uint8_t AI_PolicyPrefs[%u][BB_NUM_CELLS] = {\n", AI_TableSize);
+    for (uint16_t s = 0; s < AI_TableSize; s++) {
+        fprintf(f, "    {");
+        for (uint8_t c = 0; c < BB_NUM_CELLS; c++) {
+            uint8_t pref = AI_POLICY_OCCUPIED;
+            if (free_mask[s] & (1u << c)) {
+                pref = Quantize(atomic_load_explicit(&q_table[s][c], memory_order_relaxed));
+            }
+            fprintf(f, "%3u%s", pref, (c + 1u < BB_NUM_CELLS) ? ", " : "");
+        }
+        fprintf(f, "}%s\n", (s + 1u < AI_TableSize) ? "," : "");
+    }
+    fprintf(f, "};\n");
+
+    fclose(f);
+    return 0;
+}
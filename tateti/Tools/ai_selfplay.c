@@ -0,0 +1,569 @@
+/**
+ ******************************************************************************
+ * @file    ai_selfplay.c
+ * @brief   Torneo (PC) entre dos niveles de la IA con SPRT
+ ******************************************************************************
+ * @attention
+ *
+ * Juega partidas A contra B con AI_Player_t (ai.h) en todos los núcleos e
+ * informa la tabla de victorias/empates/derrotas, el puntaje y Elo de A con
+ * su intervalo del 95%, partidas/s y un test secuencial de razón de
+ * verosimilitud (SPRT, aproximación normal del GSPRT) entre H0: Elo = elo0
+ * y H1: Elo = elo1.
+ *
+ * - Las partidas se agrupan en lotes de --batch. Cada hilo empieza con una
+ *   porción de lotes en su propia cola y, al vaciarla, roba lotes del
+ *   frente de la cola de otro hilo (work stealing).
+ * - Cada lote siembra su propio generador a partir de --seed y del número
+ *   de lote, y cada partida deriva de él las semillas de ambos jugadores.
+ *   Los resultados dependen de --seed y --batch, pero no de la cantidad de
+ *   hilos ni del orden en que se ejecutan los lotes (salvo con --stop, que
+ *   corta al decidir el SPRT).
+ * - Las partidas pares empieza A y las impares B. Las primeras
+ *   --random-plies jugadas se eligen al azar para que los niveles
+ *   deterministas (medio, difícil) no repitan siempre la misma partida.
+ *
+ * Para comparar dos compilaciones distintas de ai.c, compilar la
+ * herramienta con cada una y comparar ambas contra el mismo rival fijo.
+ *
+ * Compilar y ejecutar desde la carpeta tateti/:
+ *   gcc -O2 -pthread -ITools/host -ICore/Inc -o ai_selfplay Tools/ai_selfplay.c \
+ *       Core/Src/ai.c Core/Src/ai_search.c Core/Src/ai_table.c \
+ *       Core/Src/ai_table_data.c Core/Src/ai_policy.c Core/Src/ai_policy_data.c \
+ *       Core/Src/bitboard.c Core/Src/game_logic.c \
+ *       Core/Src/mnk.c Core/Src/mcts.c Core/Src/ultimate.c \
+ *       Core/Src/ultimate_search.c Core/Src/nn_eval.c Core/Src/nn_model_data.c -lm
+ *   ./ai_selfplay --a hard --b medium --games 1000000
+ *
+ * Opciones:
+ *   --a NIVEL, --b NIVEL    easy, medium, hard, mcts, mcts:N (N simulaciones)
+ *                           o learned
+ *   --games N               Partidas a jugar (1000000 por defecto)
+ *   --threads N             Hilos (núcleos disponibles por defecto)
+ *   --batch N               Partidas por lote (1024 por defecto)
+ *   --seed N                Semilla base (1 por defecto)
+ *   --random-plies N        Jugadas iniciales al azar (2 por defecto)
+ *   --sprt ELO0,ELO1        Hipótesis del SPRT en Elo de A (0,10 por defecto)
+ *   --alpha X, --beta X     Errores tipo I y II del SPRT (0.05 por defecto)
+ *   --stop                  Terminar apenas el SPRT acepte una hipótesis
+ *
+ * Retorna 0 si el SPRT aceptó H1, 1 si aceptó H0 y 3 si no decidió.
+ *
+ ******************************************************************************
+ */
+
+#include <math.h>
+#include <pthread.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <time.h>
+#include <unistd.h>
+#include "stm32f4xx_hal.h"
+#include "ai.h"
+#include "game_logic.h"
+
+#define SELFPLAY_MAX_THREADS    256u
+
+/* Resultados desde el punto de vista de A, separados por quién empezó */
+typedef struct {
+    uint64_t a_wins[2];     // [0] empezó A, [1] empezó B
+    uint64_t draws[2];
+    uint64_t b_wins[2];
+} Tally_t;
+
+/* Rival del torneo */
+typedef struct {
+    AI_Difficulty_t difficulty;
+    uint32_t mcts_iterations;
+    char name[32];
+} EngineSpec_t;
+
+/* Cola de lotes de un hilo: el dueño toma del final, los demás roban del frente */
+typedef struct {
+    pthread_mutex_t lock;
+    uint32_t* batches;
+    uint32_t head;
+    uint32_t tail;
+} BatchQueue_t;
+
+/* Estado de cada hilo */
+typedef struct {
+    uint32_t id;
+    pthread_t thread;
+    MCTS_Node_t pool_a[AI_MCTS_POOL_NODES];
+    MCTS_Node_t pool_b[AI_MCTS_POOL_NODES];
+} Worker_t;
+
+/* Resultado del SPRT */
+typedef struct {
+    double llr;
+    double lower;
+    double upper;
+    int verdict;            // 1 = H1, -1 = H0, 0 = sin decidir
+    bool defined;           // false si todas las partidas dieron igual (varianza 0)
+} Sprt_t;
+
+/* Reemplazos del HAL (Tools/host/stm32f4xx_hal.h) */
+HostHAL_DWT_t HostHAL_DWT;
+HostHAL_CoreDebug_t HostHAL_CoreDebug;
+uint32_t SystemCoreClock = 168000000u;
+
+/* Configuración del torneo */
+static EngineSpec_t engine_a;
+static EngineSpec_t engine_b;
+static uint64_t num_games = 1000000u;
+static uint32_t batch_size = 1024u;
+static uint64_t base_seed = 1u;
+static uint8_t random_plies = 2u;
+static double sprt_elo0 = 0.0;
+static double sprt_elo1 = 10.0;
+static double sprt_alpha = 0.05;
+static double sprt_beta = 0.05;
+static bool stop_early = false;
+
+/* Estado compartido */
+static uint32_t num_threads;
+static uint32_t num_batches;
+static BatchQueue_t* queues;
+static pthread_mutex_t tally_lock = PTHREAD_MUTEX_INITIALIZER;
+static Tally_t tally;
+static volatile bool stop_flag = false;
+
+static bool ParseEngine(const char* text, EngineSpec_t* spec);
+static void* WorkerMain(void* arg);
+static bool TakeBatch(uint32_t id, uint32_t* batch);
+static void PlayBatch(Worker_t* w, uint32_t batch, Tally_t* out);
+static int PlayGame(Worker_t* w, uint64_t* rng, bool a_starts);
+static uint64_t SplitMix64(uint64_t* state);
+static uint64_t TallyGames(const Tally_t* t);
+static void AddTally(Tally_t* dst, const Tally_t* src);
+static Sprt_t ComputeSprt(const Tally_t* t);
+static double ScoreToElo(double score);
+static double EloToScore(double elo);
+static void PrintReport(const Tally_t* t, double seconds);
+
+uint32_t HAL_GetTick(void)
+{
+    struct timespec ts;
+    clock_gettime(CLOCK_MONOTONIC, &ts);
+    return (uint32_t)(ts.tv_sec * 1000u + ts.tv_nsec / 1000000u);
+}
+
+int main(int argc, char** argv)
+{
+    long cores = sysconf(_SC_NPROCESSORS_ONLN);
+
+    num_threads = (cores > 0) ? (uint32_t)cores : 1u;
+    ParseEngine("hard", &engine_a);
+    ParseEngine("medium", &engine_b);
+
+    for (int i = 1; i < argc; i++) {
+        if (strcmp(argv[i], "--a") == 0 && i + 1 < argc) {
+            if (!ParseEngine(argv[++i], &engine_a)) {
+                fprintf(stderr, "Nivel desconocido: %s\n", argv[i]);
+                return 2;
+            }
+        } else if (strcmp(argv[i], "--b") == 0 && i + 1 < argc) {
+            if (!ParseEngine(argv[++i], &engine_b)) {
+                fprintf(stderr, "Nivel desconocido: %s\n", argv[i]);
+                return 2;
+            }
+        } else if (strcmp(argv[i], "--games") == 0 && i + 1 < argc) {
+            num_games = strtoull(argv[++i], NULL, 10);
+        } else if (strcmp(argv[i], "--threads") == 0 && i + 1 < argc) {
+            num_threads = (uint32_t)strtoul(argv[++i], NULL, 10);
+        } else if (strcmp(argv[i], "--batch") == 0 && i + 1 < argc) {
+            batch_size = (uint32_t)strtoul(argv[++i], NULL, 10);
+        } else if (strcmp(argv[i], "--seed") == 0 && i + 1 < argc) {
+            base_seed = strtoull(argv[++i], NULL, 10);
+        } else if (strcmp(argv[i], "--random-plies") == 0 && i + 1 < argc) {
+            random_plies = (uint8_t)strtoul(argv[++i], NULL, 10);
+        } else if (strcmp(argv[i], "--sprt") == 0 && i + 1 < argc) {
+            if (sscanf(argv[++i], "%lf,%lf", &sprt_elo0, &sprt_elo1) != 2 || sprt_elo0 == sprt_elo1) {
+                fprintf(stderr, "--sprt espera ELO0,ELO1 distintos\n");
+                return 2;
+            }
+        } else if (strcmp(argv[i], "--alpha") == 0 && i + 1 < argc) {
+            sprt_alpha = atof(argv[++i]);
+        } else if (strcmp(argv[i], "--beta") == 0 && i + 1 < argc) {
+            sprt_beta = atof(argv[++i]);
+        } else if (strcmp(argv[i], "--stop") == 0) {
+            stop_early = true;
+        } else {
+            fprintf(stderr, "Opción desconocida: %s\n", argv[i]);
+            return 2;
+        }
+    }
+    if (num_games == 0 || batch_size == 0 || num_threads == 0) {
+        fprintf(stderr, "--games, --batch y --threads deben ser mayores que 0\n");
+        return 2;
+    }
+    if ((num_games + batch_size - 1u) / batch_size > UINT32_MAX) {
+        fprintf(stderr, "Demasiados lotes: aumentar --batch\n");
+        return 2;
+    }
+    num_batches = (uint32_t)((num_games + batch_size - 1u) / batch_size);
+    if (num_threads > SELFPLAY_MAX_THREADS) {
+        num_threads = SELFPLAY_MAX_THREADS;
+    }
+    if (num_threads > num_batches) {
+        num_threads = num_batches;
+    }
+
+    // Inicializa las reglas 3x3 compartidas antes de lanzar los hilos
+    AI_Player_t warmup;
+    AI_PlayerInit(&warmup, AI_MEDIUM, 1u, NULL, 0, 0);
+
+    // Reparto inicial: cada hilo recibe un tramo contiguo de lotes
+    queues = calloc(num_threads, sizeof(BatchQueue_t));
+    Worker_t* workers = calloc(num_threads, sizeof(Worker_t));
+    if (queues == NULL || workers == NULL) {
+        fprintf(stderr, "Sin memoria\n");
+        return 2;
+    }
+    for (uint32_t t = 0; t < num_threads; t++) {
+        uint32_t first = (uint32_t)((uint64_t)num_batches * t / num_threads);
+        uint32_t last = (uint32_t)((uint64_t)num_batches * (t + 1u) / num_threads);
+        BatchQueue_t* q = &queues[t];
+
+        pthread_mutex_init(&q->lock, NULL);
+        q->batches = malloc((last - first) * sizeof(uint32_t) + 1u);
+        if (q->batches == NULL) {
+            fprintf(stderr, "Sin memoria\n");
+            return 2;
+        }
+        for (uint32_t b = first; b < last; b++) {
+            q->batches[b - first] = b;
+        }
+        q->head = 0;
+        q->tail = last - first;
+    }
+
+    fprintf(stderr, "%s contra %s: %llu partidas, %u hilos, lotes de %u\n", engine_a.name,
+            engine_b.name, (unsigned long long)num_games, num_threads, batch_size);
+
+    struct timespec start;
+    struct timespec end;
+    clock_gettime(CLOCK_MONOTONIC, &start);
+    for (uint32_t t = 0; t < num_threads; t++) {
+        workers[t].id = t;
+        if (pthread_create(&workers[t].thread, NULL, WorkerMain, &workers[t]) != 0) {
+            fprintf(stderr, "No se pudo crear el hilo %u\n", t);
+            return 2;
+        }
+    }
+    for (uint32_t t = 0; t < num_threads; t++) {
+        pthread_join(workers[t].thread, NULL);
+    }
+    clock_gettime(CLOCK_MONOTONIC, &end);
+
+    double seconds = (double)(end.tv_sec - start.tv_sec) + (end.tv_nsec - start.tv_nsec) * 1e-9;
+    PrintReport(&tally, seconds);
+
+    for (uint32_t t = 0; t < num_threads; t++) {
+        pthread_mutex_destroy(&queues[t].lock);
+        free(queues[t].batches);
+    }
+    free(queues);
+    free(workers);
+
+    Sprt_t sprt = ComputeSprt(&tally);
+    if (sprt.verdict > 0) {
+        return 0;
+    }
+    return (sprt.verdict < 0) ? 1 : 3;
+}
+
+/**
+ * @brief  Interpreta "easy", "medium", "hard", "mcts", "mcts:N" o "learned"
+ * @retval false si el nombre no corresponde a ningún nivel
+ */
+static bool ParseEngine(const char* text, EngineSpec_t* spec)
+{
+    static const char* const names[] = {"easy", "medium", "hard", "mcts", "learned"};
+    size_t len = strcspn(text, ":");
+
+    spec->mcts_iterations = AI_MCTS_ITERATIONS;
+    for (uint8_t i = 0; i < sizeof(names) / sizeof(names[0]); i++) {
+        if (strlen(names[i]) == len && strncmp(text, names[i], len) == 0) {
+            spec->difficulty = (AI_Difficulty_t)i;
+            if (text[len] == ':') {
+                if (spec->difficulty != AI_MCTS || atol(&text[len + 1u]) <= 0) {
+                    return false;
+                }
+                spec->mcts_iterations = (uint32_t)atol(&text[len + 1u]);
+            }
+            snprintf(spec->name, sizeof(spec->name), "%s", text);
+            return true;
+        }
+    }
+    return false;
+}
+
+/**
+ * @brief  Juega lotes hasta que no quede ninguno (propio o robado)
+ */
+static void* WorkerMain(void* arg)
+{
+    Worker_t* w = (Worker_t*)arg;
+    uint32_t batch;
+
+    while (!stop_flag && TakeBatch(w->id, &batch)) {
+        Tally_t local;
+        memset(&local, 0, sizeof(local));
+        PlayBatch(w, batch, &local);
+
+        pthread_mutex_lock(&tally_lock);
+        AddTally(&tally, &local);
+        if (stop_early && ComputeSprt(&tally).verdict != 0) {
+            stop_flag = true;
+        }
+        pthread_mutex_unlock(&tally_lock);
+    }
+    return NULL;
+}
+
+/**
+ * @brief  Toma el último lote de la cola propia o roba el primero de otra
+ * @retval false si todas las colas están vacías
+ */
+static bool TakeBatch(uint32_t id, uint32_t* batch)
+{
+    BatchQueue_t* own = &queues[id];
+
+    pthread_mutex_lock(&own->lock);
+    if (own->head < own->tail) {
+        *batch = own->batches[--own->tail];
+        pthread_mutex_unlock(&own->lock);
+        return true;
+    }
+    pthread_mutex_unlock(&own->lock);
+
+    // Robar del frente empezando por el hilo siguiente, así los ladrones se reparten
+    for (uint32_t k = 1; k < num_threads; k++) {
+        BatchQueue_t* victim = &queues[(id + k) % num_threads];
+
+        pthread_mutex_lock(&victim->lock);
+        if (victim->head < victim->tail) {
+            *batch = victim->batches[victim->head++];
+            pthread_mutex_unlock(&victim->lock);
+            return true;
+        }
+        pthread_mutex_unlock(&victim->lock);
+    }
+    return false;
+}
+
+/**
+ * @brief  Juega todas las partidas de un lote con su propio generador
+ */
+static void PlayBatch(Worker_t* w, uint32_t batch, Tally_t* out)
+{
+    uint64_t first = (uint64_t)batch * batch_size;
+    uint64_t last = first + batch_size;
+    uint64_t rng = base_seed ^ ((uint64_t)batch * 0xD1B54A32D192ED03ull);
+
+    if (last > num_games) {
+        last = num_games;
+    }
+    SplitMix64(&rng);
+
+    for (uint64_t game = first; game < last; game++) {
+        bool a_starts = (game % 2u) == 0;
+        uint8_t slot = a_starts ? 0u : 1u;
+        int result = PlayGame(w, &rng, a_starts);
+
+        if (result > 0) {
+            out->a_wins[slot]++;
+        } else if (result < 0) {
+            out->b_wins[slot]++;
+        } else {
+            out->draws[slot]++;
+        }
+    }
+}
+
+/**
+ * @brief  Juega una partida completa
+ * @param  rng: Generador del lote (avanza)
+ * @param  a_starts: true si A juega con las fichas del jugador 1
+ * @retval 1 si gana A, -1 si gana B, 0 si es empate
+ */
+static int PlayGame(Worker_t* w, uint64_t* rng, bool a_starts)
+{
+    AI_Player_t player_a;
+    AI_Player_t player_b;
+    GameContext_t ctx;
+    CellState_t side = CELL_PLAYER1;
+
+    AI_PlayerInit(&player_a, engine_a.difficulty, (uint32_t)SplitMix64(rng), w->pool_a,
+                  AI_MCTS_POOL_NODES, engine_a.mcts_iterations);
+    AI_PlayerInit(&player_b, engine_b.difficulty, (uint32_t)SplitMix64(rng), w->pool_b,
+                  AI_MCTS_POOL_NODES, engine_b.mcts_iterations);
+    GameCtx_Init(&ctx);
+
+    for (uint8_t ply = 0; ply < BB_NUM_CELLS; ply++) {
+        Bitboard_t board = GameCtx_GetBitboard(&ctx);
+        uint16_t empty = Bitboard_Empty(&board);
+        uint8_t position;
+
+        if (ply < random_plies) {
+            uint8_t skip = (uint8_t)(SplitMix64(rng) % Bitboard_Count(empty));
+            while (skip--) {
+                Bitboard_PopLowest(&empty);
+            }
+            position = Bitboard_PopLowest(&empty);
+        } else {
+            bool a_to_move = (side == CELL_PLAYER1) == a_starts;
+            position = AI_PlayerMove(a_to_move ? &player_a : &player_b, &ctx, side);
+        }
+
+        GameCtx_MakeMove(&ctx, position, side);
+        if (GameCtx_CheckWin(&ctx) != WIN_NONE) {
+            return ((side == CELL_PLAYER1) == a_starts) ? 1 : -1;
+        }
+        side = (side == CELL_PLAYER1) ? CELL_PLAYER2 : CELL_PLAYER1;
+    }
+    return 0;
+}
+
+/**
+ * @brief  Generador splitmix64 (semillas de lotes y jugadores)
+ */
+static uint64_t SplitMix64(uint64_t* state)
+{
+    uint64_t z = (*state += 0x9E3779B97F4A7C15ull);
+    z = (z ^ (z >> 30)) * 0xBF58476D1CE4E5B9ull;
+    z = (z ^ (z >> 27)) * 0x94D049BB133111EBull;
+    return z ^ (z >> 31);
+}
+
+/**
+ * @brief  Total de partidas de una tabla
+ */
+static uint64_t TallyGames(const Tally_t* t)
+{
+    return t->a_wins[0] + t->a_wins[1] + t->draws[0] + t->draws[1] + t->b_wins[0] + t->b_wins[1];
+}
+
+/**
+ * @brief  Acumula una tabla sobre otra
+ */
+static void AddTally(Tally_t* dst, const Tally_t* src)
+{
+    for (uint8_t i = 0; i < 2u; i++) {
+        dst->a_wins[i] += src->a_wins[i];
+        dst->draws[i] += src->draws[i];
+        dst->b_wins[i] += src->b_wins[i];
+    }
+}
+
+/**
+ * @brief  SPRT con la aproximación normal del GSPRT sobre el puntaje por partida
+ * @note   LLR = N (s1 - s0) (2 s - s0 - s1) / (2 var), con s el puntaje medio
+ *         de A, var su varianza por partida y s0/s1 los puntajes de elo0/elo1
+ */
+static Sprt_t ComputeSprt(const Tally_t* t)
+{
+    Sprt_t r;
+    uint64_t n = TallyGames(t);
+    double wins = (double)(t->a_wins[0] + t->a_wins[1]);
+    double draws = (double)(t->draws[0] + t->draws[1]);
+    double losses = (double)(t->b_wins[0] + t->b_wins[1]);
+
+    r.lower = log(sprt_beta / (1.0 - sprt_alpha));
+    r.upper = log((1.0 - sprt_beta) / sprt_alpha);
+    r.llr = 0.0;
+    r.verdict = 0;
+    r.defined = false;
+    if (n == 0) {
+        return r;
+    }
+
+    double s = (wins + 0.5 * draws) / (double)n;
+    double var = (wins * (1.0 - s) * (1.0 - s) + draws * (0.5 - s) * (0.5 - s) +
+                  losses * s * s) / (double)n;
+    if (var <= 0.0) {
+        return r;  // Todas las partidas iguales: no hay información para el test
+    }
+
+    double s0 = EloToScore(sprt_elo0);
+    double s1 = EloToScore(sprt_elo1);
+    r.llr = (double)n * (s1 - s0) * (2.0 * s - s0 - s1) / (2.0 * var);
+    r.defined = true;
+    if (r.llr >= r.upper) {
+        r.verdict = 1;
+    } else if (r.llr <= r.lower) {
+        r.verdict = -1;
+    }
+    return r;
+}
+
+/**
+ * @brief  Elo equivalente a un puntaje medio (0 a 1)
+ */
+static double ScoreToElo(double score)
+{
+    if (score <= 0.0) {
+        return -INFINITY;
+    }
+    if (score >= 1.0) {
+        return INFINITY;
+    }
+    return -400.0 * log10(1.0 / score - 1.0);
+}
+
+/**
+ * @brief  Puntaje medio esperado para una diferencia de Elo
+ */
+static double EloToScore(double elo)
+{
+    return 1.0 / (1.0 + pow(10.0, -elo / 400.0));
+}
+
+/**
+ * @brief  Imprime la tabla de resultados, el Elo de A y el SPRT
+ */
+static void PrintReport(const Tally_t* t, double seconds)
+{
+    static const char* const rows[] = {"empieza A", "empieza B"};
+    uint64_t n = TallyGames(t);
+    Sprt_t sprt = ComputeSprt(t);
+
+    printf("A = %s, B = %s\n", engine_a.name, engine_b.name);
+    printf("%-12s %12s %12s %12s\n", "", "gana A", "empate", "gana B");
+    for (uint8_t i = 0; i < 2u; i++) {
+        printf("%-12s %12llu %12llu %12llu\n", rows[i], (unsigned long long)t->a_wins[i],
+               (unsigned long long)t->draws[i], (unsigned long long)t->b_wins[i]);
+    }
+    printf("%-12s %12llu %12llu %12llu\n", "total",
+           (unsigned long long)(t->a_wins[0] + t->a_wins[1]),
+           (unsigned long long)(t->draws[0] + t->draws[1]),
+           (unsigned long long)(t->b_wins[0] + t->b_wins[1]));
+
+    if (n == 0) {
+        return;
+    }
+    double wins = (double)(t->a_wins[0] + t->a_wins[1]);
+    double draws = (double)(t->draws[0] + t->draws[1]);
+    double losses = (double)(t->b_wins[0] + t->b_wins[1]);
+    double s = (wins + 0.5 * draws) / (double)n;
+    double var = (wins * (1.0 - s) * (1.0 - s) + draws * (0.5 - s) * (0.5 - s) +
+                  losses * s * s) / (double)n;
+    double margin = 1.96 * sqrt(var / (double)n);
+
+    printf("partidas %llu en %.2f s (%.0f partidas/s)\n", (unsigned long long)n, seconds,
+           (seconds > 0.0) ? (double)n / seconds : 0.0);
+    printf("puntaje A %.4f +- %.4f, Elo %+.1f [%+.1f, %+.1f]\n", s, margin, ScoreToElo(s),
+           ScoreToElo(s - margin), ScoreToElo(s + margin));
+
+    if (!sprt.defined) {
+        printf("SPRT [%.1f, %.1f]: sin varianza (todas las partidas dieron igual)\n", sprt_elo0,
+               sprt_elo1);
+        return;
+    }
+    printf("SPRT [%.1f, %.1f] alpha=%.3f beta=%.3f: LLR %.2f (%.2f, %.2f) -> %s\n", sprt_elo0,
+           sprt_elo1, sprt_alpha, sprt_beta, sprt.llr, sprt.lower, sprt.upper,
+           (sprt.verdict > 0) ? "H1 aceptada" : (sprt.verdict < 0) ? "H0 aceptada" : "sin decidir");
+}
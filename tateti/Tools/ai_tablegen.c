@@ -0,0 +1,295 @@
+/**
+ ******************************************************************************
+ * @file    ai_tablegen.c
+ * @brief   Generador (PC) de la tabla de juego perfecto de la IA difícil
+ ******************************************************************************
+ * @attention
+ *
+ * Recorre todas las posiciones alcanzables en las que mueve el jugador 2
+ * (empiece quien empiece), las reduce a su forma canónica, resuelve cada
+ * una con AISearch_BestMove y escribe Core/Src/ai_table_data.c en el
+ * formato de ai_table.h (índice denso de AITable_PositionIndex, jugadas en
+ * nibbles y valores en 2 bits).
+ * Después verifica la tabla posición por posición (sin reducir) contra la
+ * búsqueda: la jugada de la tabla debe obtener el mismo puntaje óptimo.
+ *
+ * Compilar y ejecutar desde la carpeta tateti/ (ai_table.c da el índice;
+ * la tabla anterior solo hace falta para enlazar):
+ *   gcc -O2 -ICore/Inc -o ai_tablegen Tools/ai_tablegen.c \
+ *       Core/Src/bitboard.c Core/Src/ai_search.c Core/Src/ai_table.c \
+ *       Core/Src/ai_table_data.c
+ *   ./ai_tablegen Core/Src/ai_table_data.c
+ *
+ * Retorna distinto de 0 si la verificación falla.
+ *
+ ******************************************************************************
+ */
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <time.h>
+#include "bitboard.h"
+#include "ai_search.h"
+#include "ai_table.h"
+
+#define MAX_ENTRIES  2048u
+#define NUM_KEYS     (1u << (2 * BB_NUM_CELLS))
+
+/* Entrada en construcción, ordenada por índice denso */
+typedef struct {
+    uint16_t code;      // AITable_PositionIndex de la forma canónica
+    uint32_t key;       // Bitboard_Key de la forma canónica
+    uint8_t move;       // Jugada en la orientación canónica
+    AI_TableValue_t value;
+} GenEntry_t;
+
+/* Tabla en construcción (mismo formato que ai_table_data.c) */
+static GenEntry_t gen[MAX_ENTRIES];
+static uint16_t gen_size = 0;
+static uint32_t gen_bits[AI_TABLE_INDEX_WORDS];
+static uint16_t gen_rank[AI_TABLE_INDEX_WORDS];
+static uint8_t gen_moves[(MAX_ENTRIES + 1u) / 2u];
+static uint8_t gen_values[(MAX_ENTRIES + 3u) / 4u];
+
+/* Posiciones ya visitadas, indexadas por Bitboard_Key */
+static uint8_t visited[NUM_KEYS];
+static uint8_t canonical_seen[NUM_KEYS];
+
+static void Collect(Bitboard_t board, bool p2_to_move);
+static int CompareEntries(const void* a, const void* b);
+static bool LookupGenerated(const Bitboard_t* board, uint8_t* move_out, AI_TableValue_t* value_out);
+static uint32_t Verify(Bitboard_t board, bool p2_to_move, uint32_t* checked);
+static int WriteTable(const char* path);
+
+int main(int argc, char** argv)
+{
+    const char* path = (argc > 1) ? argv[1] : "ai_table_data.c";
+    Bitboard_t empty_board = {0, 0};
+
+    // 1. Recolectar posiciones canónicas (empieza P1 o empieza P2)
+    Collect(empty_board, false);
+    Collect(empty_board, true);
+
+    // 2. Resolver cada posición canónica
+    for (uint16_t i = 0; i < gen_size; i++) {
+        Bitboard_t board = {
+            .p1 = (uint16_t)(gen[i].key & BB_FULL_MASK),
+            .p2 = (uint16_t)(gen[i].key >> BB_NUM_CELLS)
+        };
+        int8_t score;
+        gen[i].code = AITable_PositionIndex(&board);
+        gen[i].move = AISearch_BestMove(board, true, &score);
+        gen[i].value = (score > 0) ? AI_VALUE_WIN :
+                       (score < 0) ? AI_VALUE_LOSS : AI_VALUE_DRAW;
+        if (gen[i].code >= AI_TABLE_INDEX_SIZE) {
+            fprintf(stderr, "Posicion 0x%05X fuera del indice\n", gen[i].key);
+            return 2;
+        }
+    }
+
+    // 3. Ordenar por índice denso, marcar los bits y empaquetar
+    qsort(gen, gen_size, sizeof(gen[0]), CompareEntries);
+    for (uint16_t i = 0; i < gen_size; i++) {
+        gen_bits[gen[i].code / 32u] |= 1u << (gen[i].code % 32u);
+        gen_moves[i / 2u] |= (uint8_t)(gen[i].move << ((i % 2u) * 4u));
+        gen_values[i / 4u] |= (uint8_t)(gen[i].value << ((i % 4u) * 2u));
+    }
+    for (uint16_t w = 1; w < AI_TABLE_INDEX_WORDS; w++) {
+        gen_rank[w] = (uint16_t)(gen_rank[w - 1u] + __builtin_popcount(gen_bits[w - 1u]));
+    }
+
+    // 4. Verificar todas las posiciones reales contra la búsqueda
+    uint32_t checked = 0;
+    for (uint32_t k = 0; k < NUM_KEYS; k++) visited[k] = 0;
+    uint32_t errors = Verify(empty_board, false, &checked) + Verify(empty_board, true, &checked);
+
+    // 5. Medir la consulta
+    clock_t start = clock();
+    volatile uint8_t sink = 0;
+    const uint32_t rounds = 2000000u;
+    for (uint32_t r = 0; r < rounds; r++) {
+        Bitboard_t board = {
+            .p1 = (uint16_t)(gen[r % gen_size].key & BB_FULL_MASK),
+            .p2 = (uint16_t)(gen[r % gen_size].key >> BB_NUM_CELLS)
+        };
+        uint8_t move;
+        LookupGenerated(&board, &move, NULL);
+        sink = (uint8_t)(sink + move);
+    }
+    double ns = (double)(clock() - start) * 1e9 / CLOCKS_PER_SEC / rounds;
+
+    printf("Posiciones canonicas: %u (%u bytes)\n", gen_size,
+           (unsigned)(sizeof(gen_bits) + sizeof(gen_rank) + (gen_size + 1u) / 2u + (gen_size + 3u) / 4u));
+    printf("Posiciones verificadas: %u, errores: %u\n", checked, errors);
+    printf("Consulta: %.1f ns\n", ns);
+
+    if (errors != 0) {
+        return 1;
+    }
+    return WriteTable(path);
+}
+
+/**
+ * @brief  Recorre el árbol de juego y agrega las posiciones canónicas con
+ *         turno de P2 que no son terminales
+ */
+static void Collect(Bitboard_t board, bool p2_to_move)
+{
+    uint32_t key = Bitboard_Key(&board);
+    if (visited[key] & (p2_to_move ? 2u : 1u)) {
+        return;
+    }
+    visited[key] |= (p2_to_move ? 2u : 1u);
+
+    if (Bitboard_HasWin(board.p1) || Bitboard_HasWin(board.p2)) return;
+    uint16_t empty = Bitboard_Empty(&board);
+    if (empty == 0) return;
+
+    if (p2_to_move) {
+        uint32_t canonical = Bitboard_Canonical(&board, NULL);
+        if (!canonical_seen[canonical]) {
+            canonical_seen[canonical] = 1;
+            if (gen_size >= MAX_ENTRIES) {
+                fprintf(stderr, "MAX_ENTRIES insuficiente\n");
+                exit(2);
+            }
+            gen[gen_size++].key = canonical;
+        }
+    }
+
+    while (empty) {
+        uint16_t bit = (uint16_t)(1u << Bitboard_PopLowest(&empty));
+        Bitboard_t child = board;
+        if (p2_to_move) child.p2 |= bit; else child.p1 |= bit;
+        Collect(child, !p2_to_move);
+    }
+}
+
+static int CompareEntries(const void* a, const void* b)
+{
+    uint16_t x = ((const GenEntry_t*)a)->code;
+    uint16_t y = ((const GenEntry_t*)b)->code;
+    return (x > y) - (x < y);
+}
+
+/**
+ * @brief  Misma consulta que AITable_Lookup, sobre la tabla recién generada
+ */
+static bool LookupGenerated(const Bitboard_t* board, uint8_t* move_out, AI_TableValue_t* value_out)
+{
+    uint8_t sym;
+    uint32_t key = Bitboard_Canonical(board, &sym);
+    Bitboard_t canonical = {(uint16_t)(key & BB_FULL_MASK), (uint16_t)(key >> BB_NUM_CELLS)};
+    uint16_t code = AITable_PositionIndex(&canonical);
+
+    if (code >= AI_TABLE_INDEX_SIZE) return false;
+    uint32_t bit = 1u << (code % 32u);
+    if ((gen_bits[code / 32u] & bit) == 0) return false;
+    uint16_t index = (uint16_t)(gen_rank[code / 32u] + __builtin_popcount(gen_bits[code / 32u] & (bit - 1u)));
+
+    uint8_t move = (uint8_t)((gen_moves[index / 2u] >> ((index % 2u) * 4u)) & AI_TABLE_MOVE_MASK);
+    uint16_t real_bit = Bitboard_InverseTransform((uint16_t)(1u << move), sym);
+    *move_out = (uint8_t)__builtin_ctz(real_bit);
+    if (value_out != NULL) {
+        *value_out = (AI_TableValue_t)((gen_values[index / 4u] >> ((index % 4u) * 2u)) & AI_TABLE_VALUE_MASK);
+    }
+    return true;
+}
+
+/**
+ * @brief  Verifica la tabla en todas las posiciones alcanzables
+ * @retval Cantidad de errores encontrados
+ */
+static uint32_t Verify(Bitboard_t board, bool p2_to_move, uint32_t* checked)
+{
+    uint32_t key = Bitboard_Key(&board);
+    if (visited[key] & (p2_to_move ? 2u : 1u)) return 0;
+    visited[key] |= (p2_to_move ? 2u : 1u);
+
+    if (Bitboard_HasWin(board.p1) || Bitboard_HasWin(board.p2)) return 0;
+    uint16_t empty = Bitboard_Empty(&board);
+    if (empty == 0) return 0;
+
+    uint32_t errors = 0;
+    if (p2_to_move) {
+        uint8_t move;
+        AI_TableValue_t value;
+        int8_t best_score;
+        AISearch_BestMove(board, true, &best_score);
+        (*checked)++;
+
+        if (!LookupGenerated(&board, &move, &value) || !(empty & (1u << move))) {
+            errors++;
+        } else {
+            int8_t score = (int8_t)-AISearch_Negamax(board.p1, (uint16_t)(board.p2 | (1u << move)), 0,
+                                                     -AI_SEARCH_SCORE_INF, AI_SEARCH_SCORE_INF);
+            AI_TableValue_t expected = (best_score > 0) ? AI_VALUE_WIN :
+                                       (best_score < 0) ? AI_VALUE_LOSS : AI_VALUE_DRAW;
+            if (score != best_score || value != expected) {
+                errors++;
+            }
+        }
+    }
+
+    while (empty) {
+        uint16_t bit = (uint16_t)(1u << Bitboard_PopLowest(&empty));
+        Bitboard_t child = board;
+        if (p2_to_move) child.p2 |= bit; else child.p1 |= bit;
+        errors += Verify(child, !p2_to_move, checked);
+    }
+    return errors;
+}
+
+/**
+ * @brief  Escribe la tabla como fuente C para el firmware
+ */
+static int WriteTable(const char* path)
+{
+    FILE* f = fopen(path, "w");
+    if (f == NULL) {
+        perror(path);
+        return 1;
+    }
+
+    fprintf(f, "/**\n");
+    fprintf(f, " ******************************************************************************\n");
+    fprintf(f, " * @file    ai_table_data.c\n");
+    fprintf(f, " * @brief   Tabla de juego perfecto (GENERADO por Tools/ai_tablegen.c)\n");
+    fprintf(f, " ******************************************************************************\n");
+    fprintf(f, " */\n\n");
+    fprintf(f, "#include \"ai_table.h\"\n\n");
+    fprintf(f, "const uint16_t AI_TableSize = %u;\n\n", gen_size);
+
+    fprintf(f, "const uint32_t AI_TableIndexBits[AI_TABLE_INDEX_WORDS] = {");
+    for (uint16_t w = 0; w < AI_TABLE_INDEX_WORDS; w++) {
+        fprintf(f, "%s0x%08X%s", (w % 6 == 0) ? "\n    " : " ", gen_bits[w],
+                (w + 1u < AI_TABLE_INDEX_WORDS) ? "," : "");
+    }
+    fprintf(f, "\n};\n\n");
+
+    fprintf(f, "const uint16_t AI_TableIndexRank[AI_TABLE_INDEX_WORDS] = {");
+    for (uint16_t w = 0; w < AI_TABLE_INDEX_WORDS; w++) {
+        fprintf(f, "%s%3u%s", (w % 12 == 0) ? "\n    " : " ", gen_rank[w],
+                (w + 1u < AI_TABLE_INDEX_WORDS) ? "," : "");
+    }
+    fprintf(f, "\n};\n\n");
+
+    uint16_t move_bytes = (uint16_t)((gen_size + 1u) / 2u);
+    fprintf(f, "const uint8_t AI_TableMoves[%u] = {", move_bytes);
+    for (uint16_t i = 0; i < move_bytes; i++) {
+        fprintf(f, "%s0x%02X%s", (i % 12 == 0) ? "\n    " : " ", gen_moves[i],
+                (i + 1u < move_bytes) ? "," : "");
+    }
+    fprintf(f, "\n};\n\n");
+
+    uint16_t value_bytes = (uint16_t)((gen_size + 3u) / 4u);
+    fprintf(f, "const uint8_t AI_TableValues[%u] = {", value_bytes);
+    for (uint16_t i = 0; i < value_bytes; i++) {
+        fprintf(f, "%s0x%02X%s", (i % 12 == 0) ? "\n    " : " ", gen_values[i],
+                (i + 1u < value_bytes) ? "," : "");
+    }
+    fprintf(f, "\n};\n");
+
+    fclose(f);
+    return 0;
+}
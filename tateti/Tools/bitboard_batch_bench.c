@@ -0,0 +1,256 @@
+/**
+ ******************************************************************************
+ * @file    bitboard_batch_bench.c
+ * @brief   Benchmark (PC) de la evaluación por lotes de bitboard_batch.c
+ ******************************************************************************
+ * @attention
+ *
+ * 1. Verifica los 3^9 tableros (también los imposibles, con líneas de los
+ *    dos jugadores) y el lote al azar de la medición:
+ *    Bitboard_BatchEvaluate y Bitboard_BatchEvaluateScalar tienen que dar
+ *    lo mismo que Game_CheckWinBitboard más "tablero lleno sin línea".
+ * 2. Mide tableros/s de cada forma de evaluar el mismo lote:
+ *    - checkwin_bitboard: Game_CheckWinBitboard + Bitboard_Empty, de a uno
+ *      (lo que calcula Game_CheckWin sin el contexto incremental); la
+ *      columna speedup es relativa a esta fila
+ *    - checkwin_on: Game_CheckWinOn sobre arreglos de CellState_t
+ *    - batch_scalar: Bitboard_BatchEvaluateScalar (núcleo de la placa)
+ *    - batch_simd: Bitboard_BatchEvaluate (AVX2 o SSE2 según la compilación)
+ *
+ * Imprime CSV por stdout y retorna 1 si algún resultado difiere.
+ * Compilar y ejecutar desde la carpeta tateti/ (-march=native activa AVX2
+ * si la PC lo tiene; sin esa opción se usa SSE2):
+ *   gcc -O2 -march=native -ICore/Inc -o bitboard_batch_bench \
+ *       Tools/bitboard_batch_bench.c Core/Src/bitboard_batch.c \
+ *       Core/Src/bitboard.c Core/Src/game_logic.c
+ *   ./bitboard_batch_bench
+ *
+ * Opciones:
+ *   --boards N         Tableros del lote (1000000 por defecto)
+ *   --repeat N         Pasadas sobre el lote por medición (20 por defecto)
+ *   --seed N           Semilla (1 por defecto)
+ *
+ ******************************************************************************
+ */
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <time.h>
+#include "bitboard_batch.h"
+#include "game_logic.h"
+
+#define BENCH_ALL_BOARDS    19683u  // 3^9
+
+typedef enum {
+    METHOD_CHECKWIN_BITBOARD = 0,   // Referencia de la columna speedup
+    METHOD_CHECKWIN_ON,
+    METHOD_BATCH_SCALAR,
+    METHOD_BATCH_SIMD,
+    METHOD_COUNT
+} Method_t;
+
+static const char* const method_names[METHOD_COUNT] = {
+    "checkwin_bitboard", "checkwin_on", "batch_scalar", "batch_simd"
+};
+
+static uint64_t NowNs(void);
+static uint32_t NextRandom(uint32_t* rng);
+static Bitboard_t DecodeBoard(uint32_t code);
+static uint8_t Expected(const Bitboard_t* board);
+static bool Check(const Bitboard_t boards[], uint32_t count);
+static void RunMethod(Method_t method, const Bitboard_t boards[], const CellState_t (*cells)[9],
+                      uint8_t results[], uint32_t count);
+
+int main(int argc, char** argv)
+{
+    uint32_t count = 1000000u;
+    uint32_t repeat = 20u;
+    uint32_t rng = 1u;
+
+    for (int i = 1; i < argc; i++) {
+        if (strcmp(argv[i], "--boards") == 0 && i + 1 < argc) {
+            count = (uint32_t)strtoul(argv[++i], NULL, 10);
+        } else if (strcmp(argv[i], "--repeat") == 0 && i + 1 < argc) {
+            repeat = (uint32_t)strtoul(argv[++i], NULL, 10);
+        } else if (strcmp(argv[i], "--seed") == 0 && i + 1 < argc) {
+            rng = (uint32_t)strtoul(argv[++i], NULL, 10);
+        } else {
+            fprintf(stderr, "Opción desconocida: %s\n", argv[i]);
+            return 2;
+        }
+    }
+    if (count == 0 || repeat == 0) {
+        fprintf(stderr, "--boards y --repeat tienen que ser mayores que 0\n");
+        return 2;
+    }
+    if (rng == 0) {
+        rng = 1u;
+    }
+
+    Bitboard_t* boards = malloc((size_t)count * sizeof(Bitboard_t));
+    CellState_t (*cells)[9] = malloc((size_t)count * sizeof(*cells));
+    uint8_t* results = malloc(count);
+    if (boards == NULL || cells == NULL || results == NULL) {
+        fprintf(stderr, "Sin memoria\n");
+        return 2;
+    }
+
+    // 1. Exactitud: los 3^9 tableros (19683, no es múltiplo del ancho SIMD) y el lote
+    static Bitboard_t all_boards[BENCH_ALL_BOARDS];
+    for (uint32_t code = 0; code < BENCH_ALL_BOARDS; code++) {
+        all_boards[code] = DecodeBoard(code);
+    }
+    for (uint32_t i = 0; i < count; i++) {
+        boards[i] = all_boards[NextRandom(&rng) % BENCH_ALL_BOARDS];
+        for (uint8_t c = 0; c < BB_NUM_CELLS; c++) {
+            cells[i][c] = (boards[i].p1 & (1u << c)) ? CELL_PLAYER1 :
+                          (boards[i].p2 & (1u << c)) ? CELL_PLAYER2 : CELL_EMPTY;
+        }
+    }
+    if (!Check(all_boards, BENCH_ALL_BOARDS) || !Check(boards, count)) {
+        return 1;
+    }
+
+    // 2. Tableros por segundo
+    printf("method,kernel,boards,ns_per_board,boards_per_s,speedup\n");
+    double baseline_ns = 0.0;
+    for (uint8_t m = 0; m < METHOD_COUNT; m++) {
+        uint64_t best = UINT64_MAX;
+
+        // La mejor de tres mediciones, para no contar interrupciones del sistema
+        for (uint8_t run = 0; run < 3u; run++) {
+            uint64_t start = NowNs();
+            for (uint32_t r = 0; r < repeat; r++) {
+                RunMethod((Method_t)m, boards, (const CellState_t (*)[9])cells, results, count);
+            }
+            uint64_t elapsed = NowNs() - start;
+            best = (elapsed < best) ? elapsed : best;
+        }
+
+        double ns = (double)best / ((double)count * repeat);
+        if (m == METHOD_CHECKWIN_BITBOARD) {
+            baseline_ns = ns;
+        }
+        printf("%s,%s,%u,%.3f,%.0f,%.2f\n", method_names[m],
+               (m == METHOD_BATCH_SIMD) ? Bitboard_BatchKernel() : "scalar", count, ns, 1e9 / ns,
+               baseline_ns / ns);
+    }
+
+    free(boards);
+    free(cells);
+    free(results);
+    return 0;
+}
+
+/**
+ * @brief  Reloj de la PC en nanosegundos
+ */
+static uint64_t NowNs(void)
+{
+    struct timespec ts;
+    clock_gettime(CLOCK_MONOTONIC, &ts);
+    return (uint64_t)ts.tv_sec * 1000000000u + (uint64_t)ts.tv_nsec;
+}
+
+/**
+ * @brief  Generador xorshift32
+ */
+static uint32_t NextRandom(uint32_t* rng)
+{
+    uint32_t x = *rng;
+    x ^= x << 13;
+    x ^= x >> 17;
+    x ^= x << 5;
+    *rng = x;
+    return x;
+}
+
+/**
+ * @brief  Tablero número code en base 3 (0 = vacía, 1 = P1, 2 = P2)
+ */
+static Bitboard_t DecodeBoard(uint32_t code)
+{
+    Bitboard_t board = {0, 0};
+
+    for (uint8_t i = 0; i < BB_NUM_CELLS; i++) {
+        uint8_t cell = (uint8_t)(code % 3u);
+        code /= 3u;
+        if (cell == 1u) board.p1 |= (uint16_t)(1u << i);
+        if (cell == 2u) board.p2 |= (uint16_t)(1u << i);
+    }
+    return board;
+}
+
+/**
+ * @brief  Resultado esperado según game_logic
+ */
+static uint8_t Expected(const Bitboard_t* board)
+{
+    WinType_t win = Game_CheckWinBitboard(board);
+
+    if (win == WIN_NONE && Bitboard_Empty(board) == 0) {
+        return BB_BATCH_DRAW;
+    }
+    return (uint8_t)win;
+}
+
+/**
+ * @brief  Compara los dos núcleos del lote contra Expected
+ */
+static bool Check(const Bitboard_t boards[], uint32_t count)
+{
+    uint8_t* simd = malloc(count + 1u);
+    uint8_t* scalar = malloc(count + 1u);
+    bool ok = (simd != NULL && scalar != NULL);
+
+    // Centinela: el núcleo SIMD no puede escribir más allá del lote
+    if (ok) {
+        simd[count] = 0x5Au;
+        Bitboard_BatchEvaluate(boards, simd, count);
+        Bitboard_BatchEvaluateScalar(boards, scalar, count);
+        if (simd[count] != 0x5Au) {
+            fprintf(stderr, "Bitboard_BatchEvaluate escribió fuera del lote\n");
+            ok = false;
+        }
+    }
+    for (uint32_t i = 0; ok && i < count; i++) {
+        uint8_t expected = Expected(&boards[i]);
+        if (simd[i] != expected || scalar[i] != expected) {
+            fprintf(stderr, "Tablero p1=0x%03X p2=0x%03X: esperado 0x%02X, SIMD 0x%02X, escalar 0x%02X\n",
+                    boards[i].p1, boards[i].p2, expected, simd[i], scalar[i]);
+            ok = false;
+        }
+    }
+    free(simd);
+    free(scalar);
+    return ok;
+}
+
+/**
+ * @brief  Evalúa el lote completo con un método
+ */
+static void RunMethod(Method_t method, const Bitboard_t boards[], const CellState_t (*cells)[9],
+                      uint8_t results[], uint32_t count)
+{
+    switch (method) {
+        case METHOD_CHECKWIN_ON:
+            for (uint32_t i = 0; i < count; i++) {
+                WinType_t win = Game_CheckWinOn(cells[i]);
+                results[i] = (win == WIN_NONE && Bitboard_Empty(&boards[i]) == 0) ?
+                             BB_BATCH_DRAW : (uint8_t)win;
+            }
+            break;
+        case METHOD_CHECKWIN_BITBOARD:
+            for (uint32_t i = 0; i < count; i++) {
+                results[i] = Expected(&boards[i]);
+            }
+            break;
+        case METHOD_BATCH_SCALAR:
+            Bitboard_BatchEvaluateScalar(boards, results, count);
+            break;
+        default:
+            Bitboard_BatchEvaluate(boards, results, count);
+            break;
+    }
+}
@@ -0,0 +1,452 @@
+/**
+ ******************************************************************************
+ * @file    bitboard_bench.c
+ * @brief   Benchmark (PC) del núcleo de bitboards contra el código de arreglos
+ ******************************************************************************
+ * @attention
+ *
+ * La referencia es el código anterior a bitboard.c, copiado sin cambios de
+ * lógica: CellState_t board[9], EvaluateBoard() con saltos por fila, columna
+ * y diagonal, y Game_CheckWin() recorriendo win_combinations[8][3].
+ *
+ * 1. Verifica, en las 4520 posiciones alcanzables con turno de P2, que el
+ *    Minimax de recorrido completo sobre arreglos y sobre bitboards elijan
+ *    la misma jugada visitando los mismos nodos, y que AISearch_BestMove()
+ *    (el negamax que usa hoy ai.c) elija la misma jugada. En los 3^9
+ *    tableros, Game_CheckWinBitboard() tiene que dar lo mismo que la versión
+ *    con win_combinations.
+ * 2. Nodos/s del Minimax completo (mismo árbol con las dos representaciones)
+ *    y latencia del negamax alfa-beta, sobre todas las posiciones (CSV).
+ * 3. Tableros/s de la detección de línea (CSV).
+ *
+ * Retorna 1 si algún resultado difiere.
+ * Compilar y ejecutar desde la carpeta tateti/:
+ *   gcc -O2 -ICore/Inc -o bitboard_bench Tools/bitboard_bench.c \
+ *       Core/Src/bitboard.c Core/Src/game_logic.c Core/Src/ai_search.c
+ *   ./bitboard_bench
+ *
+ * Opciones:
+ *   --repeat N         Pasadas sobre los 3^9 tableros en la prueba 3 (200 por defecto)
+ *
+ ******************************************************************************
+ */
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <time.h>
+#include "ai_search.h"
+#include "bitboard.h"
+#include "game_logic.h"
+
+#define BENCH_MAX_POSITIONS 4608u   // Hay 4520 posiciones con turno de P2
+#define BENCH_ALL_BOARDS    19683u  // 3^9
+
+typedef enum {
+    METHOD_MINIMAX_ARRAY = 0,       // Referencia de la columna speedup
+    METHOD_MINIMAX_BITBOARD,
+    METHOD_NEGAMAX_AB,
+    METHOD_COUNT
+} Method_t;
+
+static const char* const method_names[METHOD_COUNT] = {
+    "minimax_array", "minimax_bitboard", "negamax_ab"
+};
+
+/* Combinaciones ganadoras de game_logic.c antes de los bitboards */
+static const uint8_t win_combinations[8][3] = {
+    {0, 1, 2}, {3, 4, 5}, {6, 7, 8},
+    {0, 3, 6}, {1, 4, 7}, {2, 5, 8},
+    {0, 4, 8}, {2, 4, 6}
+};
+
+static Bitboard_t positions[BENCH_MAX_POSITIONS];
+static uint16_t position_count;
+static uint32_t nodes;
+static volatile uint32_t sink;
+
+static uint64_t NowNs(void);
+static void ToCells(const Bitboard_t* board, CellState_t cells[9]);
+static uint8_t ArrayHardMove(CellState_t* board);
+static int8_t ArrayMinimax(CellState_t* board, uint8_t depth, bool isMaximizing);
+static int8_t ArrayEvaluateBoard(CellState_t* board);
+static WinType_t ArrayCheckWin(const CellState_t* board);
+static uint8_t BitboardHardMove(const Bitboard_t* board);
+static int8_t BitboardMinimax(Bitboard_t board, uint8_t depth, bool isMaximizing);
+static uint8_t RunMethod(Method_t method, const Bitboard_t* board);
+
+int main(int argc, char** argv)
+{
+    uint32_t repeat = 200u;
+
+    for (int i = 1; i < argc; i++) {
+        if (strcmp(argv[i], "--repeat") == 0 && i + 1 < argc) {
+            repeat = (uint32_t)strtoul(argv[++i], NULL, 10);
+        } else {
+            fprintf(stderr, "Opción desconocida: %s\n", argv[i]);
+            return 2;
+        }
+    }
+    if (repeat == 0) {
+        repeat = 1u;
+    }
+
+    // Los 3^9 tableros y, entre ellos, las posiciones con turno de P2
+    // (mismo criterio que AIBench_CollectPositions: empezó cualquiera)
+    static CellState_t all_cells[BENCH_ALL_BOARDS][9];
+    static Bitboard_t all_boards[BENCH_ALL_BOARDS];
+    for (uint32_t code = 0; code < BENCH_ALL_BOARDS; code++) {
+        uint32_t c = code;
+        all_boards[code].p1 = 0;
+        all_boards[code].p2 = 0;
+        for (uint8_t i = 0; i < BB_NUM_CELLS; i++) {
+            all_cells[code][i] = (CellState_t)(c % 3u);
+            if (c % 3u == CELL_PLAYER1) all_boards[code].p1 |= (uint16_t)(1u << i);
+            if (c % 3u == CELL_PLAYER2) all_boards[code].p2 |= (uint16_t)(1u << i);
+            c /= 3u;
+        }
+
+        uint8_t n1 = Bitboard_Count(all_boards[code].p1);
+        uint8_t n2 = Bitboard_Count(all_boards[code].p2);
+        if ((n1 == n2 || n1 == n2 + 1u) && Bitboard_Empty(&all_boards[code]) != 0 &&
+            Game_CheckWinBitboard(&all_boards[code]) == WIN_NONE &&
+            position_count < BENCH_MAX_POSITIONS) {
+            positions[position_count++] = all_boards[code];
+        }
+    }
+
+    // 1. Exactitud
+    uint32_t mismatches = 0;
+    for (uint16_t i = 0; i < position_count; i++) {
+        uint8_t move[METHOD_COUNT];
+        uint32_t method_nodes[METHOD_COUNT];
+
+        for (uint8_t m = 0; m < METHOD_COUNT; m++) {
+            nodes = 0;
+            move[m] = RunMethod((Method_t)m, &positions[i]);
+            method_nodes[m] = nodes;
+        }
+        if (move[METHOD_MINIMAX_BITBOARD] != move[METHOD_MINIMAX_ARRAY] ||
+            move[METHOD_NEGAMAX_AB] != move[METHOD_MINIMAX_ARRAY] ||
+            method_nodes[METHOD_MINIMAX_BITBOARD] != method_nodes[METHOD_MINIMAX_ARRAY]) {
+            fprintf(stderr, "Posición p1=0x%03X p2=0x%03X: arreglos %u (%u nodos), bitboards %u (%u nodos), "
+                    "alfa-beta %u\n", positions[i].p1, positions[i].p2,
+                    move[METHOD_MINIMAX_ARRAY], method_nodes[METHOD_MINIMAX_ARRAY],
+                    move[METHOD_MINIMAX_BITBOARD], method_nodes[METHOD_MINIMAX_BITBOARD],
+                    move[METHOD_NEGAMAX_AB]);
+            mismatches++;
+        }
+    }
+
+    for (uint32_t code = 0; code < BENCH_ALL_BOARDS; code++) {
+        if (ArrayCheckWin(all_cells[code]) != Game_CheckWinBitboard(&all_boards[code])) {
+            fprintf(stderr, "Tablero %u: arreglos %u, bitboards %u\n", code,
+                    ArrayCheckWin(all_cells[code]), Game_CheckWinBitboard(&all_boards[code]));
+            mismatches++;
+        }
+    }
+    printf("positions,%u,mismatches,%u\n", position_count, mismatches);
+    if (mismatches != 0) {
+        return 1;
+    }
+
+    // 2. Búsqueda: cada posición una vez, la mejor de tres pasadas
+    printf("method,positions,nodes,ms,mnodes_per_s,speedup\n");
+    double baseline_ms = 0.0;
+    for (uint8_t m = 0; m < METHOD_COUNT; m++) {
+        uint64_t best = UINT64_MAX;
+        uint32_t total_nodes = 0;
+
+        for (uint8_t run = 0; run < 3u; run++) {
+            nodes = 0;
+            uint64_t start = NowNs();
+            for (uint16_t i = 0; i < position_count; i++) {
+                sink += RunMethod((Method_t)m, &positions[i]);
+            }
+            uint64_t elapsed = NowNs() - start;
+            best = (elapsed < best) ? elapsed : best;
+            total_nodes = nodes;
+        }
+
+        double ms = (double)best / 1e6;
+        if (m == METHOD_MINIMAX_ARRAY) {
+            baseline_ms = ms;
+        }
+        printf("%s,%u,%u,%.2f,%.1f,%.2f\n", method_names[m], position_count, total_nodes, ms,
+               (double)total_nodes / (ms * 1e3), baseline_ms / ms);
+    }
+
+    // 3. Detección de línea
+    printf("check,boards,ns_per_board,speedup\n");
+    double array_ns = 0.0;
+    for (uint8_t method = 0; method < 2u; method++) {
+        uint64_t best = UINT64_MAX;
+
+        for (uint8_t run = 0; run < 3u; run++) {
+            uint32_t acc = 0;
+            uint64_t start = NowNs();
+            for (uint32_t r = 0; r < repeat; r++) {
+                for (uint32_t code = 0; code < BENCH_ALL_BOARDS; code++) {
+                    acc += (method == 0) ? ArrayCheckWin(all_cells[code]) :
+                                           Game_CheckWinBitboard(&all_boards[code]);
+                }
+            }
+            uint64_t elapsed = NowNs() - start;
+            sink += acc;
+            best = (elapsed < best) ? elapsed : best;
+        }
+
+        double ns = (double)best / ((double)BENCH_ALL_BOARDS * repeat);
+        if (method == 0) {
+            array_ns = ns;
+        }
+        printf("%s,%u,%.2f,%.2f\n", (method == 0) ? "checkwin_array" : "checkwin_bitboard",
+               BENCH_ALL_BOARDS, ns, array_ns / ns);
+    }
+    return 0;
+}
+
+/**
+ * @brief  Reloj de la PC en nanosegundos
+ */
+static uint64_t NowNs(void)
+{
+    struct timespec ts;
+    clock_gettime(CLOCK_MONOTONIC, &ts);
+    return (uint64_t)ts.tv_sec * 1000000000u + (uint64_t)ts.tv_nsec;
+}
+
+/**
+ * @brief  Pasa un bitboard al arreglo de la referencia
+ */
+static void ToCells(const Bitboard_t* board, CellState_t cells[9])
+{
+    for (uint8_t i = 0; i < BB_NUM_CELLS; i++) {
+        cells[i] = (board->p1 & (1u << i)) ? CELL_PLAYER1 :
+                   (board->p2 & (1u << i)) ? CELL_PLAYER2 : CELL_EMPTY;
+    }
+}
+
+/**
+ * @brief  Juega con el método indicado
+ * @retval Jugada elegida para P2 (0-8)
+ */
+static uint8_t RunMethod(Method_t method, const Bitboard_t* board)
+{
+    CellState_t cells[9];
+    uint8_t move;
+
+    switch (method) {
+        case METHOD_MINIMAX_ARRAY:
+            ToCells(board, cells);
+            return ArrayHardMove(cells);
+        case METHOD_MINIMAX_BITBOARD:
+            return BitboardHardMove(board);
+        default:
+            // AISearch_BestMove reinicia su contador en cada llamada
+            move = AISearch_BestMove(*board, true, NULL);
+            nodes += AISearch_GetNodeCount();
+            return move;
+    }
+}
+
+/*============================================================================*/
+/* Referencia: ai.c y game_logic.c sobre CellState_t[9]                       */
+/*============================================================================*/
+
+/**
+ * @brief  IA Difícil - Minimax (invencible)
+ */
+static uint8_t ArrayHardMove(CellState_t* board)
+{
+    int8_t best_score = -100;
+    uint8_t best_move = 0;
+
+    for (uint8_t i = 0; i < 9; i++) {
+        if (board[i] == CELL_EMPTY) {
+            board[i] = CELL_PLAYER2;
+            int8_t score = ArrayMinimax(board, 0, false);
+            board[i] = CELL_EMPTY;
+
+            if (score > best_score) {
+                best_score = score;
+                best_move = i;
+            }
+        }
+    }
+
+    return best_move;
+}
+
+/**
+ * @brief  Algoritmo Minimax
+ */
+static int8_t ArrayMinimax(CellState_t* board, uint8_t depth, bool isMaximizing)
+{
+    nodes++;
+    int8_t score = ArrayEvaluateBoard(board);
+
+    // Si el juego terminó, retornar score
+    if (score != 0) return score - depth * (score > 0 ? 1 : -1);
+
+    // Si es empate
+    bool has_empty = false;
+    for (uint8_t i = 0; i < 9; i++) {
+        if (board[i] == CELL_EMPTY) {
+            has_empty = true;
+            break;
+        }
+    }
+    if (!has_empty) return 0;
+
+    if (isMaximizing) {
+        int8_t best = -100;
+        for (uint8_t i = 0; i < 9; i++) {
+            if (board[i] == CELL_EMPTY) {
+                board[i] = CELL_PLAYER2;
+                int8_t val = ArrayMinimax(board, depth + 1, false);
+                board[i] = CELL_EMPTY;
+                if (val > best) best = val;
+            }
+        }
+        return best;
+    } else {
+        int8_t best = 100;
+        for (uint8_t i = 0; i < 9; i++) {
+            if (board[i] == CELL_EMPTY) {
+                board[i] = CELL_PLAYER1;
+                int8_t val = ArrayMinimax(board, depth + 1, true);
+                board[i] = CELL_EMPTY;
+                if (val < best) best = val;
+            }
+        }
+        return best;
+    }
+}
+
+/**
+ * @brief  Evalúa el estado del tablero
+ * @retval +10 si P2 gana, -10 si P1 gana, 0 si no hay ganador
+ */
+static int8_t ArrayEvaluateBoard(CellState_t* board)
+{
+    // Verificar filas
+    for (uint8_t i = 0; i < 3; i++) {
+        if (board[i*3] != CELL_EMPTY &&
+            board[i*3] == board[i*3+1] &&
+            board[i*3] == board[i*3+2]) {
+            return (board[i*3] == CELL_PLAYER2) ? 10 : -10;
+        }
+    }
+
+    // Verificar columnas
+    for (uint8_t i = 0; i < 3; i++) {
+        if (board[i] != CELL_EMPTY &&
+            board[i] == board[i+3] &&
+            board[i] == board[i+6]) {
+            return (board[i] == CELL_PLAYER2) ? 10 : -10;
+        }
+    }
+
+    // Verificar diagonal principal
+    if (board[0] != CELL_EMPTY &&
+        board[0] == board[4] &&
+        board[0] == board[8]) {
+        return (board[0] == CELL_PLAYER2) ? 10 : -10;
+    }
+
+    // Verificar diagonal anti
+    if (board[2] != CELL_EMPTY &&
+        board[2] == board[4] &&
+        board[2] == board[6]) {
+        return (board[2] == CELL_PLAYER2) ? 10 : -10;
+    }
+
+    return 0;  // No hay ganador aún
+}
+
+/**
+ * @brief  Verifica si hay un ganador
+ * @retval WIN_NONE si no hay ganador, o el tipo de victoria (WIN_ROW0, etc.)
+ */
+static WinType_t ArrayCheckWin(const CellState_t* board)
+{
+    for (uint8_t i = 0; i < 8; i++) {
+        uint8_t pos0 = win_combinations[i][0];
+        uint8_t pos1 = win_combinations[i][1];
+        uint8_t pos2 = win_combinations[i][2];
+
+        if (board[pos0] != CELL_EMPTY &&
+            board[pos0] == board[pos1] &&
+            board[pos1] == board[pos2]) {
+            // Retornar el tipo de victoria (1-8)
+            return (WinType_t)(i + 1);
+        }
+    }
+    return WIN_NONE;
+}
+
+/*============================================================================*/
+/* Mismo Minimax sobre bitboard.h                                             */
+/*============================================================================*/
+
+/**
+ * @brief  IA Difícil - Minimax sobre bitboards (mismo árbol que la referencia)
+ */
+static uint8_t BitboardHardMove(const Bitboard_t* board)
+{
+    int8_t best_score = -100;
+    uint8_t best_move = 0;
+    uint16_t empty = Bitboard_Empty(board);
+
+    while (empty) {
+        uint8_t i = Bitboard_PopLowest(&empty);
+        Bitboard_t child = *board;
+        child.p2 |= (uint16_t)(1u << i);
+        int8_t score = BitboardMinimax(child, 0, false);
+
+        if (score > best_score) {
+            best_score = score;
+            best_move = i;
+        }
+    }
+
+    return best_move;
+}
+
+/**
+ * @brief  Algoritmo Minimax sobre bitboards
+ */
+static int8_t BitboardMinimax(Bitboard_t board, uint8_t depth, bool isMaximizing)
+{
+    nodes++;
+
+    // Solo puede haber completado una línea quien acaba de mover
+    if (isMaximizing) {
+        if (Bitboard_HasWin(board.p1)) return -10 + depth;
+    } else {
+        if (Bitboard_HasWin(board.p2)) return 10 - depth;
+    }
+
+    // Si es empate
+    uint16_t empty = Bitboard_Empty(&board);
+    if (empty == 0) return 0;
+
+    int8_t best = isMaximizing ? -100 : 100;
+    while (empty) {
+        uint16_t bit = (uint16_t)(empty & (uint16_t)(0u - empty));
+        empty &= (uint16_t)~bit;
+
+        Bitboard_t child = board;
+        if (isMaximizing) {
+            child.p2 |= bit;
+            int8_t val = BitboardMinimax(child, depth + 1, false);
+            if (val > best) best = val;
+        } else {
+            child.p1 |= bit;
+            int8_t val = BitboardMinimax(child, depth + 1, true);
+            if (val < best) best = val;
+        }
+    }
+    return best;
+}
@@ -0,0 +1,339 @@
+/**
+ ******************************************************************************
+ * @file    connect4_bench.c
+ * @brief   Benchmark (PC) del motor de 4 en línea
+ ******************************************************************************
+ * @attention
+ *
+ * 1. Resuelve posiciones de prueba con C4_Solve() y mide tiempo, nodos y
+ *    nodos/s por conjunto. Las posiciones son las de los archivos de prueba
+ *    habituales de 4 en línea (una por línea: "jugadas puntaje", por ejemplo
+ *    "2252576253462244111563365343671351441 -1"), pasados con --file, o
+ *    se generan con jugadas al azar reproducibles (--seed) en tres
+ *    conjuntos: final (28 a 34 fichas), medio (14 a 27) y apertura (8 a 13).
+ * 2. Verifica cada puntaje: contra el del archivo o, en las posiciones de
+ *    final generadas, contra un negamax de referencia sin tabla ni orden.
+ * 3. Mide C4_Search() con plazo (--budget-ms) sobre las posiciones de
+ *    medio juego: latencia y profundidad alcanzada.
+ *
+ * Imprime CSV por stdout y retorna 1 si algún puntaje no coincide.
+ * Compilar y ejecutar desde la carpeta tateti/ (tabla de 8 MB en la PC):
+ *   gcc -O2 -DC4_TT_BITS=20 -ICore/Inc -o connect4_bench Tools/connect4_bench.c \
+ *       Core/Src/connect4.c
+ *   ./connect4_bench
+ *
+ * Opciones:
+ *   --file RUTA        Archivo de posiciones de prueba (se puede repetir)
+ *   --end N            Posiciones de final generadas (200 por defecto)
+ *   --middle N         Posiciones de medio juego generadas (50 por defecto)
+ *   --begin N          Posiciones de apertura generadas (0 por defecto: lento)
+ *   --budget-ms N      Plazo de C4_Search (100 por defecto)
+ *   --seed N           Semilla de las posiciones generadas (1 por defecto)
+ *
+ ******************************************************************************
+ */
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <time.h>
+#include "connect4.h"
+
+#define BENCH_MAX_POSITIONS     4096u
+#define BENCH_NO_SCORE          127     // Puntaje desconocido: usar la referencia si se puede
+#define BENCH_REFERENCE_MIN     28u     // Fichas desde las que la referencia es rápida
+
+typedef struct {
+    C4_Board_t board;
+    int8_t expected;
+} Position_t;
+
+static Position_t positions[BENCH_MAX_POSITIONS];
+static uint32_t samples[BENCH_MAX_POSITIONS];
+
+static uint32_t NowUs(void);
+static uint32_t NowMs(void);
+static uint32_t NextRandom(uint32_t* rng);
+static uint16_t LoadFile(const char* path);
+static uint16_t Generate(uint16_t count, uint8_t min_moves, uint8_t max_moves, uint32_t* rng);
+static int8_t Reference(const C4_Board_t* board, int8_t alpha, int8_t beta);
+static bool SolveSet(const char* label, uint16_t count);
+static void SearchSet(const char* label, uint16_t count, uint32_t budget_ms);
+static int CompareSamples(const void* a, const void* b);
+static void PrintLatency(uint16_t count);
+
+int main(int argc, char** argv)
+{
+    const char* files[16];
+    uint8_t file_count = 0;
+    uint16_t end_count = 200u;
+    uint16_t middle_count = 50u;
+    uint16_t begin_count = 0;
+    uint32_t budget_ms = 100u;
+    uint32_t seed = 1u;
+
+    for (int i = 1; i < argc; i++) {
+        if (strcmp(argv[i], "--file") == 0 && i + 1 < argc && file_count < 16u) {
+            files[file_count++] = argv[++i];
+        } else if (strcmp(argv[i], "--end") == 0 && i + 1 < argc) {
+            end_count = (uint16_t)atoi(argv[++i]);
+        } else if (strcmp(argv[i], "--middle") == 0 && i + 1 < argc) {
+            middle_count = (uint16_t)atoi(argv[++i]);
+        } else if (strcmp(argv[i], "--begin") == 0 && i + 1 < argc) {
+            begin_count = (uint16_t)atoi(argv[++i]);
+        } else if (strcmp(argv[i], "--budget-ms") == 0 && i + 1 < argc) {
+            budget_ms = (uint32_t)atoi(argv[++i]);
+        } else if (strcmp(argv[i], "--seed") == 0 && i + 1 < argc) {
+            seed = (uint32_t)strtoul(argv[++i], NULL, 10);
+        } else {
+            fprintf(stderr, "Opción desconocida: %s\n", argv[i]);
+            return 2;
+        }
+    }
+
+    uint32_t rng = (seed != 0) ? seed : 1u;
+    bool ok = true;
+
+    printf("set,positions,min_us,median_us,p99_us,max_us,avg_nodes,nodes_per_s,mismatches\n");
+    for (uint8_t i = 0; i < file_count; i++) {
+        uint16_t count = LoadFile(files[i]);
+        if (count == 0) {
+            fprintf(stderr, "%s: sin posiciones\n", files[i]);
+            return 2;
+        }
+        ok &= SolveSet(files[i], count);
+    }
+    if (end_count > 0) {
+        ok &= SolveSet("end", Generate(end_count, 28u, 34u, &rng));
+    }
+    if (begin_count > 0) {
+        ok &= SolveSet("begin", Generate(begin_count, 8u, 13u, &rng));
+    }
+    if (middle_count > 0) {
+        uint16_t count = Generate(middle_count, 14u, 27u, &rng);
+        ok &= SolveSet("middle", count);
+
+        printf("\nsearch,positions,min_us,median_us,p99_us,max_us,avg_depth,nodes_per_s\n");
+        SearchSet("middle", count, budget_ms);
+    }
+    return ok ? 0 : 1;
+}
+
+/**
+ * @brief  Reloj de la PC en microsegundos
+ */
+static uint32_t NowUs(void)
+{
+    struct timespec ts;
+    clock_gettime(CLOCK_MONOTONIC, &ts);
+    return (uint32_t)((uint64_t)ts.tv_sec * 1000000u + (uint64_t)ts.tv_nsec / 1000u);
+}
+
+/**
+ * @brief  Reloj de la PC en milisegundos (mismo uso que HAL_GetTick)
+ */
+static uint32_t NowMs(void)
+{
+    struct timespec ts;
+    clock_gettime(CLOCK_MONOTONIC, &ts);
+    return (uint32_t)((uint64_t)ts.tv_sec * 1000u + (uint64_t)ts.tv_nsec / 1000000u);
+}
+
+/**
+ * @brief  Generador xorshift32
+ */
+static uint32_t NextRandom(uint32_t* rng)
+{
+    uint32_t x = *rng;
+    x ^= x << 13;
+    x ^= x >> 17;
+    x ^= x << 5;
+    *rng = x;
+    return x;
+}
+
+/**
+ * @brief  Carga un archivo de posiciones "jugadas puntaje"
+ * @retval Cantidad de posiciones cargadas
+ */
+static uint16_t LoadFile(const char* path)
+{
+    FILE* f = fopen(path, "r");
+    char moves[64];
+    int score;
+    uint16_t count = 0;
+
+    if (f == NULL) {
+        return 0;
+    }
+    while (count < BENCH_MAX_POSITIONS && fscanf(f, "%63s %d", moves, &score) == 2) {
+        C4_Board_t board;
+        C4_Reset(&board);
+        if (C4_PlayString(&board, moves) != strlen(moves)) {
+            fprintf(stderr, "%s: posición inválida %s\n", path, moves);
+            continue;
+        }
+        positions[count].board = board;
+        positions[count].expected = (int8_t)score;
+        count++;
+    }
+    fclose(f);
+    return count;
+}
+
+/**
+ * @brief  Genera posiciones con jugadas al azar que no terminan la partida
+ * @retval Cantidad de posiciones generadas
+ */
+static uint16_t Generate(uint16_t count, uint8_t min_moves, uint8_t max_moves, uint32_t* rng)
+{
+    if (count > BENCH_MAX_POSITIONS) {
+        count = BENCH_MAX_POSITIONS;
+    }
+
+    for (uint16_t i = 0; i < count; i++) {
+        uint8_t target = (uint8_t)(min_moves + NextRandom(rng) % (max_moves - min_moves + 1u));
+        C4_Board_t board;
+
+        C4_Reset(&board);
+        while (board.moves < target) {
+            uint8_t cols[C4_WIDTH];
+            uint8_t n = 0;
+            for (uint8_t col = 0; col < C4_WIDTH; col++) {
+                if (C4_CanPlay(&board, col) && !C4_IsWinningMove(&board, col)) {
+                    cols[n++] = col;
+                }
+            }
+            if (n == 0) {
+                C4_Reset(&board);  // Sin jugadas que sigan la partida: empezar otra
+                continue;
+            }
+            C4_Play(&board, cols[NextRandom(rng) % n]);
+        }
+        positions[i].board = board;
+        positions[i].expected = BENCH_NO_SCORE;
+    }
+    return count;
+}
+
+/**
+ * @brief  Negamax de referencia (sin tabla ni orden de jugadas)
+ * @retval Puntaje en la escala de C4_Solve()
+ */
+static int8_t Reference(const C4_Board_t* board, int8_t alpha, int8_t beta)
+{
+    if (board->moves == C4_NUM_CELLS) {
+        return 0;
+    }
+    for (uint8_t col = 0; col < C4_WIDTH; col++) {
+        if (C4_CanPlay(board, col) && C4_IsWinningMove(board, col)) {
+            return (int8_t)((C4_NUM_CELLS + 1 - board->moves) / 2);
+        }
+    }
+
+    int8_t max = (int8_t)((C4_NUM_CELLS - 1 - board->moves) / 2);
+    if (beta > max) {
+        beta = max;
+        if (alpha >= beta) {
+            return beta;
+        }
+    }
+    for (uint8_t col = 0; col < C4_WIDTH; col++) {
+        if (C4_CanPlay(board, col)) {
+            C4_Board_t child = *board;
+            C4_Play(&child, col);
+            int8_t score = (int8_t)-Reference(&child, (int8_t)-beta, (int8_t)-alpha);
+            if (score >= beta) {
+                return score;
+            }
+            if (score > alpha) {
+                alpha = score;
+            }
+        }
+    }
+    return alpha;
+}
+
+/**
+ * @brief  Resuelve positions[0..count) e imprime su línea CSV
+ * @retval false si algún puntaje no coincide
+ */
+static bool SolveSet(const char* label, uint16_t count)
+{
+    uint64_t total_nodes = 0;
+    uint64_t total_us = 0;
+    uint16_t mismatches = 0;
+
+    for (uint16_t i = 0; i < count; i++) {
+        int8_t score;
+        uint32_t nodes;
+
+        C4_ClearTT();
+        uint32_t start = NowUs();
+        C4_Solve(&positions[i].board, NULL, 0, &score, &nodes);
+        samples[i] = NowUs() - start;
+        total_us += samples[i];
+        total_nodes += nodes;
+
+        int8_t expected = positions[i].expected;
+        if (expected == BENCH_NO_SCORE && positions[i].board.moves >= BENCH_REFERENCE_MIN) {
+            expected = Reference(&positions[i].board, -C4_NUM_CELLS / 2, C4_NUM_CELLS / 2);
+        }
+        if (expected != BENCH_NO_SCORE && score != expected) {
+            fprintf(stderr, "%s, posición %u: puntaje %d, esperado %d\n", label, i, score, expected);
+            mismatches++;
+        }
+    }
+
+    printf("%s,%u,", label, count);
+    PrintLatency(count);
+    printf(",%llu,%llu,%u\n", (unsigned long long)(total_nodes / count),
+           (unsigned long long)(total_us ? total_nodes * 1000000u / total_us : 0), mismatches);
+    return mismatches == 0;
+}
+
+/**
+ * @brief  Mide C4_Search con plazo sobre positions[0..count)
+ */
+static void SearchSet(const char* label, uint16_t count, uint32_t budget_ms)
+{
+    uint64_t total_nodes = 0;
+    uint64_t total_us = 0;
+    uint32_t depth_sum = 0;
+
+    C4_ClearTT();
+    for (uint16_t i = 0; i < count; i++) {
+        C4_Result_t result;
+        uint32_t start = NowUs();
+        C4_Search(&positions[i].board, C4_MAX_DEPTH, NowMs, budget_ms, &result);
+        samples[i] = NowUs() - start;
+        total_us += samples[i];
+        total_nodes += result.nodes;
+        depth_sum += result.depth;
+    }
+
+    printf("%s_%ums,%u,", label, budget_ms, count);
+    PrintLatency(count);
+    printf(",%.2f,%llu\n", (double)depth_sum / count,
+           (unsigned long long)(total_us ? total_nodes * 1000000u / total_us : 0));
+}
+
+/**
+ * @brief  Orden ascendente para qsort
+ */
+static int CompareSamples(const void* a, const void* b)
+{
+    uint32_t x = *(const uint32_t*)a;
+    uint32_t y = *(const uint32_t*)b;
+    return (x > y) - (x < y);
+}
+
+/**
+ * @brief  Imprime mínimo, mediana, p99 y máximo de samples[] (sin fin de línea)
+ */
+static void PrintLatency(uint16_t count)
+{
+    qsort(samples, count, sizeof(samples[0]), CompareSamples);
+    printf("%u,%u,%u,%u", samples[0], samples[count / 2u], samples[(count * 99u) / 100u],
+           samples[count - 1u]);
+}
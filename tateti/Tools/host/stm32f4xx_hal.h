@@ -0,0 +1,53 @@
+/**
+ ******************************************************************************
+ * @file    stm32f4xx_hal.h
+ * @brief   Reemplazo mínimo del HAL para compilar la IA en la PC
+ ******************************************************************************
+ * @attention
+ *
+ * Solo declara lo que usan los headers y fuentes de la IA (tipos de
+ * keyboard.h, HAL_GetTick, SystemCoreClock y el contador de ciclos DWT) y
+ * el handle del timer que nombra ws2812b.h (para incluir display.h).
+ * Las herramientas de Tools/ que lo usan definen HostHAL_DWT,
+ * HostHAL_CoreDebug, SystemCoreClock y HAL_GetTick.
+ *
+ ******************************************************************************
+ */
+
+#ifndef HOST_STM32F4XX_HAL_H_
+#define HOST_STM32F4XX_HAL_H_
+
+#include <stdint.h>
+
+typedef enum {
+    HAL_OK = 0,
+    HAL_ERROR,
+    HAL_BUSY,
+    HAL_TIMEOUT
+} HAL_StatusTypeDef;
+
+typedef struct {
+    void* Instance;
+} TIM_HandleTypeDef;
+
+typedef struct {
+    volatile uint32_t CTRL;
+    volatile uint32_t CYCCNT;
+} HostHAL_DWT_t;
+
+typedef struct {
+    volatile uint32_t DEMCR;
+} HostHAL_CoreDebug_t;
+
+extern HostHAL_DWT_t HostHAL_DWT;
+extern HostHAL_CoreDebug_t HostHAL_CoreDebug;
+extern uint32_t SystemCoreClock;
+
+uint32_t HAL_GetTick(void);
+
+#define DWT                         (&HostHAL_DWT)
+#define CoreDebug                   (&HostHAL_CoreDebug)
+#define DWT_CTRL_CYCCNTENA_Msk      (1u << 0)
+#define CoreDebug_DEMCR_TRCENA_Msk  (1u << 24)
+
+#endif /* HOST_STM32F4XX_HAL_H_ */
@@ -0,0 +1,189 @@
+/**
+ ******************************************************************************
+ * @file    nn_bench.c
+ * @brief   Benchmark (PC) de la red int8 de evaluación del motor m,n,k
+ ******************************************************************************
+ * @attention
+ *
+ * 1. Compara los núcleos escalar y SIMD (Core/Src/nn_bench.c): retorna 1 si
+ *    algún producto interno o alguna evaluación difiere en un bit.
+ * 2. Latencia por posición de la heurística de líneas y de la red (CSV).
+ * 3. Partidas de alfa-beta a profundidad fija en la variante del modelo:
+ *    evaluación de red contra heurística de líneas, cada apertura al azar
+ *    dos veces con los colores cambiados.
+ *
+ * Compilar y ejecutar desde la carpeta tateti/:
+ *   gcc -O2 -ITools/host -ICore/Inc -o nn_bench Tools/nn_bench.c \
+ *       Core/Src/nn_bench.c Core/Src/nn_eval.c Core/Src/nn_model_data.c \
+ *       Core/Src/mnk.c
+ *   ./nn_bench
+ *
+ * Opciones:
+ *   --positions N      Posiciones medidas (1024 por defecto)
+ *   --games N          Partidas de red contra líneas (40 por defecto, par)
+ *   --depth N          Profundidad del alfa-beta (4 por defecto)
+ *   --seed N           Semilla (12345 por defecto)
+ *
+ * Con -DNN_USE_SIMD=1 la PC usa la emulación del núcleo SIMD también en
+ * NN_Evaluate; los resultados no cambian.
+ *
+ ******************************************************************************
+ */
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <time.h>
+#include "stm32f4xx_hal.h"
+#include "nn_bench.h"
+#include "nn_eval.h"
+
+#define BENCH_OPENING_PLIES 2u
+
+/* Reemplazos del HAL (Tools/host/stm32f4xx_hal.h) */
+HostHAL_DWT_t HostHAL_DWT;
+HostHAL_CoreDebug_t HostHAL_CoreDebug;
+uint32_t SystemCoreClock = 168000000u;
+
+static MNK_Rules_t rules;
+static MNK_Board_t positions[NN_BENCH_MAX_POSITIONS];
+
+static uint32_t HostClock(void);
+static uint32_t NextRandom(uint32_t* rng);
+static uint8_t PlayGame(bool nn_first, uint8_t depth, uint32_t* rng);
+
+uint32_t HAL_GetTick(void)
+{
+    struct timespec ts;
+    clock_gettime(CLOCK_MONOTONIC, &ts);
+    return (uint32_t)(ts.tv_sec * 1000u + ts.tv_nsec / 1000000u);
+}
+
+int main(int argc, char** argv)
+{
+    uint16_t count = NN_BENCH_MAX_POSITIONS;
+    uint16_t games = 40u;
+    uint8_t depth = 4u;
+    uint32_t seed = NN_BENCH_SEED;
+
+    for (int i = 1; i < argc; i++) {
+        if (strcmp(argv[i], "--positions") == 0 && i + 1 < argc) {
+            count = (uint16_t)atoi(argv[++i]);
+        } else if (strcmp(argv[i], "--games") == 0 && i + 1 < argc) {
+            games = (uint16_t)atoi(argv[++i]);
+        } else if (strcmp(argv[i], "--depth") == 0 && i + 1 < argc) {
+            depth = (uint8_t)atoi(argv[++i]);
+        } else if (strcmp(argv[i], "--seed") == 0 && i + 1 < argc) {
+            seed = (uint32_t)strtoul(argv[++i], NULL, 10);
+        } else {
+            fprintf(stderr, "Opción desconocida: %s\n", argv[i]);
+            return 2;
+        }
+    }
+    if (count == 0 || count > NN_BENCH_MAX_POSITIONS) {
+        count = NN_BENCH_MAX_POSITIONS;
+    }
+
+    if (!MNK_Init(&rules, NN_Model.width, NN_Model.height, NN_Model.k)) {
+        fprintf(stderr, "Modelo para una variante inválida\n");
+        return 2;
+    }
+    count = NNBench_CollectPositions(&rules, positions, count, seed);
+
+    // 1. Núcleos
+    uint32_t mismatches = NNBench_CheckKernels(&rules, positions, count, seed);
+    printf("kernel_mismatches,%u\n", mismatches);
+    if (mismatches != 0) {
+        return 1;
+    }
+
+    // 2. Latencia
+    NNBench_Result_t result;
+    NNBench_PrintHeader();
+    for (uint8_t e = 0; e < NN_BENCH_NUM_EVALS; e++) {
+        NNBench_RunEval((NNBench_Eval_t)e, &rules, positions, count, HostClock, 1000u, &result);
+        NNBench_PrintResult(&result);
+    }
+
+    // 3. Partidas
+    uint32_t rng = (seed != 0) ? seed : 1u;
+    uint16_t wins = 0;
+    uint16_t losses = 0;
+    uint16_t draws = 0;
+
+    for (uint16_t g = 0; g < games; g += 2u) {
+        uint32_t opening = rng;
+        for (uint8_t swap = 0; swap < 2u && g + swap < games; swap++) {
+            rng = opening;
+            uint8_t outcome = PlayGame(swap == 0, depth, &rng);
+            wins += (outcome == 0);
+            losses += (outcome == 1);
+            draws += (outcome == 2);
+        }
+    }
+    printf("match,variant,depth,games,nn_wins,lines_wins,draws\n");
+    printf("nn_vs_lines,%ux%u_k%u,%u,%u,%u,%u,%u\n", rules.width, rules.height, rules.k, depth,
+           games, wins, losses, draws);
+    return 0;
+}
+
+/**
+ * @brief  Reloj de la PC en nanosegundos (1000 ticks por microsegundo)
+ */
+static uint32_t HostClock(void)
+{
+    struct timespec ts;
+    clock_gettime(CLOCK_MONOTONIC, &ts);
+    return (uint32_t)((uint64_t)ts.tv_sec * 1000000000u + (uint64_t)ts.tv_nsec);
+}
+
+/**
+ * @brief  Generador xorshift32
+ */
+static uint32_t NextRandom(uint32_t* rng)
+{
+    uint32_t x = *rng;
+    x ^= x << 13;
+    x ^= x >> 17;
+    x ^= x << 5;
+    *rng = x;
+    return x;
+}
+
+/**
+ * @brief  Juega una partida de red contra líneas tras una apertura al azar
+ * @param  nn_first: true si la red juega con P1
+ * @retval 0 = ganó la red, 1 = ganaron las líneas, 2 = empate
+ */
+static uint8_t PlayGame(bool nn_first, uint8_t depth, uint32_t* rng)
+{
+    MNK_Board_t board;
+    uint8_t nn_side = nn_first ? 0u : 1u;
+
+    MNK_Reset(&rules, &board);
+    while (MNK_Empty(&rules, &board) != 0) {
+        uint8_t cell;
+
+        if (board.move_count < BENCH_OPENING_PLIES) {
+            MNK_Mask_t empty = MNK_Empty(&rules, &board);
+            uint8_t skip = (uint8_t)(NextRandom(rng) % (uint32_t)__builtin_popcountll(empty));
+            while (skip--) {
+                empty &= empty - 1u;
+            }
+            cell = (uint8_t)__builtin_ctzll(empty);
+        } else {
+            MNK_Result_t result;
+            MNK_SetEvaluator((board.side == nn_side) ? NN_Evaluate : NULL);
+            MNK_Search(&rules, &board, depth, 0, &result);
+            cell = result.best_move;
+        }
+
+        uint8_t side = board.side;
+        bool win = MNK_IsWinningMove(&rules, board.cells[side] | ((MNK_Mask_t)1u << cell), cell);
+        MNK_MakeMove(&rules, &board, cell);
+        if (win) {
+            return (side == nn_side) ? 0u : 1u;
+        }
+    }
+    return 2u;
+}
@@ -0,0 +1,507 @@
+/**
+ ******************************************************************************
+ * @file    nn_train.c
+ * @brief   Entrenador (PC) de la red int8 de evaluación del motor m,n,k
+ ******************************************************************************
+ * @attention
+ *
+ * 1. Genera posiciones de la variante jugando al azar desde el tablero
+ *    vacío hasta una jugada al azar (sin partidas terminadas) y etiqueta
+ *    cada una con el resultado medio de --playouts simulaciones al azar
+ *    (MCTS_Playout) para el jugador que mueve: +1 gana, 0 empata, -1 pierde.
+ * 2. Entrena en float un perceptrón de una capa oculta ReLU con salida
+ *    lineal (error cuadrático, descenso por gradiente con momento).
+ * 3. Cuantiza a int8 con la escala de nn_eval.h: pesos por capa a ±127,
+ *    desplazamiento de la capa oculta calibrado con el máximo observado.
+ * 4. Mide el error de la red cuantizada con la inferencia real de
+ *    nn_eval.c (ambos núcleos, que deben coincidir) y escribe
+ *    Core/Src/nn_model_data.c.
+ *
+ * Compilar y ejecutar desde la carpeta tateti/:
+ *   gcc -O2 -ICore/Inc -o nn_train Tools/nn_train.c Core/Src/nn_eval.c \
+ *       Core/Src/nn_model_data.c Core/Src/mnk.c Core/Src/mcts.c -lm
+ *   ./nn_train --variant 5x5 Core/Src/nn_model_data.c
+ *
+ * (nn_model_data.c se enlaza solo porque nn_eval.c lo referencia; el
+ * modelo entrenado no depende del anterior.)
+ *
+ * Opciones:
+ *   --variant 4x4|5x5|7x7   Variante de MNK_InitVariant (5x5 por defecto)
+ *   --positions N           Posiciones de entrenamiento (100000 por defecto)
+ *   --playouts N            Simulaciones por etiqueta (64 por defecto)
+ *   --hidden N              Neuronas ocultas, múltiplo de 4 (32 por defecto)
+ *   --epochs N              Pasadas sobre los datos (30 por defecto)
+ *   --lr X                  Tasa de aprendizaje (0.01 por defecto)
+ *   --seed N                Semilla (1 por defecto)
+ *   ARCHIVO                 Salida (nn_model_data.c por defecto)
+ *
+ * Retorna distinto de 0 si los núcleos escalar y SIMD no coinciden.
+ *
+ ******************************************************************************
+ */
+
+#include <math.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include "mnk.h"
+#include "mcts.h"
+#include "nn_eval.h"
+
+#define TRAIN_BATCH         32u
+#define TRAIN_MOMENTUM      0.9f
+#define TRAIN_TEST_SHARE    10u     // 1 de cada 10 posiciones queda para medir
+
+/* Posición etiquetada */
+typedef struct {
+    int8_t input[NN_MAX_INPUTS];
+    float value;
+} Sample_t;
+
+/* Configuración */
+static MNK_Variant_t variant = MNK_VARIANT_5X5;
+static const char* variant_name = "5x5";
+static uint32_t num_positions = 100000u;
+static uint32_t num_playouts = 64u;
+static uint32_t num_hidden = 32u;
+static uint32_t num_epochs = 30u;
+static float learning_rate = 0.01f;
+static uint32_t rng_state = 1u;
+
+/* Red en float: w1[hidden][inputs], w2[hidden] */
+static uint16_t num_inputs;
+static uint16_t input_stride;
+static float w1[NN_MAX_HIDDEN][NN_MAX_INPUTS];
+static float b1[NN_MAX_HIDDEN];
+static float w2[NN_MAX_HIDDEN];
+static float b2;
+static float v_w1[NN_MAX_HIDDEN][NN_MAX_INPUTS];
+static float v_b1[NN_MAX_HIDDEN];
+static float v_w2[NN_MAX_HIDDEN];
+static float v_b2;
+
+/* Red cuantizada */
+static int8_t q_w1[NN_MAX_HIDDEN * NN_MAX_INPUTS];
+static int32_t q_b1[NN_MAX_HIDDEN];
+static int8_t q_w2[NN_MAX_HIDDEN];
+static NN_Model_t q_model;
+
+static MNK_Rules_t rules;
+static Sample_t* samples;
+
+static void Generate(void);
+static void Train(void);
+static float Predict(const int8_t* input, float hidden_out[]);
+static double TestError(bool quantized, uint32_t* mismatches);
+static bool Quantize(void);
+static uint32_t NextRandom(void);
+static float RandomUniform(void);
+static int WriteModel(const char* path, double test_mse);
+
+int main(int argc, char** argv)
+{
+    const char* path = "nn_model_data.c";
+
+    for (int i = 1; i < argc; i++) {
+        if (strcmp(argv[i], "--variant") == 0 && i + 1 < argc) {
+            variant_name = argv[++i];
+            if (strcmp(variant_name, "4x4") == 0) {
+                variant = MNK_VARIANT_4X4;
+            } else if (strcmp(variant_name, "5x5") == 0) {
+                variant = MNK_VARIANT_5X5;
+            } else if (strcmp(variant_name, "7x7") == 0) {
+                variant = MNK_VARIANT_7X7_K5;
+            } else {
+                fprintf(stderr, "Variante desconocida: %s\n", variant_name);
+                return 2;
+            }
+        } else if (strcmp(argv[i], "--positions") == 0 && i + 1 < argc) {
+            num_positions = (uint32_t)strtoul(argv[++i], NULL, 10);
+        } else if (strcmp(argv[i], "--playouts") == 0 && i + 1 < argc) {
+            num_playouts = (uint32_t)strtoul(argv[++i], NULL, 10);
+        } else if (strcmp(argv[i], "--hidden") == 0 && i + 1 < argc) {
+            num_hidden = (uint32_t)strtoul(argv[++i], NULL, 10);
+        } else if (strcmp(argv[i], "--epochs") == 0 && i + 1 < argc) {
+            num_epochs = (uint32_t)strtoul(argv[++i], NULL, 10);
+        } else if (strcmp(argv[i], "--lr") == 0 && i + 1 < argc) {
+            learning_rate = strtof(argv[++i], NULL);
+        } else if (strcmp(argv[i], "--seed") == 0 && i + 1 < argc) {
+            rng_state = (uint32_t)strtoul(argv[++i], NULL, 10);
+        } else if (argv[i][0] != '-') {
+            path = argv[i];
+        } else {
+            fprintf(stderr, "Opción desconocida: %s\n", argv[i]);
+            return 2;
+        }
+    }
+    if (num_positions < TRAIN_TEST_SHARE || num_playouts == 0 || num_hidden == 0 ||
+        num_hidden > NN_MAX_HIDDEN || (num_hidden % 4u) != 0) {
+        fprintf(stderr, "--positions >= %u, --playouts > 0 y --hidden múltiplo de 4 hasta %u\n",
+                TRAIN_TEST_SHARE, NN_MAX_HIDDEN);
+        return 2;
+    }
+    if (rng_state == 0) {
+        rng_state = 1u;
+    }
+
+    MNK_InitVariant(&rules, variant);
+    num_inputs = (uint16_t)(2u * rules.num_cells);
+    input_stride = (uint16_t)((num_inputs + 3u) & ~3u);
+
+    samples = calloc(num_positions, sizeof(Sample_t));
+    if (samples == NULL) {
+        fprintf(stderr, "Sin memoria\n");
+        return 2;
+    }
+
+    Generate();
+    Train();
+    if (!Quantize()) {
+        fprintf(stderr, "La escala de salida no entra en 32 bits\n");
+        return 2;
+    }
+
+    uint32_t mismatches = 0;
+    double float_mse = TestError(false, NULL);
+    double quant_mse = TestError(true, &mismatches);
+    printf("Prueba: error cuadrático float %.4f, int8 %.4f\n", float_mse, quant_mse);
+    printf("Núcleos escalar/SIMD distintos: %u\n", mismatches);
+
+    free(samples);
+    if (mismatches != 0) {
+        return 1;
+    }
+    return WriteModel(path, quant_mse);
+}
+
+/**
+ * @brief  Genera y etiqueta las posiciones
+ */
+static void Generate(void)
+{
+    uint32_t playout_rng = NextRandom() | 1u;
+    double mean = 0.0;
+    double square = 0.0;
+
+    for (uint32_t n = 0; n < num_positions; n++) {
+        MNK_Board_t board;
+        uint8_t plies;
+
+        // Posición al azar sin ganador y con al menos dos celdas libres
+        do {
+            MNK_Reset(&rules, &board);
+            plies = (uint8_t)(NextRandom() % (rules.num_cells - 1u));
+            bool over = false;
+            for (uint8_t p = 0; p < plies && !over; p++) {
+                MNK_Mask_t empty = MNK_Empty(&rules, &board);
+                uint8_t skip = (uint8_t)(NextRandom() % (uint32_t)__builtin_popcountll(empty));
+                while (skip--) {
+                    empty &= empty - 1u;
+                }
+                uint8_t cell = (uint8_t)__builtin_ctzll(empty);
+                over = MNK_IsWinningMove(&rules, board.cells[board.side] | (1ULL << cell), cell);
+                MNK_MakeMove(&rules, &board, cell);
+            }
+            if (!over) {
+                break;
+            }
+        } while (true);
+
+        int32_t total = 0;
+        for (uint32_t p = 0; p < num_playouts; p++) {
+            MNK_Board_t copy = board;
+            uint8_t winner = MCTS_Playout(&rules, &copy, &playout_rng);
+            total += (winner == MCTS_DRAW) ? 0 : (winner == board.side) ? 1 : -1;
+        }
+        samples[n].value = (float)total / (float)num_playouts;
+
+        q_model.input_stride = input_stride;
+        NN_Encode(&q_model, &rules, &board, samples[n].input);
+        mean += samples[n].value;
+        square += (double)samples[n].value * samples[n].value;
+    }
+    mean /= num_positions;
+    printf("Variante %s: %u posiciones, %u simulaciones por etiqueta\n", variant_name,
+           num_positions, num_playouts);
+    printf("Etiquetas: media %.3f, varianza %.4f\n", mean, square / num_positions - mean * mean);
+}
+
+/**
+ * @brief  Descenso por gradiente con momento sobre las posiciones de
+ *         entrenamiento (las de índice múltiplo de TRAIN_TEST_SHARE se reservan)
+ */
+static void Train(void)
+{
+    float scale = sqrtf(6.0f / (float)num_inputs);
+    for (uint32_t j = 0; j < num_hidden; j++) {
+        for (uint16_t i = 0; i < num_inputs; i++) {
+            w1[j][i] = (RandomUniform() * 2.0f - 1.0f) * scale;
+        }
+        w2[j] = (RandomUniform() * 2.0f - 1.0f) * sqrtf(6.0f / (float)num_hidden);
+    }
+
+    uint32_t* order = malloc(num_positions * sizeof(uint32_t));
+    if (order == NULL) {
+        fprintf(stderr, "Sin memoria\n");
+        exit(2);
+    }
+
+    for (uint32_t epoch = 0; epoch < num_epochs; epoch++) {
+        uint32_t count = 0;
+        for (uint32_t n = 0; n < num_positions; n++) {
+            if (n % TRAIN_TEST_SHARE != 0) {
+                order[count++] = n;
+            }
+        }
+        for (uint32_t n = count - 1u; n > 0; n--) {
+            uint32_t m = NextRandom() % (n + 1u);
+            uint32_t t = order[n];
+            order[n] = order[m];
+            order[m] = t;
+        }
+
+        double loss = 0.0;
+        for (uint32_t start = 0; start < count; start += TRAIN_BATCH) {
+            uint32_t end = (start + TRAIN_BATCH < count) ? start + TRAIN_BATCH : count;
+            static float g_w1[NN_MAX_HIDDEN][NN_MAX_INPUTS];
+            static float g_b1[NN_MAX_HIDDEN];
+            static float g_w2[NN_MAX_HIDDEN];
+            float g_b2 = 0.0f;
+
+            memset(g_w1, 0, sizeof(g_w1));
+            memset(g_b1, 0, sizeof(g_b1));
+            memset(g_w2, 0, sizeof(g_w2));
+
+            for (uint32_t b = start; b < end; b++) {
+                const Sample_t* s = &samples[order[b]];
+                float hidden[NN_MAX_HIDDEN];
+                float err = Predict(s->input, hidden) - s->value;
+
+                loss += (double)err * err;
+                g_b2 += err;
+                for (uint32_t j = 0; j < num_hidden; j++) {
+                    g_w2[j] += err * hidden[j];
+                    if (hidden[j] > 0.0f) {
+                        float d = err * w2[j];
+                        g_b1[j] += d;
+                        for (uint16_t i = 0; i < num_inputs; i++) {
+                            if (s->input[i]) {
+                                g_w1[j][i] += d;
+                            }
+                        }
+                    }
+                }
+            }
+
+            float step = learning_rate / (float)(end - start);
+            v_b2 = TRAIN_MOMENTUM * v_b2 - step * g_b2;
+            b2 += v_b2;
+            for (uint32_t j = 0; j < num_hidden; j++) {
+                v_w2[j] = TRAIN_MOMENTUM * v_w2[j] - step * g_w2[j];
+                w2[j] += v_w2[j];
+                v_b1[j] = TRAIN_MOMENTUM * v_b1[j] - step * g_b1[j];
+                b1[j] += v_b1[j];
+                for (uint16_t i = 0; i < num_inputs; i++) {
+                    v_w1[j][i] = TRAIN_MOMENTUM * v_w1[j][i] - step * g_w1[j][i];
+                    w1[j][i] += v_w1[j][i];
+                }
+            }
+        }
+        if (epoch % 10u == 9u || epoch + 1u == num_epochs) {
+            printf("Época %u: error cuadrático %.4f (prueba %.4f)\n", epoch + 1u, loss / count,
+                   TestError(false, NULL));
+        }
+    }
+    free(order);
+}
+
+/**
+ * @brief  Propaga una entrada por la red en float
+ * @param  hidden_out: Activaciones de la capa oculta
+ */
+static float Predict(const int8_t* input, float hidden_out[])
+{
+    float out = b2;
+
+    for (uint32_t j = 0; j < num_hidden; j++) {
+        float acc = b1[j];
+        for (uint16_t i = 0; i < num_inputs; i++) {
+            if (input[i]) {
+                acc += w1[j][i];
+            }
+        }
+        hidden_out[j] = (acc > 0.0f) ? acc : 0.0f;
+        out += w2[j] * hidden_out[j];
+    }
+    return out;
+}
+
+/**
+ * @brief  Error cuadrático medio sobre las posiciones de prueba
+ * @param  quantized: true para usar NN_Forward sobre el modelo int8
+ * @param  mismatches: Posiciones en que los dos núcleos difieren (puede ser NULL)
+ */
+static double TestError(bool quantized, uint32_t* mismatches)
+{
+    double sum = 0.0;
+    uint32_t count = 0;
+
+    for (uint32_t n = 0; n < num_positions; n += TRAIN_TEST_SHARE) {
+        float predicted;
+        if (quantized) {
+            int32_t scalar = NN_Forward(&q_model, samples[n].input, NN_KERNEL_SCALAR);
+            int32_t simd = NN_Forward(&q_model, samples[n].input, NN_KERNEL_SIMD);
+            if (mismatches != NULL && scalar != simd) {
+                (*mismatches)++;
+            }
+            predicted = (float)scalar / (float)NN_SCORE_ONE;
+        } else {
+            float hidden[NN_MAX_HIDDEN];
+            predicted = Predict(samples[n].input, hidden);
+        }
+        sum += (double)(predicted - samples[n].value) * (predicted - samples[n].value);
+        count++;
+    }
+    return sum / count;
+}
+
+/**
+ * @brief  Cuantiza la red (ver nn_eval.h) y arma q_model
+ * @retval false si el multiplicador de salida no entra en int32
+ */
+static bool Quantize(void)
+{
+    float max_w1 = 1e-6f;
+    float max_w2 = 1e-6f;
+    for (uint32_t j = 0; j < num_hidden; j++) {
+        for (uint16_t i = 0; i < num_inputs; i++) {
+            max_w1 = fmaxf(max_w1, fabsf(w1[j][i]));
+        }
+        max_w2 = fmaxf(max_w2, fabsf(w2[j]));
+    }
+    float s1 = 127.0f / max_w1;
+    float s2 = 127.0f / max_w2;
+
+    // Calibración: máximo de la capa oculta sobre los datos de entrenamiento
+    float max_hidden = 1e-6f;
+    for (uint32_t n = 0; n < num_positions; n++) {
+        float hidden[NN_MAX_HIDDEN];
+        Predict(samples[n].input, hidden);
+        for (uint32_t j = 0; j < num_hidden; j++) {
+            max_hidden = fmaxf(max_hidden, hidden[j]);
+        }
+    }
+    uint8_t shift = 0;
+    while (max_hidden * s1 / (float)(1u << shift) > 127.0f) {
+        shift++;
+    }
+    float sh = s1 / (float)(1u << shift);
+
+    memset(q_w1, 0, sizeof(q_w1));
+    for (uint32_t j = 0; j < num_hidden; j++) {
+        for (uint16_t i = 0; i < num_inputs; i++) {
+            q_w1[j * input_stride + i] = (int8_t)lroundf(w1[j][i] * s1);
+        }
+        q_b1[j] = (int32_t)lroundf(b1[j] * s1);
+        q_w2[j] = (int8_t)lroundf(w2[j] * s2);
+    }
+
+    double out_mul = (double)NN_SCORE_ONE * 65536.0 / ((double)s2 * sh);
+    if (out_mul > INT32_MAX) {
+        return false;
+    }
+
+    q_model.width = rules.width;
+    q_model.height = rules.height;
+    q_model.k = rules.k;
+    q_model.hidden = (uint8_t)num_hidden;
+    q_model.input_stride = input_stride;
+    q_model.hidden_shift = shift;
+    q_model.w1 = q_w1;
+    q_model.b1 = q_b1;
+    q_model.w2 = q_w2;
+    q_model.b2 = (int32_t)lround((double)b2 * s2 * sh);
+    q_model.out_mul = (int32_t)lround(out_mul);
+    return true;
+}
+
+/**
+ * @brief  Generador xorshift32
+ */
+static uint32_t NextRandom(void)
+{
+    rng_state ^= rng_state << 13;
+    rng_state ^= rng_state >> 17;
+    rng_state ^= rng_state << 5;
+    return rng_state;
+}
+
+static float RandomUniform(void)
+{
+    return (float)(NextRandom() >> 8) * (1.0f / 16777216.0f);
+}
+
+/**
+ * @brief  Escribe el modelo cuantizado como fuente C para el firmware
+ */
+static int WriteModel(const char* path, double test_mse)
+{
+    FILE* f = fopen(path, "w");
+    if (f == NULL) {
+        perror(path);
+        return 1;
+    }
+
+    fprintf(f, "/**\n");
+    fprintf(f, " ******************************************************************************\n");
+    fprintf(f, " * @file    nn_model_data.c\n");
+    fprintf(f, " * @brief   Red de evaluación int8 (GENERADO por Tools/nn_train.c)\n");
+    fprintf(f, " ******************************************************************************\n");
+    fprintf(f, " * @attention\n");
+    fprintf(f, " *\n");
+    fprintf(f, " * Variante %s (k = %u), %u posiciones con %u simulaciones, %u ocultas,\n",
+            variant_name, rules.k, num_positions, num_playouts, num_hidden);
+    fprintf(f, " * %u épocas. Error cuadrático de prueba (int8): %.4f.\n", num_epochs, test_mse);
+    fprintf(f, " *\n");
+    fprintf(f, " ******************************************************************************\n");
+    fprintf(f, " */\n\n");
+    fprintf(f, "#include \"nn_eval.h\"\n\n");
+
+    fprintf(f, "static const int8_t nn_w1[%u] = {", num_hidden * input_stride);
+    for (uint32_t i = 0; i < num_hidden * input_stride; i++) {
+        fprintf(f, "%s%4d%s", (i % 13u == 0) ? "\n    " : " ", q_w1[i],
+                (i + 1u < num_hidden * input_stride) ? "," : "");
+    }
+    fprintf(f, "\n};\n\n");
+
+    fprintf(f, "static const int32_t nn_b1[%u] = {", num_hidden);
+    for (uint32_t j = 0; j < num_hidden; j++) {
+        fprintf(f, "%s%6ld%s", (j % 8u == 0) ? "\n    " : " ", (long)q_b1[j],
+                (j + 1u < num_hidden) ? "," : "");
+    }
+    fprintf(f, "\n};\n\n");
+
+    fprintf(f, "static const int8_t nn_w2[%u] = {", num_hidden);
+    for (uint32_t j = 0; j < num_hidden; j++) {
+        fprintf(f, "%s%4d%s", (j % 8u == 0) ? "\n    " : " ", q_w2[j],
+                (j + 1u < num_hidden) ? "," : "");
+    }
+    fprintf(f, "\n};\n\n");
+
+    fprintf(f, "const NN_Model_t NN_Model = {\n");
+    fprintf(f, "    .width = %u,\n", q_model.width);
+    fprintf(f, "    .height = %u,\n", q_model.height);
+    fprintf(f, "    .k = %u,\n", q_model.k);
+    fprintf(f, "    .hidden = %u,\n", q_model.hidden);
+    fprintf(f, "    .input_stride = %u,\n", q_model.input_stride);
+    fprintf(f, "    .hidden_shift = %u,\n", q_model.hidden_shift);
+    fprintf(f, "    .w1 = nn_w1,\n");
+    fprintf(f, "    .b1 = nn_b1,\n");
+    fprintf(f, "    .w2 = nn_w2,\n");
+    fprintf(f, "    .b2 = %ld,\n", (long)q_model.b2);
+    fprintf(f, "    .out_mul = %ld\n", (long)q_model.out_mul);
+    fprintf(f, "};\n");
+
+    fclose(f);
+    return 0;
+}
@@ -0,0 +1,294 @@
+/**
+ ******************************************************************************
+ * @file    qubic_bench.c
+ * @brief   Benchmark (PC) del motor de Qubic (4x4x4)
+ ******************************************************************************
+ * @attention
+ *
+ * 1. Verifica las tablas: 76 líneas distintas de 4 celdas y, por celda,
+ *    las líneas de QB_CellLines coinciden con las de QB_WinMasks.
+ * 2. Partidas de QB_Search contra jugadas al azar y contra sí mismo, con
+ *    plazo por jugada (--budget-ms): latencia mínima, mediana, p99 y
+ *    máxima, nodos/s y profundidad promedio.
+ * 3. Comprueba que la búsqueda de amenazas sea segura: el jugador que
+ *    anuncia una victoria forzada tiene que ganar esa partida.
+ *
+ * Imprime CSV por stdout. Compilar y ejecutar desde la carpeta tateti/:
+ *   gcc -O2 -ICore/Inc -o qubic_bench Tools/qubic_bench.c Core/Src/qubic.c
+ *   ./qubic_bench
+ *
+ * Opciones:
+ *   --games N          Partidas por enfrentamiento (20 por defecto)
+ *   --budget-ms N      Plazo por jugada (50 por defecto)
+ *   --seed N           Semilla de las jugadas al azar (1 por defecto)
+ *
+ * La placa no tiene popcount de 64 bits y es bastante más lenta que la
+ * PC: usar los nodos/s de la tabla para elegir el plazo y, si hace falta,
+ * bajar QB_TSS_NODE_LIMIT (se puede definir al compilar).
+ *
+ ******************************************************************************
+ */
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <time.h>
+#include "qubic.h"
+
+#define BENCH_MAX_SAMPLES   (64u * 1024u)
+
+typedef struct {
+    const char* label;
+    bool random_p1;         // P1 juega al azar
+    bool random_p2;         // P2 juega al azar
+} Match_t;
+
+static uint32_t samples[BENCH_MAX_SAMPLES];
+
+static uint32_t NowUs(void);
+static uint32_t NowMs(void);
+static uint32_t NextRandom(uint32_t* rng);
+static bool CheckTables(void);
+static bool CheckMakeUnmake(uint32_t seed);
+static bool PlayMatch(const Match_t* match, uint16_t games, uint32_t budget_ms, uint32_t* rng);
+static int CompareSamples(const void* a, const void* b);
+
+int main(int argc, char** argv)
+{
+    uint16_t games = 20u;
+    uint32_t budget_ms = 50u;
+    uint32_t seed = 1u;
+
+    for (int i = 1; i < argc; i++) {
+        if (strcmp(argv[i], "--games") == 0 && i + 1 < argc) {
+            games = (uint16_t)atoi(argv[++i]);
+        } else if (strcmp(argv[i], "--budget-ms") == 0 && i + 1 < argc) {
+            budget_ms = (uint32_t)atoi(argv[++i]);
+        } else if (strcmp(argv[i], "--seed") == 0 && i + 1 < argc) {
+            seed = (uint32_t)strtoul(argv[++i], NULL, 10);
+        } else {
+            fprintf(stderr, "Opción desconocida: %s\n", argv[i]);
+            return 2;
+        }
+    }
+    if (games == 0 || (uint32_t)games * QB_NUM_CELLS > BENCH_MAX_SAMPLES) {
+        games = (games == 0) ? 1u : (uint16_t)(BENCH_MAX_SAMPLES / QB_NUM_CELLS);
+    }
+
+    // 1. Tablas y hacer/deshacer
+    if (!CheckTables() || !CheckMakeUnmake(seed)) {
+        return 1;
+    }
+
+    // 2 y 3. Partidas
+    static const Match_t matches[] = {
+        {"search_vs_random", false, true},
+        {"random_vs_search", true, false},
+        {"search_vs_search", false, false},
+    };
+    uint32_t rng = (seed != 0) ? seed : 1u;
+
+    printf("match,games,p1_wins,p2_wins,draws,moves,min_us,median_us,p99_us,max_us,"
+           "avg_depth,nodes_per_s,forced_wins\n");
+    for (uint8_t i = 0; i < sizeof(matches) / sizeof(matches[0]); i++) {
+        if (!PlayMatch(&matches[i], games, budget_ms, &rng)) {
+            return 1;
+        }
+    }
+    return 0;
+}
+
+/**
+ * @brief  Reloj de la PC en microsegundos
+ */
+static uint32_t NowUs(void)
+{
+    struct timespec ts;
+    clock_gettime(CLOCK_MONOTONIC, &ts);
+    return (uint32_t)((uint64_t)ts.tv_sec * 1000000u + (uint64_t)ts.tv_nsec / 1000u);
+}
+
+/**
+ * @brief  Reloj de la PC en milisegundos (mismo uso que HAL_GetTick)
+ */
+static uint32_t NowMs(void)
+{
+    struct timespec ts;
+    clock_gettime(CLOCK_MONOTONIC, &ts);
+    return (uint32_t)((uint64_t)ts.tv_sec * 1000u + (uint64_t)ts.tv_nsec / 1000000u);
+}
+
+/**
+ * @brief  Generador xorshift32
+ */
+static uint32_t NextRandom(uint32_t* rng)
+{
+    uint32_t x = *rng;
+    x ^= x << 13;
+    x ^= x >> 17;
+    x ^= x << 5;
+    *rng = x;
+    return x;
+}
+
+/**
+ * @brief  Verifica QB_WinMasks, QB_CellLineCount y QB_CellLines
+ */
+static bool CheckTables(void)
+{
+    for (uint8_t i = 0; i < QB_NUM_LINES; i++) {
+        if (__builtin_popcountll(QB_WinMasks[i]) != QB_SIZE) {
+            fprintf(stderr, "Línea %u: no tiene 4 celdas\n", i);
+            return false;
+        }
+        for (uint8_t j = 0; j < i; j++) {
+            if (QB_WinMasks[i] == QB_WinMasks[j]) {
+                fprintf(stderr, "Líneas %u y %u repetidas\n", j, i);
+                return false;
+            }
+        }
+    }
+
+    for (uint8_t cell = 0; cell < QB_NUM_CELLS; cell++) {
+        QB_Mask_t bit = (QB_Mask_t)1u << cell;
+        uint8_t expected = 0;
+
+        for (uint8_t i = 0; i < QB_NUM_LINES; i++) {
+            if ((QB_WinMasks[i] & bit) == 0) {
+                continue;
+            }
+            bool listed = false;
+            for (uint8_t j = 0; j < QB_CellLineCount[cell]; j++) {
+                listed |= (QB_CellLines[cell][j] == i);
+            }
+            if (!listed) {
+                fprintf(stderr, "Celda %u: falta la línea %u\n", cell, i);
+                return false;
+            }
+            expected++;
+        }
+        if (expected != QB_CellLineCount[cell]) {
+            fprintf(stderr, "Celda %u: %u líneas, la tabla dice %u\n", cell, expected,
+                    QB_CellLineCount[cell]);
+            return false;
+        }
+    }
+    return true;
+}
+
+/**
+ * @brief  Partidas al azar: QB_UnmakeMove tiene que restaurar el tablero y
+ *         el resultado de QB_MakeMove coincidir con QB_ThreatCells
+ */
+static bool CheckMakeUnmake(uint32_t seed)
+{
+    uint32_t rng = (seed != 0) ? seed : 1u;
+
+    for (uint16_t game = 0; game < 1000u; game++) {
+        QB_Board_t board;
+        QB_Reset(&board);
+
+        while (board.result == QB_RESULT_NONE) {
+            QB_Board_t before = board;
+            QB_Mask_t empty = QB_Empty(&board);
+            QB_Mask_t wins = QB_ThreatCells(board.cells[board.side], board.cells[board.side ^ 1u]);
+            uint8_t skip = (uint8_t)(NextRandom(&rng) % (uint32_t)__builtin_popcountll(empty));
+            uint8_t cell;
+
+            do {
+                cell = QB_PopLowest(&empty);
+            } while (skip-- > 0);
+
+            QB_MakeMove(&board, cell);
+            QB_UnmakeMove(&board, cell);
+            if (memcmp(&board, &before, sizeof(board)) != 0) {
+                fprintf(stderr, "QB_UnmakeMove no restauró el tablero\n");
+                return false;
+            }
+            QB_MakeMove(&board, cell);
+            bool won = (board.result == QB_RESULT_P1 || board.result == QB_RESULT_P2);
+            if (won != ((wins >> cell) & 1u)) {
+                fprintf(stderr, "Celda %u: QB_MakeMove y QB_ThreatCells no coinciden\n", cell);
+                return false;
+            }
+        }
+    }
+    return true;
+}
+
+/**
+ * @brief  Juega un enfrentamiento e imprime su línea CSV
+ * @retval false si la búsqueda anunció una victoria forzada y no ganó
+ */
+static bool PlayMatch(const Match_t* match, uint16_t games, uint32_t budget_ms, uint32_t* rng)
+{
+    uint32_t wins[3] = {0};    // P1, P2, empates
+    uint32_t count = 0;
+    uint32_t depth_sum = 0;
+    uint32_t forced = 0;
+    uint64_t total_nodes = 0;
+    uint64_t total_us = 0;
+
+    for (uint16_t game = 0; game < games; game++) {
+        QB_Board_t board;
+        int8_t claimed = -1;   // Jugador que anunció victoria forzada
+
+        QB_Reset(&board);
+        while (board.result == QB_RESULT_NONE) {
+            bool random = (board.side == 0) ? match->random_p1 : match->random_p2;
+            uint8_t cell;
+
+            if (random) {
+                QB_Mask_t empty = QB_Empty(&board);
+                uint8_t skip = (uint8_t)(NextRandom(rng) % (uint32_t)__builtin_popcountll(empty));
+                do {
+                    cell = QB_PopLowest(&empty);
+                } while (skip-- > 0);
+            } else {
+                QB_SearchResult_t result;
+                uint32_t start = NowUs();
+                QB_Search(&board, QB_MAX_DEPTH, NowMs, budget_ms, &result);
+                uint32_t us = NowUs() - start;
+
+                if (!QB_IsLegal(&board, result.best_move)) {
+                    fprintf(stderr, "Jugada ilegal %u\n", result.best_move);
+                    return false;
+                }
+                samples[count++] = us;
+                total_us += us;
+                total_nodes += result.nodes;
+                depth_sum += result.depth;
+                if (result.forced_win && claimed < 0) {
+                    claimed = (int8_t)board.side;
+                    forced++;
+                }
+                cell = result.best_move;
+            }
+            QB_MakeMove(&board, cell);
+        }
+
+        wins[board.result - QB_RESULT_P1]++;
+        if (claimed >= 0 && board.result != (uint8_t)(QB_RESULT_P1 + claimed)) {
+            fprintf(stderr, "%s, partida %u: P%d anunció victoria forzada y no ganó\n",
+                    match->label, game, claimed + 1);
+            return false;
+        }
+    }
+
+    qsort(samples, count, sizeof(samples[0]), CompareSamples);
+    printf("%s,%u,%u,%u,%u,%u,%u,%u,%u,%u,%.2f,%llu,%u\n", match->label, games, wins[0], wins[1],
+           wins[2], count, samples[0], samples[count / 2u], samples[(count * 99u) / 100u],
+           samples[count - 1u], (double)depth_sum / count,
+           (unsigned long long)(total_us ? total_nodes * 1000000u / total_us : 0), forced);
+    return true;
+}
+
+/**
+ * @brief  Orden ascendente para qsort
+ */
+static int CompareSamples(const void* a, const void* b)
+{
+    uint32_t x = *(const uint32_t*)a;
+    uint32_t y = *(const uint32_t*)b;
+    return (x > y) - (x < y);
+}
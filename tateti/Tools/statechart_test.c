@@ -0,0 +1,244 @@
+/**
+ ******************************************************************************
+ * @file    statechart_test.c
+ * @brief   Pruebas (PC) del statechart con la lógica real del juego
+ ******************************************************************************
+ * @attention
+ *
+ * Corre tateti.c y tateti_glue.c sobre game_logic.c y ultimate.c, con el
+ * display, los colores y la configuración de main.c reemplazados por
+ * funciones vacías, y manda las teclas como lo hace el loop principal.
+ *
+ * 1. Ultimate: después de una partida ganada abre P2. Su primera jugada
+ *    tiene que quedar en el tablero y pasarle el turno a P1, y una jugada
+ *    fuera de turno tiene que rechazarse.
+ * 2. Deshacer contra la IA: si la IA (P2) abrió la partida, deshacer no
+ *    puede dejarle el turno a la IA; sin jugadas de P1 no hace nada y con
+ *    una jugada de P1 vuelve a la posición posterior a la apertura.
+ *
+ * Retorna 1 si alguna prueba falla. Compilar y ejecutar desde la carpeta
+ * tateti/:
+ *   gcc -O2 -ITools/host -ICore/Inc -o statechart_test Tools/statechart_test.c \
+ *       Core/Src/tateti.c Core/Src/tateti_glue.c Core/Src/game_logic.c \
+ *       Core/Src/game_input.c Core/Src/ultimate.c Core/Src/ultimate_search.c \
+ *       Core/Src/bitboard.c
+ *   ./statechart_test
+ *
+ ******************************************************************************
+ */
+
+#include <stdio.h>
+#include "tateti.h"
+#include "display.h"
+#include "color_manager.h"
+#include "game_input.h"
+#include "game_logic.h"
+#include "ultimate.h"
+#include "ultimate_search.h"
+
+#define TEST_MAX_PLIES  (4u * UT_NUM_CELLS)   // Alcanza aunque haya empates antes
+
+static Tateti statechart;
+static uint8_t game_mode = 0;       // 0 = PvP, 1 = PvIA
+static uint8_t game_variant = 0;    // 0 = tateti, 1 = ultimate
+static Keyboard_Key_t position_keys[BB_NUM_CELLS];
+static int failures = 0;
+
+static void Check(bool condition, const char* what);
+static void PressKey(Keyboard_Key_t key);
+static bool PlayUltimateMove(uint8_t move);
+static bool TestUltimateSecondOpener(void);
+static bool TestUndoAfterAiOpens(void);
+
+int main(void)
+{
+    // Tecla de cada posición del tablero (inversa de GameInput_KeyToPosition)
+    for (uint8_t key = KEY_P0; key <= KEY_P15; key++) {
+        if (GameInput_IsBoardAction((Keyboard_Key_t)key)) {
+            position_keys[GameInput_KeyToPosition((Keyboard_Key_t)key)] = (Keyboard_Key_t)key;
+        }
+    }
+
+    TestUltimateSecondOpener();
+    TestUndoAfterAiOpens();
+
+    printf("%s\n", (failures == 0) ? "Todas las pruebas pasaron" : "Hay pruebas que fallaron");
+    return (failures == 0) ? 0 : 1;
+}
+
+/**
+ * @brief  Ultimate: P2 abre la segunda partida del match
+ */
+static bool TestUltimateSecondOpener(void)
+{
+    game_mode = 0;
+    game_variant = 1;
+    tateti_init(&statechart);
+    tateti_enter(&statechart);
+    PressKey(position_keys[0]);     // Desde IDLE cualquier casilla arranca
+    Check(tateti_is_state_active(&statechart, Tateti_main_region_Playing),
+          "ultimate: la primera tecla arranca la partida");
+
+    // Partida 1: ambos juegan la mejor jugada a profundidad 2 hasta que alguien
+    // gana (un empate reinicia el tablero sin cambiar quién abre)
+    for (uint16_t ply = 0; ply < TEST_MAX_PLIES; ply++) {
+        if (tateti_get_p1_score(&statechart) + tateti_get_p2_score(&statechart) != 0) {
+            break;
+        }
+        UTSearch_Result_t result;
+        UTSearch_BestMove(Ultimate_GetBoard(), 2u, NULL, 0, &result);
+        if (!PlayUltimateMove(result.best_move)) {
+            Check(false, "ultimate: la partida 1 acepta las jugadas de la búsqueda");
+            return false;
+        }
+    }
+    Check(tateti_get_p1_score(&statechart) + tateti_get_p2_score(&statechart) == 1,
+          "ultimate: alguien gana la partida 1");
+
+    // Partida 2: abre P2 y el tablero tiene que estar de acuerdo
+    const UT_Board_t* board = Ultimate_GetBoard();
+    Check(tateti_is_state_active(&statechart, Tateti_main_region_Playing),
+          "ultimate: después de la partida 1 empieza la 2");
+    Check(tateti_get_current_player(&statechart) == CELL_PLAYER2, "ultimate: la partida 2 la abre P2");
+    Check(board->move_count == 0 && board->side == 1, "ultimate: el tablero espera a P2");
+    Check(!Ultimate_IsValidMove(4, CELL_PLAYER1), "ultimate: P1 fuera de turno se rechaza");
+
+    Check(PlayUltimateMove(4u * BB_NUM_CELLS + 4u), "ultimate: la jugada de apertura de P2 vale");
+    Check(board->move_count == 1 && (board->cells[1][4] & (1u << 4)) != 0,
+          "ultimate: la apertura de P2 queda en el tablero");
+    Check(tateti_get_current_player(&statechart) == CELL_PLAYER1 && board->side == 0,
+          "ultimate: después de la apertura le toca a P1");
+    Check(!Ultimate_IsValidMove(0, CELL_PLAYER2), "ultimate: P2 fuera de turno se rechaza");
+    return failures == 0;
+}
+
+/**
+ * @brief  PvIA: deshacer cuando la IA abrió la segunda partida
+ */
+static bool TestUndoAfterAiOpens(void)
+{
+    // Partida 1: P1 gana con la fila de arriba (las jugadas de la IA las
+    // manda main.c como teclas, igual que acá)
+    static const uint8_t first_game[] = {0, 3, 1, 4, 2};
+    int before = failures;
+
+    game_mode = 1;
+    game_variant = 0;
+    tateti_init(&statechart);
+    tateti_enter(&statechart);
+    PressKey(position_keys[first_game[0]]);  // Desde IDLE la primera tecla arranca
+    for (uint8_t i = 0; i < sizeof(first_game); i++) {
+        PressKey(position_keys[first_game[i]]);
+    }
+    Check(tateti_get_p1_score(&statechart) == 1, "deshacer: P1 gana la partida 1");
+    Check(tateti_get_current_player(&statechart) == CELL_PLAYER2, "deshacer: la partida 2 la abre la IA");
+
+    // Solo la apertura de la IA: deshacer no cambia nada
+    PressKey(position_keys[4]);
+    PressKey(KEY_P3);
+    Check(Game_GetCell(4) == CELL_PLAYER2 && Game_GetBitboard().p1 == 0,
+          "deshacer: sin jugadas de P1 la apertura de la IA queda");
+    Check(tateti_get_current_player(&statechart) == CELL_PLAYER1,
+          "deshacer: sin jugadas de P1 le sigue tocando a P1");
+
+    // P1 y la IA juegan: deshacer vuelve a la posición después de la apertura
+    PressKey(position_keys[0]);
+    PressKey(position_keys[8]);
+    PressKey(KEY_P3);
+    Check(Game_GetBitboard().p1 == 0 && Game_GetBitboard().p2 == (1u << 4),
+          "deshacer: vuelve a la posición después de la apertura");
+    Check(tateti_get_current_player(&statechart) == CELL_PLAYER1, "deshacer: le toca a P1");
+    Check(tateti_is_state_active(&statechart, Tateti_main_region_Playing), "deshacer: sigue la partida");
+    return failures == before;
+}
+
+/**
+ * @brief  Juega sub-tablero * 9 + celda como main.c: elige el sub-tablero si
+ *         la jugada es libre y manda la tecla de la celda
+ * @retval true si la jugada llegó al tablero
+ */
+static bool PlayUltimateMove(uint8_t move)
+{
+    uint8_t count = Ultimate_GetBoard()->move_count;
+
+    if (Ultimate_GetActiveBoard() == UT_ANY_BOARD) {
+        Ultimate_SelectBoard(move / BB_NUM_CELLS);
+    }
+    PressKey(position_keys[move % BB_NUM_CELLS]);
+    return Ultimate_GetBoard()->move_count == (uint8_t)(count + 1u) ||
+           Ultimate_GetBoard()->move_count == 0;  // La jugada cerró la partida
+}
+
+/**
+ * @brief  Manda una tecla y deja correr las transiciones sin evento
+ */
+static void PressKey(Keyboard_Key_t key)
+{
+    tateti_raise_key_pressed(&statechart, (sc_integer)key);
+    for (uint8_t i = 0; i < 4u; i++) {
+        tateti_trigger_without_event(&statechart);
+    }
+}
+
+/**
+ * @brief  Cuenta y muestra una prueba fallida
+ */
+static void Check(bool condition, const char* what)
+{
+    if (!condition) {
+        printf("FALLA: %s\n", what);
+        failures++;
+    }
+}
+
+/* Reemplazos de main.c, display.c y color_manager.c -------------------------*/
+
+uint8_t GetGameMode(void)
+{
+    return game_mode;
+}
+
+uint8_t GetGameVariant(void)
+{
+    return game_variant;
+}
+
+void Display_UpdateAll(uint8_t p1_score, uint8_t p2_score, CellState_t current_player)
+{
+    (void)p1_score;
+    (void)p2_score;
+    (void)current_player;
+}
+
+void Display_ShowUltimateOverview(uint8_t highlight)
+{
+    (void)highlight;
+}
+
+void Display_MatchWinAnimation(WinType_t win_type, CellState_t winner)
+{
+    (void)win_type;
+    (void)winner;
+}
+
+void Display_GameWinAnimation(CellState_t winner)
+{
+    (void)winner;
+}
+
+void Display_ShowColorSelection(void)
+{
+}
+
+void Display_ShowGameMode(uint8_t mode)
+{
+    (void)mode;
+}
+
+void ColorManager_CyclePlayer1(void)
+{
+}
+
+void ColorManager_CyclePlayer2(void)
+{
+}
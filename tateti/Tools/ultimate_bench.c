@@ -0,0 +1,229 @@
+/**
+ ******************************************************************************
+ * @file    ultimate_bench.c
+ * @brief   Benchmark (PC) del motor de ultimate tateti
+ ******************************************************************************
+ * @attention
+ *
+ * 1. perft desde el tablero vacío: verifica UT_MakeMove/UT_UnmakeMove
+ *    (el tablero tiene que quedar igual) y mide jugadas/s.
+ * 2. Búsqueda a profundidad fija sobre posiciones de partidas al azar
+ *    (reproducibles con --seed): latencia mínima, mediana, p99 y máxima,
+ *    nodos y nodos/s por profundidad.
+ * 3. Búsqueda con plazo (--budget-ms): latencia y profundidad alcanzada,
+ *    para comprobar que la jugada llega dentro del plazo.
+ *
+ * Imprime CSV por stdout. Compilar y ejecutar desde la carpeta tateti/:
+ *   gcc -O2 -ICore/Inc -o ultimate_bench Tools/ultimate_bench.c \
+ *       Core/Src/ultimate.c Core/Src/ultimate_search.c Core/Src/bitboard.c
+ *   ./ultimate_bench
+ *
+ * Opciones:
+ *   --positions N      Posiciones a medir (200 por defecto)
+ *   --max-depth N      Profundidad fija máxima (5 por defecto)
+ *   --perft N          Profundidad del perft (5 por defecto)
+ *   --budget-ms N      Plazo de la búsqueda con plazo (100 por defecto)
+ *   --seed N           Semilla de las partidas al azar (1 por defecto)
+ *
+ * La placa (168 MHz, sin caché de datos para la pila) es bastante más
+ * lenta que la PC: usar los nodos por jugada de la tabla para elegir
+ * ULTIMATE_AI_BUDGET_MS en ai.h.
+ *
+ ******************************************************************************
+ */
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <time.h>
+#include "ultimate.h"
+#include "ultimate_search.h"
+
+#define BENCH_MAX_POSITIONS     4096u
+
+static UT_Board_t positions[BENCH_MAX_POSITIONS];
+static uint32_t samples[BENCH_MAX_POSITIONS];
+
+static uint32_t NowUs(void);
+static uint32_t NowMs(void);
+static uint32_t NextRandom(uint32_t* rng);
+static uint16_t CollectPositions(uint16_t count, uint32_t seed);
+static int CompareSamples(const void* a, const void* b);
+static void PrintStats(const char* label, uint16_t count, uint64_t total_nodes, uint32_t depth_sum);
+
+int main(int argc, char** argv)
+{
+    uint16_t count = 200u;
+    uint8_t max_depth = 5u;
+    uint8_t perft_depth = 5u;
+    uint32_t budget_ms = 100u;
+    uint32_t seed = 1u;
+
+    for (int i = 1; i < argc; i++) {
+        if (strcmp(argv[i], "--positions") == 0 && i + 1 < argc) {
+            count = (uint16_t)atoi(argv[++i]);
+        } else if (strcmp(argv[i], "--max-depth") == 0 && i + 1 < argc) {
+            max_depth = (uint8_t)atoi(argv[++i]);
+        } else if (strcmp(argv[i], "--perft") == 0 && i + 1 < argc) {
+            perft_depth = (uint8_t)atoi(argv[++i]);
+        } else if (strcmp(argv[i], "--budget-ms") == 0 && i + 1 < argc) {
+            budget_ms = (uint32_t)atoi(argv[++i]);
+        } else if (strcmp(argv[i], "--seed") == 0 && i + 1 < argc) {
+            seed = (uint32_t)strtoul(argv[++i], NULL, 10);
+        } else {
+            fprintf(stderr, "Opción desconocida: %s\n", argv[i]);
+            return 2;
+        }
+    }
+    if (count == 0 || count > BENCH_MAX_POSITIONS) {
+        count = (count == 0) ? 1u : BENCH_MAX_POSITIONS;
+    }
+
+    // 1. perft
+    UT_Board_t board;
+    UT_Board_t before;
+    UT_Reset(&board);
+    before = board;
+    printf("test,depth,nodes,us,nodes_per_s\n");
+    for (uint8_t d = 1; d <= perft_depth; d++) {
+        uint32_t start = NowUs();
+        uint64_t nodes = UT_Perft(&board, d);
+        uint32_t us = NowUs() - start;
+        printf("perft,%u,%llu,%u,%llu\n", d, (unsigned long long)nodes, us,
+               (unsigned long long)(us ? nodes * 1000000u / us : 0));
+        if (memcmp(&board, &before, sizeof(board)) != 0) {
+            fprintf(stderr, "perft %u: UT_UnmakeMove no restauró el tablero\n", d);
+            return 1;
+        }
+    }
+
+    // 2. Profundidad fija
+    count = CollectPositions(count, seed);
+    printf("\nsearch,positions,min_us,median_us,p99_us,max_us,avg_depth,nodes,nodes_per_s\n");
+    for (uint8_t d = 1; d <= max_depth; d++) {
+        uint64_t total_nodes = 0;
+        uint32_t depth_sum = 0;
+        for (uint16_t i = 0; i < count; i++) {
+            UTSearch_Result_t result;
+            uint32_t start = NowUs();
+            UTSearch_BestMove(&positions[i], d, NULL, 0, &result);
+            samples[i] = NowUs() - start;
+            total_nodes += result.nodes;
+            depth_sum += result.depth;
+            if (!UT_IsLegal(&positions[i], result.best_move)) {
+                fprintf(stderr, "Jugada ilegal %u en la posición %u\n", result.best_move, i);
+                return 1;
+            }
+        }
+        char label[16];
+        snprintf(label, sizeof(label), "depth%u", d);
+        PrintStats(label, count, total_nodes, depth_sum);
+    }
+
+    // 3. Con plazo
+    uint64_t total_nodes = 0;
+    uint32_t depth_sum = 0;
+    for (uint16_t i = 0; i < count; i++) {
+        UTSearch_Result_t result;
+        uint32_t start = NowUs();
+        UTSearch_BestMove(&positions[i], UT_SEARCH_MAX_DEPTH, NowMs, budget_ms, &result);
+        samples[i] = NowUs() - start;
+        total_nodes += result.nodes;
+        depth_sum += result.depth;
+    }
+    char label[24];
+    snprintf(label, sizeof(label), "budget%ums", budget_ms);
+    PrintStats(label, count, total_nodes, depth_sum);
+    return 0;
+}
+
+/**
+ * @brief  Reloj de la PC en microsegundos
+ */
+static uint32_t NowUs(void)
+{
+    struct timespec ts;
+    clock_gettime(CLOCK_MONOTONIC, &ts);
+    return (uint32_t)((uint64_t)ts.tv_sec * 1000000u + (uint64_t)ts.tv_nsec / 1000u);
+}
+
+/**
+ * @brief  Reloj de la PC en milisegundos (mismo uso que HAL_GetTick)
+ */
+static uint32_t NowMs(void)
+{
+    struct timespec ts;
+    clock_gettime(CLOCK_MONOTONIC, &ts);
+    return (uint32_t)((uint64_t)ts.tv_sec * 1000u + (uint64_t)ts.tv_nsec / 1000000u);
+}
+
+/**
+ * @brief  Generador xorshift32
+ */
+static uint32_t NextRandom(uint32_t* rng)
+{
+    uint32_t x = *rng;
+    x ^= x << 13;
+    x ^= x >> 17;
+    x ^= x << 5;
+    *rng = x;
+    return x;
+}
+
+/**
+ * @brief  Juega partidas al azar y guarda posiciones no terminadas de 8 a 40 jugadas
+ * @retval Cantidad de posiciones guardadas
+ */
+static uint16_t CollectPositions(uint16_t count, uint32_t seed)
+{
+    uint32_t rng = (seed != 0) ? seed : 1u;
+    uint16_t stored = 0;
+
+    while (stored < count) {
+        UT_Board_t board;
+        uint8_t target = (uint8_t)(8u + NextRandom(&rng) % 33u);
+        uint8_t moves[UT_NUM_CELLS];
+
+        UT_Reset(&board);
+        while (board.move_count < target) {
+            uint8_t n = UT_GenerateMoves(&board, moves);
+            UT_Undo_t undo;
+            if (n == 0) {
+                break;
+            }
+            UT_MakeMove(&board, moves[NextRandom(&rng) % n], &undo);
+        }
+        if (board.result == UT_RESULT_NONE) {
+            positions[stored++] = board;
+        }
+    }
+    return stored;
+}
+
+/**
+ * @brief  Orden ascendente para qsort
+ */
+static int CompareSamples(const void* a, const void* b)
+{
+    uint32_t x = *(const uint32_t*)a;
+    uint32_t y = *(const uint32_t*)b;
+    return (x > y) - (x < y);
+}
+
+/**
+ * @brief  Imprime una línea CSV con las estadísticas de samples[]
+ */
+static void PrintStats(const char* label, uint16_t count, uint64_t total_nodes, uint32_t depth_sum)
+{
+    uint64_t total_us = 0;
+
+    for (uint16_t i = 0; i < count; i++) {
+        total_us += samples[i];
+    }
+    qsort(samples, count, sizeof(samples[0]), CompareSamples);
+
+    printf("%s,%u,%u,%u,%u,%u,%.2f,%llu,%llu\n", label, count, samples[0], samples[count / 2u],
+           samples[(count * 99u) / 100u], samples[count - 1u], (double)depth_sum / count,
+           (unsigned long long)total_nodes,
+           (unsigned long long)(total_us ? total_nodes * 1000000u / total_us : 0));
+}
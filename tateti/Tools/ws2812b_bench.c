@@ -0,0 +1,124 @@
+/**
+ ******************************************************************************
+ * @file    ws2812b_bench.c
+ * @brief   Benchmark (PC) de los codificadores WS2812B: saltos contra tabla
+ ******************************************************************************
+ * @attention
+ *
+ * 1. Compara WS2812B_EncodeLut y WS2812B_EncodeLutDirty contra
+ *    WS2812B_EncodeBranchy (Core/Src/ws2812b_bench.c) para 16, 256 y 1024
+ *    LEDs: retorna 1 si alguna media palabra difiere.
+ * 2. Costo por trama y por LED de cada codificador (CSV, ticks = ns). En la
+ *    placa la misma tabla sale en ciclos con -DWS2812B_BENCH_ON_TARGET.
+ * 3. Pipeline de color en enteros contra Gamma_correccion() (float y pow()):
+ *    error respecto de la curva exacta (retorna 1 si el redondeo se aleja
+ *    más de 0,55 pasos o el promedio con dithering más de 4/256) y costo
+ *    por trama.
+ *
+ * Compilar y ejecutar desde la carpeta tateti/:
+ *   gcc -O2 -ITools/host -ICore/Inc -o ws2812b_bench Tools/ws2812b_bench.c \
+ *       Core/Src/ws2812b_bench.c Core/Src/ws2812b_encode.c \
+ *       Core/Src/ws2812b_color.c Core/Src/ws2812b_gamma_data.c -lm
+ *   ./ws2812b_bench
+ *
+ * Opciones:
+ *   --frames N         Tramas medidas por fila, se queda el mínimo (200 por defecto)
+ *   --seed N           Semilla (12345 por defecto)
+ *
+ ******************************************************************************
+ */
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <time.h>
+#include "stm32f4xx_hal.h"
+#include "ws2812b_bench.h"
+
+/* Reemplazos del HAL (Tools/host/stm32f4xx_hal.h) */
+HostHAL_DWT_t HostHAL_DWT;
+HostHAL_CoreDebug_t HostHAL_CoreDebug;
+uint32_t SystemCoreClock = 168000000u;
+
+static uint32_t HostClock(void);
+
+uint32_t HAL_GetTick(void)
+{
+    return HostClock() / 1000000u;
+}
+
+int main(int argc, char** argv)
+{
+    uint16_t frames = 200u;
+    uint32_t seed = WS2812B_BENCH_SEED;
+
+    for (int i = 1; i < argc; i++) {
+        if (strcmp(argv[i], "--frames") == 0 && i + 1 < argc) {
+            frames = (uint16_t)atoi(argv[++i]);
+        } else if (strcmp(argv[i], "--seed") == 0 && i + 1 < argc) {
+            seed = (uint32_t)strtoul(argv[++i], NULL, 10);
+        } else {
+            fprintf(stderr, "Opción desconocida: %s\n", argv[i]);
+            return 2;
+        }
+    }
+    if (frames == 0) {
+        frames = 1u;
+    }
+
+    // 1. Exactitud
+    uint32_t mismatches = 0;
+    for (uint8_t s = 0; s < WS2812B_BENCH_NUM_SIZES; s++) {
+        mismatches += WS2812BBench_Check(WS2812BBench_Sizes[s], seed);
+    }
+    printf("encoder_mismatches,%u\n", mismatches);
+    if (mismatches != 0) {
+        return 1;
+    }
+
+    // 2. Costo por trama
+    WS2812BBench_PrintHeader();
+    for (uint8_t s = 0; s < WS2812B_BENCH_NUM_SIZES; s++) {
+        WS2812BBench_Result_t result;
+        uint32_t baseline = 0;
+
+        for (uint8_t e = 0; e < WS2812B_BENCH_NUM_ENCODERS; e++) {
+            WS2812BBench_Run((WS2812BBench_Encoder_t)e, WS2812BBench_Sizes[s], frames, HostClock,
+                             seed, &result);
+            if (e == WS2812B_BENCH_BRANCHY) {
+                baseline = result.ticks_per_frame;
+            }
+            WS2812BBench_PrintResult(&result, baseline);
+        }
+    }
+
+    // 3. Pipeline de color
+    WS2812BBench_ColorError_t error;
+    WS2812BBench_CheckColor(&error);
+    printf("color_error_256ths,round,%u,dither,%u\n", error.round_max, error.dither_max);
+    WS2812BBench_PrintColorHeader();
+    for (uint8_t s = 0; s < WS2812B_BENCH_NUM_SIZES; s++) {
+        WS2812BBench_ColorResult_t result;
+        uint32_t baseline = 0;
+
+        for (uint8_t p = 0; p < WS2812B_BENCH_NUM_PIPELINES; p++) {
+            WS2812BBench_RunColor((WS2812BBench_Pipeline_t)p, WS2812BBench_Sizes[s], frames, HostClock,
+                                  seed, &result);
+            if (p == WS2812B_BENCH_FLOAT_POW) {
+                baseline = result.ticks_per_frame;
+            }
+            WS2812BBench_PrintColorResult(&result, baseline);
+        }
+    }
+    return (error.round_max > 141u || error.dither_max > 4u) ? 1 : 0;
+}
+
+/**
+ * @brief  Reloj de la PC en nanosegundos
+ */
+static uint32_t HostClock(void)
+{
+    struct timespec ts;
+    clock_gettime(CLOCK_MONOTONIC, &ts);
+    return (uint32_t)((uint64_t)ts.tv_sec * 1000000000u + (uint64_t)ts.tv_nsec);
+}
@@ -0,0 +1,72 @@
+/**
+ ******************************************************************************
+ * @file    ws2812b_gammagen.c
+ * @brief   Generador (PC) de las tablas gamma de ws2812b_color.c
+ ******************************************************************************
+ * @attention
+ *
+ * Escribe Core/Src/ws2812b_gamma_data.c: para cada canal (G, R, B) y cada
+ * color c, round(65535 * (c / 255)^gamma). El firmware no usa float ni pow.
+ *
+ * Compilar y ejecutar desde la carpeta tateti/:
+ *   gcc -O2 -o ws2812b_gammagen Tools/ws2812b_gammagen.c -lm
+ *   ./ws2812b_gammagen Core/Src/ws2812b_gamma_data.c
+ *
+ * Opciones (después de la ruta):
+ *   --gamma R,G,B      Gamma de cada canal (2.2,2.2,2.2 por defecto)
+ *
+ ******************************************************************************
+ */
+
+#include <math.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+
+int main(int argc, char** argv)
+{
+    const char* path = (argc > 1) ? argv[1] : "ws2812b_gamma_data.c";
+    double gamma_rgb[3] = { 2.2, 2.2, 2.2 };
+
+    for (int i = 2; i < argc; i++) {
+        if (strcmp(argv[i], "--gamma") == 0 && i + 1 < argc) {
+            if (sscanf(argv[++i], "%lf,%lf,%lf", &gamma_rgb[0], &gamma_rgb[1], &gamma_rgb[2]) != 3) {
+                fprintf(stderr, "--gamma espera R,G,B\n");
+                return 2;
+            }
+        } else {
+            fprintf(stderr, "Opción desconocida: %s\n", argv[i]);
+            return 2;
+        }
+    }
+
+    FILE* f = fopen(path, "w");
+    if (f == NULL) {
+        perror(path);
+        return 1;
+    }
+
+    // Orden del WS2812B: G, R, B
+    const double gamma_grb[3] = { gamma_rgb[1], gamma_rgb[0], gamma_rgb[2] };
+    const char* const names[3] = { "G", "R", "B" };
+
+    fprintf(f, "/**\n");
+    fprintf(f, " ******************************************************************************\n");
+    fprintf(f, " * @file    ws2812b_gamma_data.c\n");
+    fprintf(f, " * @brief   Tablas gamma Q16 por canal (GENERADO por Tools/ws2812b_gammagen.c)\n");
+    fprintf(f, " ******************************************************************************\n");
+    fprintf(f, " */\n\n");
+    fprintf(f, "#include \"ws2812b_color.h\"\n\n");
+    fprintf(f, "const uint16_t WS2812B_Gamma[3][256] = {\n");
+    for (int c = 0; c < 3; c++) {
+        fprintf(f, "    {   // %s, gamma %.2f\n", names[c], gamma_grb[c]);
+        for (int v = 0; v < 256; v++) {
+            long q = lround(65535.0 * pow(v / 255.0, gamma_grb[c]));
+            fprintf(f, "%s%5ld,%s", (v % 8 == 0) ? "       " : " ", q, (v % 8 == 7) ? "\n" : "");
+        }
+        fprintf(f, "    }%s\n", (c < 2) ? "," : "");
+    }
+    fprintf(f, "};\n");
+    fclose(f);
+    return 0;
+}